@@ -39,6 +39,7 @@
 #define HAL_USART_INT_PRIO              1U
 #define HAL_I2C_INT_PRIO                1U
 #define HAL_TMR_INT_PRIO                0U
+#define HAL_DMA_INT_PRIO                1U
 
 // <e> USART0 (Universal synchronous asynchronous receiver transmitter) [Driver_USART0]
 // </e> USART0 (Universal synchronous asynchronous receiver transmitter) [Driver_USART0]
@@ -53,6 +54,17 @@
 #define RTE_USART0_RX_PIN               GPIO_PIN_0
 #define RTE_USART0_RX_FUNC              GPIO_PIN_FUNC_1
 
+// <e> USART0 Buffered mode
+// <i> Software RX/TX FIFOs serviced by the interrupt handler (USART0_Read, USART0_Write)
+//   <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//   <i>  Receive FIFO size in bytes (power of two)
+//   <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//   <i>  Transmit FIFO size in bytes (power of two)
+// </e>
+#define RTE_USART0_FIFO                 0
+#define RTE_USART0_RX_FIFO_SIZE         64
+#define RTE_USART0_TX_FIFO_SIZE         64
+
 // <e> I2C0 (Inter-integrated Circuit Interface 0) [Driver_I2C0]
 // <i> Configuration settings for Driver_I2C0 in component ::Drivers:I2C
 // </e> I2C0 (Inter-integrated Circuit Interface 0) [Driver_I2C0]
@@ -21,7 +21,9 @@
  *  includes
  ******************************************************************************/
 
-#include "ADuCM320.h"
+#include <stddef.h>
+
+#include "RTE_Device.h"
 #include "DMA_ADuCM320.h"
 
 /*******************************************************************************
@@ -32,10 +34,30 @@
  *  defines and macros (scope: module-local)
  ******************************************************************************/
 
+#define DMA_CHANNEL_MASK          ((1UL << DMA_CHANNEL_NUMBER) - 1U)
+
+// Control data structure: 16 primary entries followed by 16 alternate entries
+#define DMA_CCD_ENTRIES           16U
+
+#define DMA_CTRL_SRC_INC_Pos      26U
+#define DMA_CTRL_DST_INC_Pos      30U
+#define DMA_CTRL_INC_NONE         3U
+
 /*******************************************************************************
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
 
+// DMA channel run-time information
+typedef struct _DMA_INFO {
+  DMA_SignalEvent_t       cb_event;      // Channel callback
+  uint32_t                src_addr;      // Source address of current chunk
+  uint32_t                dst_addr;      // Destination address of current chunk
+  uint32_t                control;       // Channel control template
+  uint32_t                size;          // Total number of data items
+  uint32_t                done;          // Data items of completed chunks
+  uint32_t                chunk;         // Data items of current chunk
+} DMA_INFO_t;
+
 /*******************************************************************************
  *  global variable definitions  (scope: module-exported)
  ******************************************************************************/
@@ -44,6 +66,13 @@
  *  global variable definitions (scope: module-local)
  ******************************************************************************/
 
+// Controller selects the alternate entries with address bit 8 (base + 0x100),
+// so the base of the whole 512-byte control data structure must be 512-byte aligned
+static DMA_DESCRIPTOR_t DMA_CCD[2U * DMA_CCD_ENTRIES] __ALIGNED(512);
+
+static DMA_INFO_t DMA_Info[DMA_CHANNEL_NUMBER];
+static uint32_t   DMA_RefCount;
+
 /*******************************************************************************
  *  function prototypes (scope: module-local)
  ******************************************************************************/
@@ -52,6 +81,144 @@
  *  function implementations (scope: module-local)
  ******************************************************************************/
 
+/**
+ * @brief       Calculate end pointer of a transfer.
+ * @param[in]   addr  Start address
+ * @param[in]   inc   Address increment field (0: byte, 1: halfword, 2: word, 3: none)
+ * @param[in]   num   Number of data items
+ * @return      End address
+ */
+static
+uint32_t DMA_EndPointer(uint32_t addr, uint32_t inc, uint32_t num)
+{
+  if (inc == DMA_CTRL_INC_NONE) {
+    return addr;
+  }
+
+  return (addr + ((num - 1U) << inc));
+}
+
+/**
+ * @brief       Fill channel descriptor.
+ * @param[out]  desc      Pointer to descriptor
+ * @param[in]   src_addr  Source start address
+ * @param[in]   dest_addr Destination start address
+ * @param[in]   num       Number of data items (1..DMA_MAX_TRANSFER)
+ * @param[in]   control   Channel control with cycle type
+ */
+static
+void DMA_LoadDescriptor(DMA_DESCRIPTOR_t *desc, uint32_t src_addr,
+    uint32_t dest_addr, uint32_t num, uint32_t control)
+{
+  desc->src_end = DMA_EndPointer(src_addr,  (control >> DMA_CTRL_SRC_INC_Pos) & 3U, num);
+  desc->dst_end = DMA_EndPointer(dest_addr, (control >> DMA_CTRL_DST_INC_Pos) & 3U, num);
+  desc->control = (control & ~DMA_CTRL_N_MINUS_1_Msk) |
+                  ((num - 1U) << DMA_CTRL_N_MINUS_1_Pos);
+}
+
+/**
+ * @brief       Load next chunk of a split basic/auto-request transfer.
+ * @param[in]   ch    Channel number
+ * @param[in]   info  Pointer to channel information
+ */
+static
+void DMA_LoadChunk(uint8_t ch, DMA_INFO_t *info)
+{
+  uint32_t num = info->size - info->done;
+
+  if (num > DMA_MAX_TRANSFER) {
+    num = DMA_MAX_TRANSFER;
+  }
+  info->chunk = num;
+
+  DMA_LoadDescriptor(&DMA_CCD[ch], info->src_addr, info->dst_addr, num, info->control);
+}
+
+/**
+ * @brief       Apply channel configuration and callback.
+ * @param[in]   ch        Channel number
+ * @param[in]   config    Channel configuration
+ * @param[in]   cb_event  Channel callback pointer
+ */
+static
+void DMA_SetConfig(uint8_t ch, uint32_t config, DMA_SignalEvent_t cb_event)
+{
+  uint32_t mask = (1UL << ch);
+
+  DMA_Info[ch].cb_event = cb_event;
+
+  if (config & DMA_CFG_PRIORITY_HIGH) {
+    pADI_DMA->DMAPRISET = mask;
+  } else {
+    pADI_DMA->DMAPRICLR = mask;
+  }
+
+  if (config & DMA_CFG_BYTE_SWAP) {
+    pADI_DMA->DMABSSET = mask;
+  } else {
+    pADI_DMA->DMABSCLR = mask;
+  }
+
+  // Start with the primary descriptor
+  pADI_DMA->DMAALTCLR = mask;
+
+  NVIC_ClearPendingIRQ((IRQn_Type)(DMA_SPI0_TX_IRQn + ch));
+  NVIC_Enable_IRQ((IRQn_Type)(DMA_SPI0_TX_IRQn + ch), HAL_DMA_INT_PRIO);
+}
+
+/**
+ * @brief       DMA channel interrupt handler.
+ * @param[in]   ch    Channel number
+ */
+static
+void DMA_IRQHandler(uint8_t ch)
+{
+  DMA_INFO_t *info = &DMA_Info[ch];
+  uint32_t mask = (1UL << ch);
+  uint32_t event;
+
+  switch (info->control & DMA_CTRL_CYCLE_Msk) {
+    case DMA_CTRL_CYCLE_BASIC:
+    case DMA_CTRL_CYCLE_AUTO:
+      info->done += info->chunk;
+      if (info->done < info->size) {
+        // Advance addresses and re-arm with the next chunk
+        if (((info->control >> DMA_CTRL_SRC_INC_Pos) & 3U) != DMA_CTRL_INC_NONE) {
+          info->src_addr += info->chunk << ((info->control >> DMA_CTRL_SRC_INC_Pos) & 3U);
+        }
+        if (((info->control >> DMA_CTRL_DST_INC_Pos) & 3U) != DMA_CTRL_INC_NONE) {
+          info->dst_addr += info->chunk << ((info->control >> DMA_CTRL_DST_INC_Pos) & 3U);
+        }
+        DMA_LoadChunk(ch, info);
+        pADI_DMA->DMAENSET = mask;
+        if ((info->control & DMA_CTRL_CYCLE_Msk) == DMA_CTRL_CYCLE_AUTO) {
+          pADI_DMA->DMASWREQ = mask;
+        }
+        return;
+      }
+      event = DMA_EVENT_COMPLETE;
+      break;
+
+    case DMA_CTRL_CYCLE_PINGPONG:
+      // Controller has switched to the other descriptor
+      if (pADI_DMA->DMAALTSET & mask) {
+        event = DMA_EVENT_COMPLETE | DMA_EVENT_PRIMARY;
+      } else {
+        event = DMA_EVENT_COMPLETE | DMA_EVENT_ALTERNATE;
+      }
+      break;
+
+    default:
+      info->done = info->size;
+      event = DMA_EVENT_COMPLETE;
+      break;
+  }
+
+  if (info->cb_event != NULL) {
+    info->cb_event(event);
+  }
+}
+
 /*******************************************************************************
  *  function implementations (scope: module-exported)
  ******************************************************************************/
@@ -63,7 +230,37 @@
  */
 int32_t DMA_Initialize(void)
 {
+  uint8_t ch;
+
+  if (DMA_RefCount++ != 0U) {
+    // Already initialized by another driver
+    return 0;
+  }
+
+  pADI_DMA->DMACFG     = 0U;
+  pADI_DMA->DMAENCLR   = DMA_CHANNEL_MASK;
+  pADI_DMA->DMARMSKCLR = DMA_CHANNEL_MASK;
+  pADI_DMA->DMAALTCLR  = DMA_CHANNEL_MASK;
+  pADI_DMA->DMAPRICLR  = DMA_CHANNEL_MASK;
+  pADI_DMA->DMABSCLR   = DMA_CHANNEL_MASK;
+  pADI_DMA->DMAERRCLR  = DMA_CHANNEL_MASK;
+
+  for (ch = 0U; ch < (2U * DMA_CCD_ENTRIES); ch++) {
+    DMA_CCD[ch].control = DMA_CTRL_CYCLE_STOP;
+  }
+  for (ch = 0U; ch < DMA_CHANNEL_NUMBER; ch++) {
+    DMA_Info[ch].cb_event = NULL;
+    DMA_Info[ch].control  = DMA_CTRL_CYCLE_STOP;
+  }
+
+  pADI_DMA->DMAPDBPTR = (uint32_t)&DMA_CCD[0];
+
+  NVIC_ClearPendingIRQ(DMA_ERR_IRQn);
+  NVIC_Enable_IRQ(DMA_ERR_IRQn, HAL_DMA_INT_PRIO);
 
+  pADI_DMA->DMACFG = DMACFG_MENABLE;
+
+  return 0;
 }
 
 /**
@@ -73,11 +270,31 @@ int32_t DMA_Initialize(void)
  */
 int32_t DMA_Uninitialize(void)
 {
+  uint8_t ch;
+
+  if (DMA_RefCount == 0U) {
+    return -1;
+  }
+
+  if (--DMA_RefCount != 0U) {
+    // Still used by another driver
+    return 0;
+  }
+
+  pADI_DMA->DMAENCLR = DMA_CHANNEL_MASK;
+  pADI_DMA->DMACFG   = 0U;
 
+  NVIC_Disable_IRQ(DMA_ERR_IRQn);
+  for (ch = 0U; ch < DMA_CHANNEL_NUMBER; ch++) {
+    NVIC_Disable_IRQ((IRQn_Type)(DMA_SPI0_TX_IRQn + ch));
+  }
+
+  return 0;
 }
 
 /**
- * @brief       Selects DMA requests
+ * @brief       Selects DMA requests. DMA requests are hard-wired to the
+ *              channels on ADuCM320, the call only validates arguments.
  * @param[in]   peri  DMA peripheral (0..13)
  * @param[in]   sel   Selects the DMA request for DMA input (0..3)
  * @returns     -  0: function succeeded
@@ -85,17 +302,23 @@ int32_t DMA_Uninitialize(void)
  */
 int32_t DMA_PeripheralSelect(uint8_t peri, uint8_t sel)
 {
+  if ((peri >= DMA_CHANNEL_NUMBER) || (sel > 3U)) {
+    return -1;
+  }
 
+  return 0;
 }
 
 /**
- * @brief       Configure DMA channel for next transfer
- * @param[in]   ch        Channel number (0..7)
+ * @brief       Configure DMA channel for next transfer (primary descriptor).
+ *              Basic and auto-request transfers longer than DMA_MAX_TRANSFER
+ *              items are split and re-armed by the driver.
+ * @param[in]   ch        Channel number (0..13)
  * @param[in]   src_addr  Source address
  * @param[in]   dest_addr Destination address
  * @param[in]   size      Amount of data to transfer
- * @param[in]   control   Channel control
- * @param[in]   config    Channel configuration
+ * @param[in]   control   Channel control (DMA_CTRL_...)
+ * @param[in]   config    Channel configuration (DMA_CFG_...)
  * @param[in]   cb_event  Channel callback pointer
  * @returns     -  0: function succeeded
  *              - -1: function failed
@@ -103,51 +326,275 @@ int32_t DMA_PeripheralSelect(uint8_t peri, uint8_t sel)
 int32_t DMA_ChannelConfigure(uint8_t ch, uint32_t src_addr, uint32_t dest_addr,
     uint32_t size, uint32_t control, uint32_t config, DMA_SignalEvent_t cb_event)
 {
+  DMA_INFO_t *info;
+  uint32_t cycle = control & DMA_CTRL_CYCLE_Msk;
+
+  if ((ch >= DMA_CHANNEL_NUMBER) || (size == 0U) || (cycle == DMA_CTRL_CYCLE_STOP)) {
+    return -1;
+  }
+
+  if ((size > DMA_MAX_TRANSFER) &&
+      (cycle != DMA_CTRL_CYCLE_BASIC) && (cycle != DMA_CTRL_CYCLE_AUTO)) {
+    return -1;
+  }
+
+  if (pADI_DMA->DMAENSET & (1UL << ch)) {
+    // Channel busy
+    return -1;
+  }
+
+  info = &DMA_Info[ch];
+  info->src_addr = src_addr;
+  info->dst_addr = dest_addr;
+  info->control  = control;
+  info->size     = size;
+  info->done     = 0U;
+
+  DMA_LoadChunk(ch, info);
+  DMA_SetConfig(ch, config, cb_event);
+
+  return 0;
+}
+
+/**
+ * @brief       Load primary or alternate descriptor of a channel. Used to set
+ *              up and refill ping-pong buffers, also from the DMA callback.
+ * @param[in]   ch        Channel number (0..13)
+ * @param[in]   alternate Select alternate (true) or primary (false) descriptor
+ * @param[in]   src_addr  Source address
+ * @param[in]   dest_addr Destination address
+ * @param[in]   size      Amount of data to transfer (1..DMA_MAX_TRANSFER)
+ * @param[in]   control   Channel control (DMA_CTRL_...)
+ * @returns     -  0: function succeeded
+ *              - -1: function failed
+ */
+int32_t DMA_ChannelSetBuffer(uint8_t ch, bool alternate, uint32_t src_addr,
+    uint32_t dest_addr, uint32_t size, uint32_t control)
+{
+  if ((ch >= DMA_CHANNEL_NUMBER) || (size == 0U) || (size > DMA_MAX_TRANSFER)) {
+    return -1;
+  }
+
+  if (alternate) {
+    DMA_LoadDescriptor(&DMA_CCD[DMA_CCD_ENTRIES + ch], src_addr, dest_addr, size, control);
+  } else {
+    DMA_LoadDescriptor(&DMA_CCD[ch], src_addr, dest_addr, size, control);
+  }
+
+  return 0;
+}
+
+/**
+ * @brief       Fill scatter-gather task descriptor
+ * @param[out]  desc      Pointer to task descriptor
+ * @param[in]   src_addr  Source address
+ * @param[in]   dest_addr Destination address
+ * @param[in]   size      Amount of data to transfer (1..DMA_MAX_TRANSFER)
+ * @param[in]   control   Channel control (DMA_CTRL_..., cycle type is ignored)
+ * @returns     -  0: function succeeded
+ *              - -1: function failed
+ */
+int32_t DMA_DescriptorSet(DMA_DESCRIPTOR_t *desc, uint32_t src_addr,
+    uint32_t dest_addr, uint32_t size, uint32_t control)
+{
+  if ((desc == NULL) || (size == 0U) || (size > DMA_MAX_TRANSFER)) {
+    return -1;
+  }
+
+  DMA_LoadDescriptor(desc, src_addr, dest_addr, size, control & ~DMA_CTRL_CYCLE_Msk);
+  desc->reserved = 0U;
+
+  return 0;
+}
+
+/**
+ * @brief       Configure DMA channel for peripheral scatter-gather transfer.
+ *              Task list must stay valid until the transfer is complete.
+ * @param[in]   ch        Channel number (0..13)
+ * @param[in]   task      Pointer to task descriptor list
+ * @param[in]   num       Number of tasks (1..256)
+ * @param[in]   config    Channel configuration (DMA_CFG_...)
+ * @param[in]   cb_event  Channel callback pointer
+ * @returns     -  0: function succeeded
+ *              - -1: function failed
+ */
+int32_t DMA_ChannelConfigureSG(uint8_t ch, DMA_DESCRIPTOR_t *task, uint32_t num,
+    uint32_t config, DMA_SignalEvent_t cb_event)
+{
+  DMA_INFO_t *info;
+  uint32_t i, size;
+
+  if ((ch >= DMA_CHANNEL_NUMBER) || (task == NULL) ||
+      (num == 0U) || (num > (DMA_MAX_TRANSFER / 4U))) {
+    return -1;
+  }
+
+  if (pADI_DMA->DMAENSET & (1UL << ch)) {
+    // Channel busy
+    return -1;
+  }
 
+  // All tasks but the last one continue the scatter-gather cycle
+  size = 0U;
+  for (i = 0U; i < num; i++) {
+    task[i].control &= ~DMA_CTRL_CYCLE_Msk;
+    if (i < (num - 1U)) {
+      task[i].control |= DMA_CTRL_CYCLE_PER_SG_ALT;
+    } else {
+      task[i].control |= DMA_CTRL_CYCLE_BASIC;
+    }
+    size += ((task[i].control & DMA_CTRL_N_MINUS_1_Msk) >> DMA_CTRL_N_MINUS_1_Pos) + 1U;
+  }
+
+  // Primary descriptor copies the tasks into the alternate descriptor
+  DMA_CCD[ch].src_end = (uint32_t)&task[num - 1U].reserved;
+  DMA_CCD[ch].dst_end = (uint32_t)&DMA_CCD[DMA_CCD_ENTRIES + ch].reserved;
+  DMA_CCD[ch].control = DMA_CTRL_DST_INC_WORD | DMA_CTRL_DST_SIZE_WORD |
+                        DMA_CTRL_SRC_INC_WORD | DMA_CTRL_SRC_SIZE_WORD |
+                        DMA_CTRL_R_POWER(2)   |
+                        (((4U * num) - 1U) << DMA_CTRL_N_MINUS_1_Pos) |
+                        DMA_CTRL_CYCLE_PER_SG_PRI;
+
+  info = &DMA_Info[ch];
+  info->control = DMA_CTRL_CYCLE_PER_SG_PRI;
+  info->size    = size;
+  info->done    = 0U;
+  info->chunk   = size;
+
+  DMA_SetConfig(ch, config, cb_event);
+
+  return 0;
 }
 
 /**
  * @brief       Enable DMA channel
- * @param[in]   ch    Channel number (0..7)
+ * @param[in]   ch    Channel number (0..13)
  * @returns     -  0: function succeeded
  *              - -1: function failed
  */
 int32_t DMA_ChannelEnable(uint8_t ch)
 {
+  uint32_t mask;
+
+  if (ch >= DMA_CHANNEL_NUMBER) {
+    return -1;
+  }
+
+  mask = (1UL << ch);
+  pADI_DMA->DMARMSKCLR = mask;
+  pADI_DMA->DMAENSET   = mask;
+
+  if ((DMA_Info[ch].control & DMA_CTRL_CYCLE_Msk) == DMA_CTRL_CYCLE_AUTO) {
+    // Memory transfer is started by software request
+    pADI_DMA->DMASWREQ = mask;
+  }
 
+  return 0;
 }
 
 /**
  * @brief       Disable DMA channel
- * @param[in]   ch    Channel number (0..7)
+ * @param[in]   ch    Channel number (0..13)
  * @returns     -  0: function succeeded
  *              - -1: function failed
  */
 int32_t DMA_ChannelDisable(uint8_t ch)
 {
+  if (ch >= DMA_CHANNEL_NUMBER) {
+    return -1;
+  }
 
+  pADI_DMA->DMAENCLR = (1UL << ch);
+
+  return 0;
 }
 
 /**
  * @brief       Check if DMA channel is enabled or disabled
- * @param[in]   ch    Channel number (0..7)
+ * @param[in]   ch    Channel number (0..13)
  * @returns     Channel status
  *              - 1: channel enabled
  *              - 0: channel disabled
  */
 uint32_t DMA_ChannelGetStatus(uint8_t ch)
 {
+  if (ch >= DMA_CHANNEL_NUMBER) {
+    return 0U;
+  }
 
+  return ((pADI_DMA->DMAENSET >> ch) & 1U);
 }
 
 /**
  * @brief       Get number of transferred data
- * @param[in]   ch    Channel number (0..7)
+ * @param[in]   ch    Channel number (0..13)
  * @returns     Number of transferred data
  */
 uint32_t DMA_ChannelGetCount(uint8_t ch)
 {
+  DMA_INFO_t *info;
+  uint32_t control;
+
+  if (ch >= DMA_CHANNEL_NUMBER) {
+    return 0U;
+  }
+
+  info = &DMA_Info[ch];
+
+  switch (info->control & DMA_CTRL_CYCLE_Msk) {
+    case DMA_CTRL_CYCLE_BASIC:
+    case DMA_CTRL_CYCLE_AUTO:
+    case DMA_CTRL_CYCLE_PINGPONG:
+      // n_minus_1 is written back by the controller after each arbitration
+      control = DMA_CCD[ch].control;
+      if ((control & DMA_CTRL_CYCLE_Msk) == DMA_CTRL_CYCLE_STOP) {
+        return (info->done + info->chunk);
+      }
+      return (info->done + info->chunk -
+              (((control & DMA_CTRL_N_MINUS_1_Msk) >> DMA_CTRL_N_MINUS_1_Pos) + 1U));
+
+    default:
+      return info->done;
+  }
+}
+
+/**
+ * @brief DMA error interrupt handler
+ */
+void DMA_Err_Int_Handler(void)
+{
+  uint32_t err;
+  uint8_t ch;
+
+  err = pADI_DMA->DMAERRCLR & DMA_CHANNEL_MASK;
+  pADI_DMA->DMAERRCLR = err;
 
+  for (ch = 0U; ch < DMA_CHANNEL_NUMBER; ch++) {
+    if (err & (1UL << ch)) {
+      pADI_DMA->DMAENCLR = (1UL << ch);
+      if (DMA_Info[ch].cb_event != NULL) {
+        DMA_Info[ch].cb_event(DMA_EVENT_ERROR);
+      }
+    }
+  }
 }
 
+/**
+ * @brief DMA channel interrupt handlers
+ */
+void DMA_SPI0_TX_Int_Handler(void)  { DMA_IRQHandler(DMA_CH_SPI0_TX);  }
+void DMA_SPI0_RX_Int_Handler(void)  { DMA_IRQHandler(DMA_CH_SPI0_RX);  }
+void DMA_SPI1_TX_Int_Handler(void)  { DMA_IRQHandler(DMA_CH_SPI1_TX);  }
+void DMA_SPI1_RX_Int_Handler(void)  { DMA_IRQHandler(DMA_CH_SPI1_RX);  }
+void DMA_UART_TX_Int_Handler(void)  { DMA_IRQHandler(DMA_CH_UART_TX);  }
+void DMA_UART_RX_Int_Handler(void)  { DMA_IRQHandler(DMA_CH_UART_RX);  }
+void DMA_I2C0_STX_Int_Handler(void) { DMA_IRQHandler(DMA_CH_I2C0_STX); }
+void DMA_I2C0_SRX_Int_Handler(void) { DMA_IRQHandler(DMA_CH_I2C0_SRX); }
+void DMA_I2C0_M_Int_Handler(void)   { DMA_IRQHandler(DMA_CH_I2C0_M);   }
+void DMA_I2C1_STX_Int_Handler(void) { DMA_IRQHandler(DMA_CH_I2C1_STX); }
+void DMA_I2C1_SRX_Int_Handler(void) { DMA_IRQHandler(DMA_CH_I2C1_SRX); }
+void DMA_I2C1_M_Int_Handler(void)   { DMA_IRQHandler(DMA_CH_I2C1_M);   }
+void DMA_ADC_Int_Handler(void)      { DMA_IRQHandler(DMA_CH_ADC);      }
+void DMA_Flsh_Int_Handler(void)     { DMA_IRQHandler(DMA_CH_FLASH);    }
+
 /* ----------------------------- End of file ---------------------------------*/
@@ -25,11 +25,75 @@
  ******************************************************************************/
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /*******************************************************************************
  *  defines and macros
  ******************************************************************************/
 
+// DMA channels (requests are hard-wired to the peripherals)
+#define DMA_CH_SPI0_TX                  0U
+#define DMA_CH_SPI0_RX                  1U
+#define DMA_CH_SPI1_TX                  2U
+#define DMA_CH_SPI1_RX                  3U
+#define DMA_CH_UART_TX                  4U
+#define DMA_CH_UART_RX                  5U
+#define DMA_CH_I2C0_STX                 6U
+#define DMA_CH_I2C0_SRX                 7U
+#define DMA_CH_I2C0_M                   8U
+#define DMA_CH_I2C1_STX                 9U
+#define DMA_CH_I2C1_SRX                 10U
+#define DMA_CH_I2C1_M                   11U
+#define DMA_CH_ADC                      12U
+#define DMA_CH_FLASH                    13U
+#define DMA_CHANNEL_NUMBER              14U
+
+// Maximum number of data items per descriptor
+#define DMA_MAX_TRANSFER                1024U
+
+// Channel control: cycle type
+#define DMA_CTRL_CYCLE_STOP             (0UL << 0)
+#define DMA_CTRL_CYCLE_BASIC            (1UL << 0)
+#define DMA_CTRL_CYCLE_AUTO             (2UL << 0)
+#define DMA_CTRL_CYCLE_PINGPONG         (3UL << 0)
+#define DMA_CTRL_CYCLE_MEM_SG_PRI       (4UL << 0)
+#define DMA_CTRL_CYCLE_MEM_SG_ALT       (5UL << 0)
+#define DMA_CTRL_CYCLE_PER_SG_PRI       (6UL << 0)
+#define DMA_CTRL_CYCLE_PER_SG_ALT       (7UL << 0)
+#define DMA_CTRL_CYCLE_Msk              (7UL << 0)
+
+// Channel control: burst and arbitration
+#define DMA_CTRL_NEXT_USEBURST          (1UL << 3)
+#define DMA_CTRL_N_MINUS_1_Pos          4U
+#define DMA_CTRL_N_MINUS_1_Msk          (0x3FFUL << DMA_CTRL_N_MINUS_1_Pos)
+#define DMA_CTRL_R_POWER(n)             (((uint32_t)(n) & 0xFUL) << 14)
+
+// Channel control: data size and address increment
+#define DMA_CTRL_SRC_SIZE_BYTE          (0UL << 24)
+#define DMA_CTRL_SRC_SIZE_HALFWORD      (1UL << 24)
+#define DMA_CTRL_SRC_SIZE_WORD          (2UL << 24)
+#define DMA_CTRL_SRC_INC_BYTE           (0UL << 26)
+#define DMA_CTRL_SRC_INC_HALFWORD       (1UL << 26)
+#define DMA_CTRL_SRC_INC_WORD           (2UL << 26)
+#define DMA_CTRL_SRC_INC_NONE           (3UL << 26)
+#define DMA_CTRL_DST_SIZE_BYTE          (0UL << 28)
+#define DMA_CTRL_DST_SIZE_HALFWORD      (1UL << 28)
+#define DMA_CTRL_DST_SIZE_WORD          (2UL << 28)
+#define DMA_CTRL_DST_INC_BYTE           (0UL << 30)
+#define DMA_CTRL_DST_INC_HALFWORD       (1UL << 30)
+#define DMA_CTRL_DST_INC_WORD           (2UL << 30)
+#define DMA_CTRL_DST_INC_NONE           (3UL << 30)
+
+// Channel configuration
+#define DMA_CFG_PRIORITY_HIGH           (1UL << 0)
+#define DMA_CFG_BYTE_SWAP               (1UL << 1)
+
+// DMA events
+#define DMA_EVENT_COMPLETE              (1UL << 0)  // Transfer complete
+#define DMA_EVENT_PRIMARY               (1UL << 1)  // Primary descriptor done
+#define DMA_EVENT_ALTERNATE             (1UL << 2)  // Alternate descriptor done
+#define DMA_EVENT_ERROR                 (1UL << 3)  // Bus error
+
 /*******************************************************************************
  *  typedefs and structures
  ******************************************************************************/
@@ -41,6 +105,14 @@
  */
 typedef void (*DMA_SignalEvent_t)(uint32_t event);
 
+// DMA channel control data structure (descriptor)
+typedef struct _DMA_DESCRIPTOR {
+  volatile uint32_t       src_end;       // Source end pointer
+  volatile uint32_t       dst_end;       // Destination end pointer
+  volatile uint32_t       control;       // Channel control
+  uint32_t                reserved;      // Unused
+} DMA_DESCRIPTOR_t;
+
 /*******************************************************************************
  *  exported variables
  ******************************************************************************/
@@ -66,7 +138,8 @@ extern
 int32_t DMA_Uninitialize(void);
 
 /**
- * @brief       Selects DMA requests
+ * @brief       Selects DMA requests. DMA requests are hard-wired to the
+ *              channels on ADuCM320, the call only validates arguments.
  * @param[in]   peri  DMA peripheral (0..13)
  * @param[in]   sel   Selects the DMA request for DMA input (0..3)
  * @returns     -  0: function succeeded
@@ -76,13 +149,15 @@ extern
 int32_t DMA_PeripheralSelect(uint8_t peri, uint8_t sel);
 
 /**
- * @brief       Configure DMA channel for next transfer
- * @param[in]   ch        Channel number (0..7)
+ * @brief       Configure DMA channel for next transfer (primary descriptor).
+ *              Basic and auto-request transfers longer than DMA_MAX_TRANSFER
+ *              items are split and re-armed by the driver.
+ * @param[in]   ch        Channel number (0..13)
  * @param[in]   src_addr  Source address
  * @param[in]   dest_addr Destination address
  * @param[in]   size      Amount of data to transfer
- * @param[in]   control   Channel control
- * @param[in]   config    Channel configuration
+ * @param[in]   control   Channel control (DMA_CTRL_...)
+ * @param[in]   config    Channel configuration (DMA_CFG_...)
  * @param[in]   cb_event  Channel callback pointer
  * @returns     -  0: function succeeded
  *              - -1: function failed
@@ -93,16 +168,61 @@ int32_t DMA_ChannelConfigure(uint8_t ch, uint32_t src_addr, uint32_t dest_addr,
 
 /**
  * @brief       Enable DMA channel
- * @param[in]   ch    Channel number (0..7)
+ * @param[in]   ch    Channel number (0..13)
  * @returns     -  0: function succeeded
  *              - -1: function failed
  */
 extern
 int32_t DMA_ChannelEnable(uint8_t ch);
 
+/**
+ * @brief       Load primary or alternate descriptor of a channel. Used to set
+ *              up and refill ping-pong buffers, also from the DMA callback.
+ * @param[in]   ch        Channel number (0..13)
+ * @param[in]   alternate Select alternate (true) or primary (false) descriptor
+ * @param[in]   src_addr  Source address
+ * @param[in]   dest_addr Destination address
+ * @param[in]   size      Amount of data to transfer (1..DMA_MAX_TRANSFER)
+ * @param[in]   control   Channel control (DMA_CTRL_...)
+ * @returns     -  0: function succeeded
+ *              - -1: function failed
+ */
+extern
+int32_t DMA_ChannelSetBuffer(uint8_t ch, bool alternate, uint32_t src_addr,
+    uint32_t dest_addr, uint32_t size, uint32_t control);
+
+/**
+ * @brief       Fill scatter-gather task descriptor
+ * @param[out]  desc      Pointer to task descriptor
+ * @param[in]   src_addr  Source address
+ * @param[in]   dest_addr Destination address
+ * @param[in]   size      Amount of data to transfer (1..DMA_MAX_TRANSFER)
+ * @param[in]   control   Channel control (DMA_CTRL_..., cycle type is ignored)
+ * @returns     -  0: function succeeded
+ *              - -1: function failed
+ */
+extern
+int32_t DMA_DescriptorSet(DMA_DESCRIPTOR_t *desc, uint32_t src_addr,
+    uint32_t dest_addr, uint32_t size, uint32_t control);
+
+/**
+ * @brief       Configure DMA channel for peripheral scatter-gather transfer.
+ *              Task list must stay valid until the transfer is complete.
+ * @param[in]   ch        Channel number (0..13)
+ * @param[in]   task      Pointer to task descriptor list
+ * @param[in]   num       Number of tasks (1..256)
+ * @param[in]   config    Channel configuration (DMA_CFG_...)
+ * @param[in]   cb_event  Channel callback pointer
+ * @returns     -  0: function succeeded
+ *              - -1: function failed
+ */
+extern
+int32_t DMA_ChannelConfigureSG(uint8_t ch, DMA_DESCRIPTOR_t *task, uint32_t num,
+    uint32_t config, DMA_SignalEvent_t cb_event);
+
 /**
  * @brief       Disable DMA channel
- * @param[in]   ch    Channel number (0..7)
+ * @param[in]   ch    Channel number (0..13)
  * @returns     -  0: function succeeded
  *              - -1: function failed
  */
@@ -111,7 +231,7 @@ int32_t DMA_ChannelDisable(uint8_t ch);
 
 /**
  * @brief       Check if DMA channel is enabled or disabled
- * @param[in]   ch    Channel number (0..7)
+ * @param[in]   ch    Channel number (0..13)
  * @returns     Channel status
  *              - 1: channel enabled
  *              - 0: channel disabled
@@ -121,7 +241,7 @@ uint32_t DMA_ChannelGetStatus(uint8_t ch);
 
 /**
  * @brief       Get number of transferred data
- * @param[in]   ch    Channel number (0..7)
+ * @param[in]   ch    Channel number (0..13)
  * @returns     Number of transferred data
  */
 extern
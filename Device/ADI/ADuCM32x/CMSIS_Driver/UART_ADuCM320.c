@@ -21,6 +21,8 @@
  *  includes
  ******************************************************************************/
 
+#include <string.h>
+
 #include "CLK_ADuCM320.h"
 #include "UART_ADuCM320.h"
 
@@ -64,6 +66,19 @@ static const GPIO_PIN_ID_t USART0_pin_rx = {
 
 static USART_INFO_t USART0_Info;
 
+#if defined(USART0_RX_FIFO_SIZE)
+static uint8_t USART0_RxFifoBuf[USART0_RX_FIFO_SIZE];
+static uint8_t USART0_TxFifoBuf[USART0_TX_FIFO_SIZE];
+
+static USART_FIFO_t USART0_RxFifo = {
+    USART0_RxFifoBuf, USART0_RX_FIFO_SIZE, 0U, 0U
+};
+
+static USART_FIFO_t USART0_TxFifo = {
+    USART0_TxFifoBuf, USART0_TX_FIFO_SIZE, 0U, 0U
+};
+#endif
+
 static const USART_RESOURCES_t USART0_Resources = {
     {   // Capabilities
         1,    ///< supports UART (Asynchronous) mode
@@ -96,6 +111,13 @@ static const USART_RESOURCES_t USART0_Resources = {
     UART_IRQn,
     NULL,
     NULL,
+#if defined(USART0_RX_FIFO_SIZE)
+    &USART0_RxFifo,
+    &USART0_TxFifo,
+#else
+    NULL,
+    NULL,
+#endif
     &USART0_Info
 };
 
@@ -109,6 +131,81 @@ static const USART_RESOURCES_t USART0_Resources = {
  *  function implementations (scope: module-local)
  ******************************************************************************/
 
+/**
+ * @brief       Get number of bytes stored in FIFO.
+ * @param[in]   fifo  Pointer to FIFO
+ * @returns     Number of bytes stored
+ */
+__STATIC_INLINE
+uint32_t USART_FifoCount(USART_FIFO_t *fifo)
+{
+  return (fifo->head - fifo->tail);
+}
+
+/**
+ * @brief       Copy data into FIFO. Called by the producer only.
+ * @param[in]   fifo  Pointer to FIFO
+ * @param[in]   data  Pointer to data to store
+ * @param[in]   num   Number of bytes to store
+ * @returns     Number of bytes stored
+ */
+static
+uint32_t USART_FifoPut(USART_FIFO_t *fifo, const uint8_t *data, uint32_t num)
+{
+  uint32_t head = fifo->head;
+  uint32_t idx, n;
+
+  n = fifo->size - (head - fifo->tail);
+  if (num > n)
+    num = n;
+
+  idx = head & (fifo->size - 1U);
+  n = fifo->size - idx;
+  if (n > num)
+    n = num;
+
+  memcpy(&fifo->buf[idx], data, n);
+  memcpy(&fifo->buf[0], &data[n], num - n);
+
+  // Data must be visible before the write index moves
+  __DMB();
+  fifo->head = head + num;
+
+  return num;
+}
+
+/**
+ * @brief       Copy data out of FIFO. Called by the consumer only.
+ * @param[in]   fifo  Pointer to FIFO
+ * @param[out]  data  Pointer to buffer for data
+ * @param[in]   num   Number of bytes to fetch
+ * @returns     Number of bytes fetched
+ */
+static
+uint32_t USART_FifoGet(USART_FIFO_t *fifo, uint8_t *data, uint32_t num)
+{
+  uint32_t tail = fifo->tail;
+  uint32_t idx, n;
+
+  n = fifo->head - tail;
+  if (num > n)
+    num = n;
+
+  idx = tail & (fifo->size - 1U);
+  n = fifo->size - idx;
+  if (n > num)
+    n = num;
+
+  memcpy(data, &fifo->buf[idx], n);
+  memcpy(&data[n], &fifo->buf[0], num - n);
+
+  // Data must be copied out before the slots are released
+  __DMB();
+  fifo->tail = tail + num;
+
+  return num;
+}
+
 /**
  * @brief       Set baudrate dividers
  * @param[in]   baudrate  Usart baudrate
@@ -283,6 +380,12 @@ int32_t USART_PowerControl(ARM_POWER_STATE state, USART_RESOURCES_t *usart)
       usart->info->rx_status.rx_parity_error  = 0U;
       usart->info->xfer.send_active           = 0U;
 
+      // Flush software FIFOs
+      if (usart->rx_fifo != NULL) {
+        usart->rx_fifo->head = usart->rx_fifo->tail = 0U;
+        usart->tx_fifo->head = usart->tx_fifo->tail = 0U;
+      }
+
       usart->info->flags &= ~USART_FLAG_POWERED;
       break;
 
@@ -312,6 +415,12 @@ int32_t USART_PowerControl(ARM_POWER_STATE state, USART_RESOURCES_t *usart)
       usart->info->flags                      = 0U;
       usart->info->xfer.send_active           = 0U;
 
+      // Flush software FIFOs
+      if (usart->rx_fifo != NULL) {
+        usart->rx_fifo->head = usart->rx_fifo->tail = 0U;
+        usart->tx_fifo->head = usart->tx_fifo->tail = 0U;
+      }
+
       usart->info->flags = USART_FLAG_POWERED | USART_FLAG_INITIALIZED;
 
       // Clear and Enable USART IRQ
@@ -351,6 +460,11 @@ int32_t USART_Send(const void *data, uint32_t num, USART_RESOURCES_t *usart)
     return ARM_DRIVER_ERROR_BUSY;
   }
 
+  if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U)) {
+    // Data queued by Write is not transmitted yet
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
   // Set Send active flag
   usart->info->xfer.send_active = 1U;
 
@@ -394,9 +508,6 @@ int32_t USART_Receive(void *data, uint32_t num, USART_RESOURCES_t *usart)
     return ARM_DRIVER_ERROR_BUSY;
   }
 
-  // Set RX busy flag
-  usart->info->rx_status.rx_busy = 1U;
-
   // Clear RX statuses
   usart->info->rx_status.rx_break          = 0U;
   usart->info->rx_status.rx_framing_error  = 0U;
@@ -408,6 +519,24 @@ int32_t USART_Receive(void *data, uint32_t num, USART_RESOURCES_t *usart)
   usart->info->xfer.rx_num = num;
   usart->info->xfer.rx_cnt = 0U;
 
+  if (usart->rx_fifo != NULL) {
+    // Keep receive interrupt off while FIFO content is handed over
+    usart->reg->COMIEN &= ~COMIEN_ERBFI;
+
+    usart->info->xfer.rx_cnt = USART_FifoGet(usart->rx_fifo, usart->info->xfer.rx_buf, num);
+
+    if (usart->info->xfer.rx_cnt == num) {
+      // Request completely served from FIFO
+      usart->reg->COMIEN |= COMIEN_ERBFI;
+      if (usart->info->cb_event != NULL)
+        usart->info->cb_event(ARM_USART_EVENT_RECEIVE_COMPLETE);
+      return ARM_DRIVER_OK;
+    }
+  }
+
+  // Set RX busy flag
+  usart->info->rx_status.rx_busy = 1U;
+
   // Enable receive data available interrupt
   usart->reg->COMIEN |= COMIEN_ERBFI;
 
@@ -513,10 +642,13 @@ int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES_t *usart)
         GPIO_AFConfig(pins->rx->port, pins->rx->pin, pins->rx->func);
         usart->info->flags |= USART_FLAG_RX_ENABLED;
         usart->reg->COMIEN |= COMIEN_ELSI;
+        // Buffered mode collects data even without active receive
+        if (usart->rx_fifo != NULL)
+          usart->reg->COMIEN |= COMIEN_ERBFI;
       }
       else {
         usart->info->flags &= ~USART_FLAG_RX_ENABLED;
-        usart->reg->COMIEN &= ~COMIEN_ELSI;
+        usart->reg->COMIEN &= ~(COMIEN_ELSI | COMIEN_ERBFI);
         GPIO_AFConfig(pins->rx->port, pins->rx->pin, GPIO_PIN_FUNC_0);
       }
       return ARM_DRIVER_OK;
@@ -535,6 +667,9 @@ int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES_t *usart)
         usart->reg->COMLCR &= ~COMLCR_BRK_EN;
         // Clear Send active flag
         usart->info->xfer.send_active = 0U;
+        // Resume transmission of data queued by Write
+        if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U))
+          usart->reg->COMIEN |= COMIEN_ETBEI;
       }
       return ARM_DRIVER_OK;
 
@@ -548,6 +683,10 @@ int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES_t *usart)
         DMA_ChannelDisable(usart->dma_tx->channel);
       }
 
+      // Discard data queued by Write
+      if (usart->tx_fifo != NULL)
+        usart->tx_fifo->tail = usart->tx_fifo->head;
+
       // Clear Send active flag
       usart->info->xfer.send_active = 0U;
       return ARM_DRIVER_OK;
@@ -564,6 +703,10 @@ int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES_t *usart)
 
       // Clear RX busy status
       usart->info->rx_status.rx_busy = 0U;
+
+      // Buffered mode collects data even without active receive
+      if ((usart->rx_fifo != NULL) && (usart->info->flags & USART_FLAG_RX_ENABLED))
+        usart->reg->COMIEN |= COMIEN_ERBFI;
       return ARM_DRIVER_OK;
 
     // Abort transfer
@@ -580,9 +723,17 @@ int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES_t *usart)
         DMA_ChannelDisable (usart->dma_rx->channel);
       }
 
+      // Discard data queued by Write
+      if (usart->tx_fifo != NULL)
+        usart->tx_fifo->tail = usart->tx_fifo->head;
+
       // Clear busy statuses
       usart->info->rx_status.rx_busy = 0U;
       usart->info->xfer.send_active  = 0U;
+
+      // Buffered mode collects data even without active receive
+      if ((usart->rx_fifo != NULL) && (usart->info->flags & USART_FLAG_RX_ENABLED))
+        usart->reg->COMIEN |= COMIEN_ERBFI;
       return ARM_DRIVER_OK;
 
     case ARM_USART_MODE_ASYNCHRONOUS:
@@ -681,6 +832,8 @@ ARM_USART_STATUS USART_GetStatus(USART_RESOURCES_t *usart)
   ARM_USART_STATUS stat;
 
   stat.tx_busy          = (usart->reg->COMLSR & COMLSR_TEMT ? (0U) : (1U));
+  if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U))
+    stat.tx_busy        = 1U;
   stat.rx_busy          = usart->info->rx_status.rx_busy;
   stat.tx_underflow     = 0U;
   stat.rx_overflow      = usart->info->rx_status.rx_overflow;
@@ -721,6 +874,67 @@ ARM_USART_MODEM_STATUS USART_GetModemStatus(USART_RESOURCES_t *uart)
   return modem_status;
 }
 
+/**
+ * @brief       Read data collected in the receive FIFO without blocking.
+ * @param[out]  data  Pointer to buffer for data read from FIFO
+ * @param[in]   num   Maximum number of data items to read
+ * @param[in]   usart Pointer to USART resources
+ * @return      Number of data items read (0 when FIFO is empty) or Execution_status on error
+ */
+static
+int32_t USART_Read(void *data, uint32_t num, USART_RESOURCES_t *usart)
+{
+  if ((data == NULL) || (num == 0U)) {
+    // Invalid parameters
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((usart->info->flags & USART_FLAG_CONFIGURED) == 0U) {
+    // USART is not configured (mode not selected)
+    return ARM_DRIVER_ERROR;
+  }
+
+  return (int32_t)USART_FifoGet(usart->rx_fifo, (uint8_t *)data, num);
+}
+
+/**
+ * @brief       Queue data into the transmit FIFO without blocking.
+ * @param[in]   data  Pointer to buffer with data to write into FIFO
+ * @param[in]   num   Maximum number of data items to write
+ * @param[in]   usart Pointer to USART resources
+ * @return      Number of data items queued (0 when FIFO is full) or Execution_status on error
+ */
+static
+int32_t USART_Write(const void *data, uint32_t num, USART_RESOURCES_t *usart)
+{
+  uint8_t val;
+
+  if ((data == NULL) || (num == 0U)) {
+    // Invalid parameters
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((usart->info->flags & USART_FLAG_CONFIGURED) == 0U) {
+    // USART is not configured (mode not selected)
+    return ARM_DRIVER_ERROR;
+  }
+
+  num = USART_FifoPut(usart->tx_fifo, (const uint8_t *)data, num);
+
+  // Start transmitter unless Send or FIFO drain already owns it
+  if ((num != 0U) && (usart->info->xfer.send_active == 0U) &&
+      ((usart->reg->COMIEN & COMIEN_ETBEI) == 0U)) {
+    // Fill TX holding register
+    if ((usart->reg->COMLSR & COMLSR_THRE) && USART_FifoGet(usart->tx_fifo, &val, 1U))
+      usart->reg->COMTX = val;
+
+    // Enable transmit holding register empty interrupt
+    usart->reg->COMIEN |= COMIEN_ETBEI;
+  }
+
+  return (int32_t)num;
+}
+
 /**
  * @brief       USART Interrupt handler.
  * @param[in]   usart     Pointer to USART resources
@@ -731,6 +945,7 @@ void USART_IRQHandler(USART_RESOURCES_t *usart)
   uint32_t event = 0U;
   uint16_t iir = usart->reg->COMIIR;
   uint16_t lsr;
+  uint8_t data;
   volatile uint16_t msr;
 
   if ((iir & COMIIR_NIRQ) == 0U) {
@@ -742,14 +957,24 @@ void USART_IRQHandler(USART_RESOURCES_t *usart)
 
       /* Transmit buffer empty interrupt */
       case COMIIR_STA_TXBUFEMPTY:
+        if (usart->info->xfer.send_active == 0U) {
+          // Buffered mode: drain transmit FIFO
+          if ((usart->tx_fifo != NULL) && USART_FifoGet(usart->tx_fifo, &data, 1U))
+            usart->reg->COMTX = data;
+          else
+            usart->reg->COMIEN &= ~COMIEN_ETBEI;
+          break;
+        }
+
         if (usart->info->xfer.tx_num != usart->info->xfer.tx_cnt) {
           usart->reg->COMTX = usart->info->xfer.tx_buf[usart->info->xfer.tx_cnt++];
         }
 
         // Check if all data is transmitted
         if (usart->info->xfer.tx_num == usart->info->xfer.tx_cnt) {
-          // Disable THRE interrupt
-          usart->reg->COMIEN &= ~COMIEN_ETBEI;
+          // Disable THRE interrupt unless data queued by Write is pending
+          if ((usart->tx_fifo == NULL) || (USART_FifoCount(usart->tx_fifo) == 0U))
+            usart->reg->COMIEN &= ~COMIEN_ETBEI;
           // Clear TX busy flag
           usart->info->xfer.send_active = 0U;
           event |= ARM_USART_EVENT_SEND_COMPLETE;
@@ -758,12 +983,23 @@ void USART_IRQHandler(USART_RESOURCES_t *usart)
 
       /* Receive buffer full interrupt */
       case COMIIR_STA_RXBUFFULL:
+        if (usart->info->rx_status.rx_busy == 0U) {
+          // Buffered mode: store data into receive FIFO
+          data = (uint8_t)usart->reg->COMRX;
+          if ((usart->rx_fifo == NULL) || (USART_FifoPut(usart->rx_fifo, &data, 1U) == 0U)) {
+            usart->info->rx_status.rx_overflow = 1U;
+            event |= ARM_USART_EVENT_RX_OVERFLOW;
+          }
+          break;
+        }
+
         // Read data from RX buffer register into receive buffer
         usart->info->xfer.rx_buf[usart->info->xfer.rx_cnt++] = usart->reg->COMRX;
         // Check if requested amount of data is received
         if (usart->info->xfer.rx_cnt == usart->info->xfer.rx_num) {
-          // Disable RDA interrupt
-          usart->reg->COMIEN &= ~COMIEN_ERBFI;
+          // Disable RDA interrupt, buffered mode keeps collecting into FIFO
+          if (usart->rx_fifo == NULL)
+            usart->reg->COMIEN &= ~COMIEN_ERBFI;
           // Clear RX busy flag and set receive transfer complete event
           usart->info->rx_status.rx_busy = 0U;
           event |= ARM_USART_EVENT_RECEIVE_COMPLETE;
@@ -961,6 +1197,30 @@ void UART0_Int_Handler(void)
   USART_IRQHandler(&USART0_Resources);
 }
 
+#if defined(USART0_RX_FIFO_SIZE)
+/**
+ * @brief       Read data collected in the USART0 receive FIFO.
+ * @param[out]  data  Pointer to buffer for data
+ * @param[in]   num   Maximum number of data items to read
+ * @return      Number of data items read or Execution_status on error
+ */
+int32_t USART0_Read(void *data, uint32_t num)
+{
+  return USART_Read(data, num, &USART0_Resources);
+}
+
+/**
+ * @brief       Queue data into the USART0 transmit FIFO.
+ * @param[in]   data  Pointer to buffer with data
+ * @param[in]   num   Maximum number of data items to write
+ * @return      Number of data items queued or Execution_status on error
+ */
+int32_t USART0_Write(const void *data, uint32_t num)
+{
+  return USART_Write(data, num, &USART0_Resources);
+}
+#endif
+
 #endif // USE_USART0
 
 /*******************************************************************************
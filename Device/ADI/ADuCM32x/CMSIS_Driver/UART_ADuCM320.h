@@ -44,6 +44,15 @@
   #define USART0_RX_GPIO_PORT        RTE_USART0_RX_PORT
   #define USART0_RX_GPIO_PIN         RTE_USART0_RX_PIN
   #define USART0_RX_GPIO_FUNC        RTE_USART0_RX_FUNC
+
+  #if (RTE_USART0_FIFO == 1)
+    #if (((RTE_USART0_RX_FIFO_SIZE & (RTE_USART0_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_USART0_TX_FIFO_SIZE & (RTE_USART0_TX_FIFO_SIZE - 1)) != 0))
+      #error "USART0 FIFO size must be a power of two!"
+    #endif
+    #define USART0_RX_FIFO_SIZE      RTE_USART0_RX_FIFO_SIZE
+    #define USART0_TX_FIFO_SIZE      RTE_USART0_TX_FIFO_SIZE
+  #endif
 #endif
 
 // USART flags
@@ -77,6 +86,14 @@ typedef struct _USART_RX_STATUS {
   uint8_t rx_parity_error;               // Parity error detected on receive (cleared on start of next receive operation)
 } USART_RX_STATUS;
 
+// USART software FIFO (single producer, single consumer)
+typedef struct _USART_FIFO {
+  uint8_t                *buf;           // FIFO storage
+  uint32_t                size;          // FIFO size in bytes (power of two)
+  volatile uint32_t       head;          // Write index, advanced by producer only
+  volatile uint32_t       tail;          // Read index, advanced by consumer only
+} USART_FIFO_t;
+
 // USART Information (Run-Time)
 typedef struct _USART_INFO {
   ARM_USART_SignalEvent_t cb_event;      // Event callback
@@ -108,6 +125,8 @@ typedef struct {
   IRQn_Type                irq_num;       // USART IRQ Number
   USART_DMA_t             *dma_tx;
   USART_DMA_t             *dma_rx;
+  USART_FIFO_t            *rx_fifo;       // Receive FIFO (buffered mode)
+  USART_FIFO_t            *tx_fifo;       // Transmit FIFO (buffered mode)
   USART_INFO_t            *info;          // Run-Time Information
 } const USART_RESOURCES_t;
 
@@ -119,6 +138,11 @@ typedef struct {
  *  exported function prototypes
  ******************************************************************************/
 
+#if defined(USART0_RX_FIFO_SIZE)
+extern int32_t USART0_Read(void *data, uint32_t num);
+extern int32_t USART0_Write(const void *data, uint32_t num);
+#endif
+
 #endif /* UART_ADUCM320_H_ */
 
 /* ----------------------------- End of file ---------------------------------*/
@@ -69,6 +69,15 @@
 #else
   #error "Invalid I2C1_SDA Pin Configuration!"
 #endif
+//   <o> SCL/SDA rise time [ns] <0-1000>
+//   <i> Depends on bus capacitance and pull-up resistors
+#define   RTE_I2C1_RISE_TIME            100
+//   <o> SCL/SDA fall time [ns] <0-300>
+#define   RTE_I2C1_FALL_TIME            10
+//   <q> Analog noise filter
+#define   RTE_I2C1_ANALOG_FILTER        1
+//   <o> Digital noise filter [tI2CCLK] <0-15>
+#define   RTE_I2C1_DIGITAL_FILTER       0
 // </e> I2C1 (Inter-integrated Circuit Interface 1) [Driver_I2C1]
 
 // <e> I2C2 (Inter-integrated Circuit Interface 2) [Driver_I2C2]
@@ -101,6 +110,15 @@
 #else
   #error "Invalid I2C2_SDA Pin Configuration!"
 #endif
+//   <o> SCL/SDA rise time [ns] <0-1000>
+//   <i> Depends on bus capacitance and pull-up resistors
+#define   RTE_I2C2_RISE_TIME            100
+//   <o> SCL/SDA fall time [ns] <0-300>
+#define   RTE_I2C2_FALL_TIME            10
+//   <q> Analog noise filter
+#define   RTE_I2C2_ANALOG_FILTER        1
+//   <o> Digital noise filter [tI2CCLK] <0-15>
+#define   RTE_I2C2_DIGITAL_FILTER       0
 // </e> I2C2 (Inter-integrated Circuit Interface 2) [Driver_I2C2]
 
 #endif /* RTE_DEVICE_H_ */
@@ -36,15 +36,14 @@
 #define RCC_APB_I2C1_MASK     ((uint32_t)(1U << 21))
 #define RCC_APB_I2C2_MASK     ((uint32_t)(1U << 22))
 
-#define T_I2CCLK              125UL // tI2CCLK = 125 ns
-#define STD_MODE_SCLL         40UL  // 40*tI2CCLK = 5000 ns
-#define STD_MODE_SCLH         32UL  // 32*tI2CCLK = 4000 ns
-#define STD_MODE_SDADEL       4UL   // 4*tI2CCLK = 500 ns
-#define STD_MODE_SCLDEL       10UL  // 10*tI2CCLK = 1250 ns
-#define FST_MODE_SCLL         10UL  // 10*tI2CCLK = 1250 ns
-#define FST_MODE_SCLH         4UL   // 4*tI2CCLK = 500 ns
-#define FST_MODE_SDADEL       1UL   // 1*tI2CCLK = 125 ns
-#define FST_MODE_SCLDEL       4UL   // 4*tI2CCLK = 500 ns
+#define NSEC_PER_SEC          1000000000UL
+
+#define I2C_AF_DELAY_MIN      50    // Analog filter delay min, ns
+#define I2C_AF_DELAY_MAX      260   // Analog filter delay max, ns
+
+#define I2C_SPEED_STANDARD    0U    // Index into I2C_Charac and timing cache
+#define I2C_SPEED_FAST        1U
+#define I2C_SPEED_FAST_PLUS   2U
 
 #define ARM_I2C_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,0) /* driver version */
 
@@ -52,10 +51,28 @@
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
 
+/* I2C bus mode characteristics (I2C-bus specification UM10204), times in ns */
+typedef struct _I2C_CHARAC {
+  uint32_t              freq;               // Nominal bus frequency in Hz
+  uint32_t              freq_min;           // Minimum bus frequency in Hz
+  uint32_t              freq_max;           // Maximum bus frequency in Hz
+  int32_t               hddat_min;          // Minimum data hold time
+  int32_t               vddat_max;          // Maximum data valid time
+  int32_t               sudat_min;          // Minimum data setup time
+  int32_t               lscl_min;           // Minimum SCL low period
+  int32_t               hscl_min;           // Minimum SCL high period
+} I2C_CHARAC;
+
 /*******************************************************************************
  *  global variable definitions (scope: module-local)
  ******************************************************************************/
 
+static const I2C_CHARAC I2C_Charac[3] = {
+  {  100000U,  80000U,  120000U, 0, 3450, 250, 4700, 4000 }, // Standard-mode
+  {  400000U, 320000U,  480000U, 0,  900, 100, 1300,  600 }, // Fast-mode
+  { 1000000U, 800000U, 1200000U, 0,  450,  50,  500,  260 }, // Fast-mode Plus
+};
+
 /* Driver Version */
 static const ARM_DRIVER_VERSION DriverVersion = {
   ARM_I2C_API_VERSION,
@@ -92,6 +109,13 @@ static I2C_RESOURCES I2C1_Resources = {
       RTE_I2C1_SDA_PIN,
       RTE_I2C1_SDA_FUNC,
   },
+  {
+      RTE_I2C1_RISE_TIME,
+      RTE_I2C1_FALL_TIME,
+      RTE_I2C1_ANALOG_FILTER,
+      RTE_I2C1_DIGITAL_FILTER,
+      I2C1_FMP_MASK,
+  },
   I2C1_IRQn,
   RCC_APB_I2C1_MASK,
   &I2C1_Info,
@@ -116,6 +140,13 @@ static I2C_RESOURCES I2C2_Resources = {
       RTE_I2C2_SDA_PIN,
       RTE_I2C2_SDA_FUNC,
   },
+  {
+      RTE_I2C2_RISE_TIME,
+      RTE_I2C2_FALL_TIME,
+      RTE_I2C2_ANALOG_FILTER,
+      RTE_I2C2_DIGITAL_FILTER,
+      I2C2_FMP_MASK,
+  },
   I2C2_IRQn,
   RCC_APB_I2C2_MASK,
   &I2C2_Info,
@@ -143,11 +174,119 @@ uint32_t GetI2CCLK(I2C_RESOURCES *i2c)
       freq_type = RCC_FREQ_HSI;
   }
 
-  clk = RCC_GetFreq(freq_type) / 1000000;
+  clk = RCC_GetFreq(freq_type);
 
   return clk;
 }
 
+/**
+ * @fn          uint32_t I2C_SolveTiming(uint32_t clk, const I2C_CHARAC *ch, I2C_BUS_CFG *bus)
+ * @brief       Compute TIMINGR from I2C kernel clock, bus rise/fall times and
+ *              noise filter settings. The search order of the ST I2C timing
+ *              tool is kept: for each prescaler the shortest valid SCLDEL and
+ *              SDADEL are taken, then SCLL/SCLH giving the SCL period closest
+ *              to the nominal one. The first best match wins.
+ * @param[in]   clk   I2C kernel clock in Hz
+ * @param[in]   ch    Bus mode characteristics
+ * @param[in]   bus   Bus timing and filter configuration
+ * @return      TIMINGR value, 0 if the mode cannot be met with this clock
+ */
+static
+uint32_t I2C_SolveTiming(uint32_t clk, const I2C_CHARAC *ch, I2C_BUS_CFG *bus)
+{
+  int32_t ti2cclk, tspeed, tclk_min, tclk_max;
+  int32_t taf_min, taf_max, tdnf, tpresc, tbase;
+  int32_t tsdadel_min, tsdadel_max, tscldel_min;
+  int32_t tscl_l, tscl_h, tscl, error, best_error;
+  int32_t presc, scldel, sdadel, scll, sclh, sclh_min, n, i;
+  int32_t sclh_try[2];
+  uint32_t timing = 0U;
+
+  if (clk == 0U)
+    return 0U;
+
+  ti2cclk  = (int32_t)((NSEC_PER_SEC + (clk / 2U)) / clk);
+  tspeed   = (int32_t)((NSEC_PER_SEC + (ch->freq / 2U)) / ch->freq);
+  tclk_min = (int32_t)(NSEC_PER_SEC / ch->freq_max);
+  tclk_max = (int32_t)(NSEC_PER_SEC / ch->freq_min);
+
+  taf_min = bus->analog_filter ? I2C_AF_DELAY_MIN : 0;
+  taf_max = bus->analog_filter ? I2C_AF_DELAY_MAX : 0;
+  tdnf    = (int32_t)bus->digital_filter * ti2cclk;
+
+  /* Data hold window (SDADEL) and data setup time (SCLDEL) */
+  tsdadel_min = bus->fall_time + ch->hddat_min - taf_min - ((bus->digital_filter + 3) * ti2cclk);
+  tsdadel_max = ch->vddat_max - bus->rise_time - taf_max - ((bus->digital_filter + 4) * ti2cclk);
+  tscldel_min = bus->rise_time + ch->sudat_min;
+
+  if (tsdadel_min < 0)
+    tsdadel_min = 0;
+  if (tsdadel_max < 0)
+    tsdadel_max = 0;
+
+  /* SCL low and high periods add filter delays and SCL sync */
+  tbase = taf_min + tdnf + (2 * ti2cclk);
+
+  best_error = INT32_MAX;
+
+  for (presc = 0; presc < 16; presc++) {
+    tpresc = (presc + 1) * ti2cclk;
+
+    scldel = ((tscldel_min + tpresc - 1) / tpresc) - 1;
+    if (scldel < 0)
+      scldel = 0;
+
+    sdadel = (tsdadel_min + tpresc - 1) / tpresc;
+
+    if ((scldel > 15) || (sdadel > 15) || ((sdadel * tpresc) > tsdadel_max))
+      continue;
+
+    /* Shortest SCL high period */
+    sclh_min = ((ch->hscl_min - tbase + tpresc - 1) / tpresc) - 1;
+    if (sclh_min < 0)
+      sclh_min = 0;
+
+    for (scll = 0; scll < 256; scll++) {
+      tscl_l = tbase + ((scll + 1) * tpresc);
+
+      if ((tscl_l <= ch->lscl_min) || (ti2cclk >= ((tscl_l - taf_min - tdnf) / 4)))
+        continue;
+
+      if ((tscl_l + tbase + tpresc + bus->rise_time + bus->fall_time) > tclk_max)
+        break;
+
+      /* Period is linear in SCLH, the best one is next to the nominal period */
+      n = tspeed - tscl_l - tbase - bus->rise_time - bus->fall_time;
+      n = (n >= tpresc) ? ((n / tpresc) - 1) : 0;
+
+      sclh_try[0] = (n < sclh_min) ? sclh_min : n;
+      sclh_try[1] = sclh_try[0] + 1;
+
+      for (i = 0; i < 2; i++) {
+        sclh = sclh_try[i];
+        if (sclh > 255)
+          break;
+
+        tscl_h = tbase + ((sclh + 1) * tpresc);
+        tscl   = tscl_l + tscl_h + bus->rise_time + bus->fall_time;
+
+        if ((tscl < tclk_min) || (tscl > tclk_max) || (tscl_h < ch->hscl_min) || (ti2cclk >= tscl_h))
+          continue;
+
+        error = (tscl > tspeed) ? (tscl - tspeed) : (tspeed - tscl);
+
+        if (error < best_error) {
+          best_error = error;
+          timing = ((uint32_t)presc  << 28) | ((uint32_t)scldel << 20) |
+                   ((uint32_t)sdadel << 16) | ((uint32_t)sclh   <<  8) | (uint32_t)scll;
+        }
+      }
+    }
+  }
+
+  return timing;
+}
+
 /**
  * @fn      ARM_DRIVER_VERSION I2C_GetVersion(void)
  * @brief   Get driver version.
@@ -362,29 +501,55 @@ int32_t I2Cx_Control(uint32_t control, uint32_t arg, I2C_RESOURCES *i2c)
 
     case ARM_I2C_BUS_SPEED:
     {
-      uint32_t timing = 0;
+      uint32_t speed, cr1;
       uint32_t i2cclk = GetI2CCLK(i2c);
-      int32_t presc = ((T_I2CCLK * i2cclk / 1000) - 1);
-
-      if (presc < 0)
-        return ARM_DRIVER_ERROR_UNSUPPORTED;
+      I2C_TIMING *timing;
 
       switch (arg) {
       case ARM_I2C_BUS_SPEED_STANDARD:
-        timing = ((presc << 28) | ((STD_MODE_SCLDEL-1) << 20) |
-            (STD_MODE_SDADEL << 16) | ((STD_MODE_SCLH-1) << 8) | (STD_MODE_SCLL-1));
+        speed = I2C_SPEED_STANDARD;
         break;
       case ARM_I2C_BUS_SPEED_FAST:
-        timing = ((presc << 28) | ((FST_MODE_SCLDEL-1) << 20) |
-            (FST_MODE_SDADEL << 16) | ((FST_MODE_SCLH-1) << 8) | (FST_MODE_SCLL-1));
+        speed = I2C_SPEED_FAST;
+        break;
+      case ARM_I2C_BUS_SPEED_FAST_PLUS:
+        if (i2c->bus.fmp_mask == 0U)
+          return ARM_DRIVER_ERROR_UNSUPPORTED;
+        speed = I2C_SPEED_FAST_PLUS;
         break;
       default:
         return ARM_DRIVER_ERROR_UNSUPPORTED;
       }
 
-      reg->CR1 &= ~I2C_CR1_PE;
-      reg->TIMINGR = timing;
-      reg->CR1 |= I2C_CR1_PE;
+      /* Solve only when the kernel clock changed since the last call */
+      timing = &info->timing[speed];
+      if (timing->clk != i2cclk) {
+        timing->timingr = I2C_SolveTiming(i2cclk, &I2C_Charac[speed], &i2c->bus);
+        timing->clk     = i2cclk;
+      }
+
+      if (timing->timingr == 0U)
+        return ARM_DRIVER_ERROR_UNSUPPORTED;
+
+      /* Fast-mode Plus drive capability of the pins */
+      if (i2c->bus.fmp_mask != 0U) {
+        RCC->APB2ENR |= RCC_APB2ENR_SYSCFGCOMPEN;
+
+        if (speed == I2C_SPEED_FAST_PLUS)
+          SYSCFG->CFGR1 |=  i2c->bus.fmp_mask;
+        else
+          SYSCFG->CFGR1 &= ~i2c->bus.fmp_mask;
+      }
+
+      /* Noise filters can be changed only while the peripheral is disabled */
+      cr1 = reg->CR1 & ~(I2C_CR1_PE | I2C_CR1_ANFOFF | I2C_CR1_DNF);
+      if (i2c->bus.analog_filter == 0U)
+        cr1 |= I2C_CR1_ANFOFF;
+      cr1 |= ((uint32_t)i2c->bus.digital_filter << 8) & I2C_CR1_DNF;
+
+      reg->CR1 = cr1;
+      reg->TIMINGR = timing->timingr;
+      reg->CR1 = cr1 | I2C_CR1_PE;
 
       /* Master configured, clock set */
       info->flags |= I2C_FLAG_SETUP;
@@ -54,6 +54,10 @@
   #define I2C1_SDA_GPIO_PORT        RTE_I2C1_SDA_PORT
   #define I2C1_SDA_GPIO_PIN         RTE_I2C1_SDA_PIN
   #define I2C1_SDA_GPIO_FUNC        RTE_I2C1_SDA_FUNC
+
+  /* Fast-mode Plus drive is enabled per pin on PB6..PB9 */
+  #define I2C1_FMP_MASK             (((RTE_I2C1_SCL_PORT_ID == 0) ? SYSCFG_CFGR1_I2C_FMP_PB6 : SYSCFG_CFGR1_I2C_FMP_PB8) | \
+                                     ((RTE_I2C1_SDA_PORT_ID == 0) ? SYSCFG_CFGR1_I2C_FMP_PB7 : SYSCFG_CFGR1_I2C_FMP_PB9))
 #endif
 
 /* I2C2 configuration definitions */
@@ -71,6 +75,12 @@
   #define I2C2_SDA_GPIO_PORT        RTE_I2C2_SDA_PORT
   #define I2C2_SDA_GPIO_PIN         RTE_I2C2_SDA_PIN
   #define I2C2_SDA_GPIO_FUNC        RTE_I2C2_SDA_FUNC
+
+  #if defined(SYSCFG_CFGR1_I2C_FMP_I2C2)
+    #define I2C2_FMP_MASK           SYSCFG_CFGR1_I2C_FMP_I2C2
+  #else
+    #define I2C2_FMP_MASK           0U
+  #endif
 #endif
 
 /* Current driver status flag definition */
@@ -100,6 +110,21 @@ typedef const struct _I2C_IO {
   GPIO_PIN_FUNC_t       sda_func;           // SDA AF pin configuration
 } I2C_IO;
 
+/* I2C Bus Timing Configuration */
+typedef const struct _I2C_BUS_CFG {
+  int16_t               rise_time;          // SCL/SDA rise time in ns
+  int16_t               fall_time;          // SCL/SDA fall time in ns
+  uint8_t               analog_filter;      // Analog noise filter enabled
+  uint8_t               digital_filter;     // Digital noise filter length in tI2CCLK (0..15)
+  uint32_t              fmp_mask;           // SYSCFG_CFGR1 Fast-mode Plus drive bits, 0 if not supported
+} I2C_BUS_CFG;
+
+/* I2C Bus Timing (Run-Time) */
+typedef struct _I2C_TIMING {
+  uint32_t              clk;                // I2C kernel clock the value was solved for
+  uint32_t              timingr;            // TIMINGR value, 0 if the speed cannot be met
+} I2C_TIMING;
+
 /* I2C Transfer Information (Run-Time) */
 typedef struct _I2C_TRANSFER_INFO {
   uint32_t              num;                // Number of data to transfer
@@ -114,6 +139,7 @@ typedef struct _I2C_INFO {
   ARM_I2C_STATUS        status;             // Status flags
   uint8_t               flags;              // Current I2C state flags
   I2C_TRANSFER_INFO     xfer;               // Transfer information
+  I2C_TIMING            timing[3];          // Solved timing per bus speed
 } I2C_INFO;
 
 /* I2C Resource Configuration */
@@ -122,6 +148,7 @@ typedef struct {
   I2C_DMA              *dma_rx;             // I2C DMA Configuration
   I2C_DMA              *dma_tx;             // I2C DMA Configuration
   I2C_IO                io;                 // I2C Input/Output pins
+  I2C_BUS_CFG           bus;                // I2C bus timing configuration
   IRQn_Type             irq_num;            // I2C IRQ Number
   uint32_t              rcc_mask;           // RCC Clock/Reset register mask
   I2C_INFO             *info;               // Run-Time information
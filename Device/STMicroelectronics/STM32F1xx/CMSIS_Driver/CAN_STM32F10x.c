@@ -18,8 +18,8 @@
  * 3. This notice may not be removed or altered from any source distribution.
  *
  *
- * $Date:        14. April 2017
- * $Revision:    V1.6
+ * $Date:        17. October 2026
+ * $Revision:    V1.7
  *
  * Driver:       Driver_CAN1/2
  * Configured:   via RTE_Device.h configuration file
@@ -43,9 +43,16 @@
  *   CAN2_FILTER_BANK_NUM: defines maximum number of Filter Banks used for CAN2 controller (0..28)
  *                         (sum of maximum number of Filter Banks used for CAN1 and CAN2 must not exceed 28)
  *     - default value:    14
+ *   CAN_RX_QUEUE_SIZE:    defines number of messages buffered in software for each receive object (0 or power of 2)
+ *                         (when not 0 receive interrupts move messages from hardware FIFO to a software queue)
+ *                         (receive time stamps enable time triggered mode, which also makes the TGT bit of
+ *                          transmit mailboxes active; MessageSend clears TGT so data bytes 6 and 7 are sent)
+ *     - default value:    0 (software receive queue disabled)
  * -------------------------------------------------------------------------- */
 
 /* History:
+ *  Version 1.7
+ *    Added optional software receive queue with time stamps, batch read and statistics
  *  Version 1.6
  *    Corrected filter setting for adding/removing maskable Standard ID
  *  Version 1.5
@@ -88,14 +95,31 @@
 #error  Too many Filter Banks defined, maximum sum of Filter Banks for both CAN1 and CAN2 is 28 !!!
 #endif
 
+// Number of messages buffered in software for each receive object (0 = disabled)
+#ifndef CAN_RX_QUEUE_SIZE
+#define CAN_RX_QUEUE_SIZE               (0U)
+#endif
+
+#if   ((CAN_RX_QUEUE_SIZE & (CAN_RX_QUEUE_SIZE - 1U)) != 0U)
+#error  CAN_RX_QUEUE_SIZE must be 0 or a power of 2 !!!
+#endif
+
 #define CAN_RX_OBJ_NUM                  (2U)          // Number of receive objects
 #define CAN_TX_OBJ_NUM                  (3U)          // Number of transmit objects
 #define CAN_TOT_OBJ_NUM                 (CAN_RX_OBJ_NUM + CAN_TX_OBJ_NUM)
 
+#if   (CAN_RX_QUEUE_SIZE != 0U)
+#define CAN_MCR_RX_TTCM                 CAN_MCR_TTCM  // Time triggered mode captures receive time stamps
+#define CAN_TDTR_CLR_MSK                (CAN_TDT0R_DLC | CAN_TDT0R_TGT) // No time stamp in transmitted data
+#else
+#define CAN_MCR_RX_TTCM                 (0U)
+#define CAN_TDTR_CLR_MSK                CAN_TDT0R_DLC
+#endif
+
 
 // CAN Driver ******************************************************************
 
-#define ARM_CAN_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,6)         // CAN driver version
+#define ARM_CAN_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,7)         // CAN driver version
 
 // Driver Version
 static const ARM_DRIVER_VERSION can_driver_version = { ARM_CAN_API_VERSION, ARM_CAN_DRV_VERSION };
@@ -156,6 +180,19 @@ static uint8_t                     can_obj_cfg           [CAN_CTRL_NUM][CAN_TOT_
 static ARM_CAN_SignalUnitEvent_t   CAN_SignalUnitEvent   [CAN_CTRL_NUM];
 static ARM_CAN_SignalObjectEvent_t CAN_SignalObjectEvent [CAN_CTRL_NUM];
 
+#if (CAN_RX_QUEUE_SIZE != 0U)
+// Software receive queue (single producer: receive IRQ, single consumer: reader)
+typedef struct _CAN_RX_QUEUE {
+  CAN_RX_MSG        msg[CAN_RX_QUEUE_SIZE];     // Message records
+  volatile uint32_t head;                       // Free running write index (written by IRQ only)
+  volatile uint32_t tail;                       // Free running read index (written by reader only)
+  uint32_t          high_water;                 // Maximum number of queued messages
+  uint32_t          dropped;                    // Number of lost messages
+} CAN_RX_QUEUE;
+
+static CAN_RX_QUEUE                can_rx_queue          [CAN_CTRL_NUM][CAN_RX_OBJ_NUM];
+#endif
+
 
 // Helper Functions
 
@@ -482,6 +519,101 @@ static int32_t CANx_RemoveFilter (uint32_t obj_idx, CAN_FILTER_TYPE filter_type,
   return status;
 }
 
+#if (CAN_RX_QUEUE_SIZE != 0U)
+/**
+  \fn          void CANx_RxQueueDrain (uint32_t obj_idx, uint8_t x)
+  \brief       Move all pending messages from receive FIFO to software receive queue (called from IRQ).
+  \param[in]   obj_idx  Receive object index (FIFO number)
+  \param[in]   x        Controller number (0..1)
+*/
+static void CANx_RxQueueDrain (uint32_t obj_idx, uint8_t x) {
+  CAN_FIFOMailBox_TypeDef *ptr_MB;
+  CAN_RX_QUEUE            *ptr_Q;
+  CAN_RX_MSG              *ptr_msg;
+  volatile uint32_t       *ptr_RFR;
+  uint32_t                 data_rx[2];
+  uint32_t                 rir, rdtr, head, cnt, event;
+
+  ptr_MB  = &ptr_CANx[x]->sFIFOMailBox[obj_idx];
+  ptr_RFR = (obj_idx == 1U) ? &ptr_CANx[x]->RF1R : &ptr_CANx[x]->RF0R;     // RF0R and RF1R have the same layout
+  ptr_Q   = &can_rx_queue[x][obj_idx];
+  event   = 0U;
+
+  if ((*ptr_RFR & CAN_RF0R_FOVR0) != 0U) {
+    *ptr_RFR = CAN_RF0R_FOVR0;                          // Clear overrun flag
+    ptr_Q->dropped++;                                   // At least one message was lost in hardware
+    event = ARM_CAN_EVENT_RECEIVE_OVERRUN;
+  }
+
+  head = ptr_Q->head;
+  while ((*ptr_RFR & CAN_RF0R_FMP0) != 0U) {
+    cnt = head - ptr_Q->tail;
+    if (cnt >= CAN_RX_QUEUE_SIZE) {                     // Queue full, message is discarded
+      ptr_Q->dropped++;
+      event |= ARM_CAN_EVENT_RECEIVE_OVERRUN;
+    } else {
+      ptr_msg = &ptr_Q->msg[head & (CAN_RX_QUEUE_SIZE - 1U)];
+      rir     = ptr_MB->RIR;
+      rdtr    = ptr_MB->RDTR;
+
+      if ((rir & CAN_RI0R_IDE) != 0U) {                 // Extended Identifier
+        ptr_msg->info.id = (0x1FFFFFFFUL & (rir >>  3)) | ARM_CAN_ID_IDE_Msk;
+      } else {                                          // Standard Identifier
+        ptr_msg->info.id = (    0x07FFUL & (rir >> 21));
+      }
+      ptr_msg->info.rtr = ((rir & CAN_RI0R_RTR) != 0U) ? 1U : 0U;
+      ptr_msg->info.dlc = rdtr & CAN_RDT0R_DLC;
+      ptr_msg->time     = (uint16_t)(rdtr >> 16);       // Time stamp captured at start of frame
+
+      data_rx[0] = ptr_MB->RDLR;
+      data_rx[1] = ptr_MB->RDHR;
+      memcpy(ptr_msg->data, (uint8_t *)(&data_rx[0]), 8U);
+
+      cnt++;
+      if (cnt > ptr_Q->high_water) { ptr_Q->high_water = cnt; }
+
+      __DMB();                                          // Record must be complete before it is published
+      head++;
+      ptr_Q->head = head;
+    }
+    event |= ARM_CAN_EVENT_RECEIVE;
+
+    *ptr_RFR = CAN_RF0R_RFOM0;                          // Release FIFO output mailbox
+    while ((*ptr_RFR & CAN_RF0R_RFOM0) != 0U);          // Wait until mailbox is released
+  }
+
+  if ((event != 0U) && (CAN_SignalObjectEvent[x] != NULL)) { CAN_SignalObjectEvent[x](obj_idx, event); }
+}
+
+/**
+  \fn          uint32_t CANx_RxQueueGet (uint32_t obj_idx, CAN_RX_MSG *msg, uint32_t num, uint8_t x)
+  \brief       Remove messages from software receive queue.
+  \param[in]   obj_idx  Receive object index
+  \param[out]  msg      Pointer to array of message records
+  \param[in]   num      Maximum number of messages to remove
+  \param[in]   x        Controller number (0..1)
+  \return      number of messages removed
+*/
+static uint32_t CANx_RxQueueGet (uint32_t obj_idx, CAN_RX_MSG *msg, uint32_t num, uint8_t x) {
+  CAN_RX_QUEUE *ptr_Q;
+  uint32_t      tail, cnt, i;
+
+  ptr_Q = &can_rx_queue[x][obj_idx];
+  tail  = ptr_Q->tail;
+  cnt   = ptr_Q->head - tail;
+  if (num > cnt) { num = cnt; }
+
+  __DMB();                                              // Records are read only after head
+  for (i = 0U; i < num; i++) {
+    msg[i] = ptr_Q->msg[(tail + i) & (CAN_RX_QUEUE_SIZE - 1U)];
+  }
+  __DMB();                                              // Records must be read before they are released
+  ptr_Q->tail = tail + num;
+
+  return num;
+}
+#endif
+
 // CAN Driver Functions
 
 /**
@@ -734,6 +866,9 @@ static int32_t CANx_PowerControl (ARM_POWER_STATE state, uint8_t x) {
       }
 
       memset(&can_obj_cfg[x][0], 0, CAN_TOT_OBJ_NUM);
+#if (CAN_RX_QUEUE_SIZE != 0U)
+      memset(&can_rx_queue[x][0], 0, sizeof(can_rx_queue[x]));
+#endif
 
       ptr_CAN->IER =   CAN_IER_TMEIE  |         // Enable Interrupts
                        CAN_IER_FMPIE0 |
@@ -749,7 +884,7 @@ static int32_t CANx_PowerControl (ARM_POWER_STATE state, uint8_t x) {
 
 #if (MX_CAN1 == 1U)
       if (x == 0U) {
-        if ((CAN_SignalUnitEvent[0] != NULL) || (CAN_SignalObjectEvent[0] != NULL)) {
+        if ((CAN_SignalUnitEvent[0] != NULL) || (CAN_SignalObjectEvent[0] != NULL) || (CAN_RX_QUEUE_SIZE != 0U)) {
           NVIC_ClearPendingIRQ (CAN1_TX_IRQn);
           NVIC_EnableIRQ       (CAN1_TX_IRQn);
           NVIC_ClearPendingIRQ (CAN1_RX0_IRQn);
@@ -765,7 +900,7 @@ static int32_t CANx_PowerControl (ARM_POWER_STATE state, uint8_t x) {
 #endif
 #if (MX_CAN2 == 1U)
       if (x == 1U) {
-        if ((CAN_SignalUnitEvent[1] != NULL) || (CAN_SignalObjectEvent[1] != NULL)) {
+        if ((CAN_SignalUnitEvent[1] != NULL) || (CAN_SignalObjectEvent[1] != NULL) || (CAN_RX_QUEUE_SIZE != 0U)) {
           NVIC_ClearPendingIRQ (CAN2_TX_IRQn);
           NVIC_EnableIRQ       (CAN2_TX_IRQn);
           NVIC_ClearPendingIRQ (CAN2_RX0_IRQn);
@@ -883,14 +1018,16 @@ static int32_t CANx_SetMode (ARM_CAN_MODE mode, uint8_t x) {
   switch (mode) {
     case ARM_CAN_MODE_INITIALIZATION:
       CAN1->FMR    |=  CAN_FMR_FINIT;           // Filter initialization mode
-      ptr_CAN->MCR  =  CAN_MCR_INRQ;            // Enter initialization mode
+      ptr_CAN->MCR  =  CAN_MCR_INRQ |           // Enter initialization mode
+                       CAN_MCR_RX_TTCM;         // Time stamp received messages (software receive queue)
       while ((ptr_CAN->MSR&CAN_MSR_INAK)==0U);  // Wait to enter initialization mode
       event = ARM_CAN_EVENT_UNIT_BUS_OFF;
       break;
     case ARM_CAN_MODE_NORMAL:
       ptr_CAN->BTR &=~(CAN_BTR_LBKM | CAN_BTR_SILM);
       ptr_CAN->MCR  =  CAN_MCR_ABOM |           // Activate automatic bus-off
-                       CAN_MCR_AWUM ;           // Enable automatic wakeup mode
+                       CAN_MCR_AWUM |           // Enable automatic wakeup mode
+                       CAN_MCR_RX_TTCM;         // Time stamp received messages (software receive queue)
       while ((ptr_CAN->MSR&CAN_MSR_INAK)!=0U);  // Wait to exit initialization mode
       CAN1->FMR    &= ~CAN_FMR_FINIT;           // Filter active mode
       event = ARM_CAN_EVENT_UNIT_ACTIVE;
@@ -1107,13 +1244,13 @@ static int32_t CANx_MessageSend (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, c
     size = 0U;
     tir |= CAN_TI0R_RTR;
 
-    ptr_CAN->sTxMailBox[obj_idx].TDTR &= ~CAN_TDT0R_DLC;
+    ptr_CAN->sTxMailBox[obj_idx].TDTR &= ~CAN_TDTR_CLR_MSK;
     ptr_CAN->sTxMailBox[obj_idx].TDTR |=  msg_info->dlc & CAN_TDT0R_DLC;
   } else {
     ptr_CAN->sTxMailBox[obj_idx].TDLR = *((__packed uint32_t *)(data  ));
     ptr_CAN->sTxMailBox[obj_idx].TDHR = *((__packed uint32_t *)(data+4));
 
-    ptr_CAN->sTxMailBox[obj_idx].TDTR &= ~CAN_TDT0R_DLC;
+    ptr_CAN->sTxMailBox[obj_idx].TDTR &= ~CAN_TDTR_CLR_MSK;
     ptr_CAN->sTxMailBox[obj_idx].TDTR |=  size & CAN_TDT0R_DLC;
   }
 
@@ -1140,18 +1277,31 @@ static int32_t CAN2_MessageSend (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, c
   \return      value < 0   execution status
 */
 static int32_t CANx_MessageRead (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data, uint8_t size, uint8_t x) {
+#if (CAN_RX_QUEUE_SIZE != 0U)
+  CAN_RX_MSG   msg;
+#else
   CAN_TypeDef *ptr_CAN;
   uint32_t     data_rx[2][2];
+#endif
 
   if (x >= CAN_CTRL_NUM)                         { return ARM_DRIVER_ERROR;           }
   if (obj_idx >= CAN_RX_OBJ_NUM)                 { return ARM_DRIVER_ERROR_PARAMETER; }
   if (can_driver_powered[x] == 0U)               { return ARM_DRIVER_ERROR;           }
   if (can_obj_cfg[x][obj_idx] != ARM_CAN_OBJ_RX) { return ARM_DRIVER_ERROR;           }
 
-  ptr_CAN = ptr_CANx[x];
-
   if (size > 8U) { size = 8U; }
 
+#if (CAN_RX_QUEUE_SIZE != 0U)
+  if (CANx_RxQueueGet (obj_idx, &msg, 1U, x) == 0U) { return ARM_DRIVER_ERROR; }
+
+  *msg_info = msg.info;
+  if (msg_info->rtr != 0U) { size = 0U; }
+  if (size > 0U) { memcpy(data, msg.data, size); }
+
+  return ((int32_t)size);
+#else
+  ptr_CAN = ptr_CANx[x];
+
   if ((ptr_CAN->sFIFOMailBox[obj_idx].RIR & CAN_RI0R_IDE) != 0U) {      // Extended Identifier
     msg_info->id = (0x1FFFFFFFUL & (ptr_CAN->sFIFOMailBox[obj_idx].RIR >>  3)) | ARM_CAN_ID_IDE_Msk;
   } else {                                              // Standard Identifier
@@ -1181,6 +1331,7 @@ static int32_t CANx_MessageRead (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, u
   }
 
   return ((int32_t)size);
+#endif
 }
 #if (MX_CAN1 == 1U)
 static int32_t CAN1_MessageRead (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data, uint8_t size) { return CANx_MessageRead (obj_idx, msg_info, data, size, 0U); }
@@ -1189,6 +1340,68 @@ static int32_t CAN1_MessageRead (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, u
 static int32_t CAN2_MessageRead (uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data, uint8_t size) { return CANx_MessageRead (obj_idx, msg_info, data, size, 1U); }
 #endif
 
+/**
+  \fn          int32_t CANx_MessageReadBatch (uint32_t obj_idx, CAN_RX_MSG *msg, uint32_t num, uint8_t x)
+  \brief       Read multiple messages from software receive queue.
+  \param[in]   obj_idx  Object index
+  \param[out]  msg      Pointer to array of message records
+  \param[in]   num      Maximum number of messages to read
+  \param[in]   x        Controller number (0..1)
+  \return      value >= 0  number of messages read
+  \return      value < 0   execution status
+*/
+static int32_t CANx_MessageReadBatch (uint32_t obj_idx, CAN_RX_MSG *msg, uint32_t num, uint8_t x) {
+
+  if (x >= CAN_CTRL_NUM)                         { return ARM_DRIVER_ERROR;             }
+  if (obj_idx >= CAN_RX_OBJ_NUM)                 { return ARM_DRIVER_ERROR_PARAMETER;   }
+  if ((msg == NULL) && (num != 0U))              { return ARM_DRIVER_ERROR_PARAMETER;   }
+  if (can_driver_powered[x] == 0U)               { return ARM_DRIVER_ERROR;             }
+  if (can_obj_cfg[x][obj_idx] != ARM_CAN_OBJ_RX) { return ARM_DRIVER_ERROR;             }
+
+#if (CAN_RX_QUEUE_SIZE != 0U)
+  return ((int32_t)CANx_RxQueueGet (obj_idx, msg, num, x));
+#else
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+}
+#if (MX_CAN1 == 1U)
+int32_t CAN1_MessageReadBatch (uint32_t obj_idx, CAN_RX_MSG *msg, uint32_t num) { return CANx_MessageReadBatch (obj_idx, msg, num, 0U); }
+#endif
+#if (MX_CAN2 == 1U)
+int32_t CAN2_MessageReadBatch (uint32_t obj_idx, CAN_RX_MSG *msg, uint32_t num) { return CANx_MessageReadBatch (obj_idx, msg, num, 1U); }
+#endif
+
+/**
+  \fn          int32_t CANx_RxQueueGetStatistics (uint32_t obj_idx, CAN_RX_QUEUE_STATS *stats, uint8_t x)
+  \brief       Get software receive queue statistics.
+  \param[in]   obj_idx  Object index
+  \param[out]  stats    Pointer to statistics
+  \param[in]   x        Controller number (0..1)
+  \return      execution status
+*/
+static int32_t CANx_RxQueueGetStatistics (uint32_t obj_idx, CAN_RX_QUEUE_STATS *stats, uint8_t x) {
+
+  if (x >= CAN_CTRL_NUM)           { return ARM_DRIVER_ERROR;           }
+  if (obj_idx >= CAN_RX_OBJ_NUM)   { return ARM_DRIVER_ERROR_PARAMETER; }
+  if (stats == NULL)               { return ARM_DRIVER_ERROR_PARAMETER; }
+
+#if (CAN_RX_QUEUE_SIZE != 0U)
+  stats->count      = can_rx_queue[x][obj_idx].head - can_rx_queue[x][obj_idx].tail;
+  stats->high_water = can_rx_queue[x][obj_idx].high_water;
+  stats->dropped    = can_rx_queue[x][obj_idx].dropped;
+
+  return ARM_DRIVER_OK;
+#else
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#endif
+}
+#if (MX_CAN1 == 1U)
+int32_t CAN1_RxQueueGetStatistics (uint32_t obj_idx, CAN_RX_QUEUE_STATS *stats) { return CANx_RxQueueGetStatistics (obj_idx, stats, 0U); }
+#endif
+#if (MX_CAN2 == 1U)
+int32_t CAN2_RxQueueGetStatistics (uint32_t obj_idx, CAN_RX_QUEUE_STATS *stats) { return CANx_RxQueueGetStatistics (obj_idx, stats, 1U); }
+#endif
+
 /**
   \fn          int32_t CANx_Control (uint32_t control, uint32_t arg, uint8_t x)
   \brief       Control CAN interface.
@@ -1373,12 +1586,16 @@ void USB_LP_CAN1_RX0_IRQHandler (void) {
   uint32_t esr, ier;
 
   if (can_obj_cfg[0][0] == ARM_CAN_OBJ_RX) {
+#if (CAN_RX_QUEUE_SIZE != 0U)
+    CANx_RxQueueDrain (0U, 0U);
+#else
     if ((CAN1->RF0R & CAN_RF0R_FOVR0) != 0U) {
       CAN1->RF0R = CAN_RF0R_FOVR0;      // Clear overrun flag
       if (CAN_SignalObjectEvent[0] != NULL) { CAN_SignalObjectEvent[0](0U, ARM_CAN_EVENT_RECEIVE | ARM_CAN_EVENT_RECEIVE_OVERRUN); }
     } else if ((CAN1->RF0R & CAN_RF0R_FMP0) != 0U) {
       if (CAN_SignalObjectEvent[0] != NULL) { CAN_SignalObjectEvent[0](0U, ARM_CAN_EVENT_RECEIVE); }
     }
+#endif
   } else {
     CAN1->RF0R = CAN_RF0R_RFOM0;        // Release FIFO 0 output mailbox if object not enabled for reception
   }
@@ -1407,12 +1624,16 @@ void CAN1_RX1_IRQHandler (void) {
   uint32_t esr, ier;
 
   if (can_obj_cfg[0][1] == ARM_CAN_OBJ_RX) {
+#if (CAN_RX_QUEUE_SIZE != 0U)
+    CANx_RxQueueDrain (1U, 0U);
+#else
     if ((CAN1->RF1R & CAN_RF1R_FOVR1) != 0U) {
       CAN1->RF1R = CAN_RF1R_FOVR1;      // Clear overrun flag
       if (CAN_SignalObjectEvent[0] != NULL) { CAN_SignalObjectEvent[0](1U, ARM_CAN_EVENT_RECEIVE | ARM_CAN_EVENT_RECEIVE_OVERRUN); }
     } else if ((CAN1->RF1R & CAN_RF1R_FMP1) != 0U) {
       if (CAN_SignalObjectEvent[0] != NULL) { CAN_SignalObjectEvent[0](1U, ARM_CAN_EVENT_RECEIVE); }
     }
+#endif
   } else {
     CAN1->RF1R = CAN_RF1R_RFOM1;        // Release FIFO 1 output mailbox if object not enabled for reception
   }
@@ -1502,12 +1723,16 @@ void CAN2_RX0_IRQHandler (void) {
   uint32_t esr, ier;
 
   if (can_obj_cfg[1][0] == ARM_CAN_OBJ_RX) {
+#if (CAN_RX_QUEUE_SIZE != 0U)
+    CANx_RxQueueDrain (0U, 1U);
+#else
     if ((CAN2->RF0R & CAN_RF0R_FOVR0) != 0U) {
       CAN2->RF0R = CAN_RF0R_FOVR0;      // Clear overrun flag
       if (CAN_SignalObjectEvent[1] != NULL) { CAN_SignalObjectEvent[1](0U, ARM_CAN_EVENT_RECEIVE | ARM_CAN_EVENT_RECEIVE_OVERRUN); }
     } else if ((CAN2->RF0R & CAN_RF0R_FMP0) != 0U) {
       if (CAN_SignalObjectEvent[1] != NULL) { CAN_SignalObjectEvent[1](0U, ARM_CAN_EVENT_RECEIVE); }
     }
+#endif
   } else {
     CAN2->RF0R = CAN_RF0R_RFOM0;        // Release FIFO 0 output mailbox if object not enabled for reception
   }
@@ -1536,12 +1761,16 @@ void CAN2_RX1_IRQHandler (void) {
   uint32_t esr, ier;
 
   if (can_obj_cfg[1][1] == ARM_CAN_OBJ_RX) {
+#if (CAN_RX_QUEUE_SIZE != 0U)
+    CANx_RxQueueDrain (1U, 1U);
+#else
     if ((CAN2->RF1R & CAN_RF1R_FOVR1) != 0U) {
       CAN2->RF1R = CAN_RF1R_FOVR1;      // Clear overrun flag
       if (CAN_SignalObjectEvent[1] != NULL) { CAN_SignalObjectEvent[1](1U, ARM_CAN_EVENT_RECEIVE | ARM_CAN_EVENT_RECEIVE_OVERRUN); }
     } else if ((CAN2->RF1R & CAN_RF1R_FMP1) != 0U) {
       if (CAN_SignalObjectEvent[1] != NULL) { CAN_SignalObjectEvent[1](1U, ARM_CAN_EVENT_RECEIVE); }
     }
+#endif
   } else {
     CAN2->RF1R = CAN_RF1R_RFOM1;        // Release FIFO 1 output mailbox if object not enabled for reception
   }
@@ -18,8 +18,8 @@
  * 3. This notice may not be removed or altered from any source distribution.
  *
  *
- * $Date:        24. December 2015
- * $Revision:    V1.1
+ * $Date:        17. October 2026
+ * $Revision:    V1.2
  *
  * Driver:       Driver_CAN1/2
  * Configured:   via RTE_Device.h configuration file
@@ -131,4 +131,28 @@
 #define CAN_CTRL_NUM                    (1U)
 #endif
 
+// Received message record of software receive queue
+typedef struct _CAN_RX_MSG {
+  ARM_CAN_MSG_INFO info;                // Message information
+  uint8_t          data[8];             // Message data
+  uint16_t         time;                // Time stamp (free running 16-bit counter in CAN bit times)
+} CAN_RX_MSG;
+
+// Software receive queue statistics
+typedef struct _CAN_RX_QUEUE_STATS {
+  uint32_t         count;               // Number of messages currently queued
+  uint32_t         high_water;          // Maximum number of messages queued
+  uint32_t         dropped;             // Number of messages lost (queue full or hardware FIFO overrun)
+} CAN_RX_QUEUE_STATS;
+
+// Software receive queue functions (available when CAN_RX_QUEUE_SIZE is not 0)
+#if    (MX_CAN1 == 1U)
+extern int32_t CAN1_MessageReadBatch     (uint32_t obj_idx, CAN_RX_MSG *msg, uint32_t num);
+extern int32_t CAN1_RxQueueGetStatistics (uint32_t obj_idx, CAN_RX_QUEUE_STATS *stats);
+#endif
+#if    (MX_CAN2 == 1U)
+extern int32_t CAN2_MessageReadBatch     (uint32_t obj_idx, CAN_RX_MSG *msg, uint32_t num);
+extern int32_t CAN2_RxQueueGetStatistics (uint32_t obj_idx, CAN_RX_QUEUE_STATS *stats);
+#endif
+
 #endif // __CAN_STM32F1XX_H
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2018 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Software CRC32 (IEEE 802.3) Definitions for STMicroelectronics STM32F1xx
+ */
+
+#ifndef CRC32_STM32F10X_H_
+#define CRC32_STM32F10X_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+/* CRC32 implementation variants */
+#define CRC32_METHOD_NIBBLE       0U    /* 16-entry table,    64 bytes ROM   */
+#define CRC32_METHOD_BYTE         1U    /* 256-entry table,   1 KB ROM       */
+#define CRC32_METHOD_SLICE4       2U    /* 4x256-entry table, 4 KB ROM       */
+
+/* Selected CRC32 implementation */
+#ifndef CRC32_METHOD
+#define CRC32_METHOD              CRC32_METHOD_BYTE
+#endif
+
+#if (CRC32_METHOD != CRC32_METHOD_NIBBLE) && \
+    (CRC32_METHOD != CRC32_METHOD_BYTE)   && \
+    (CRC32_METHOD != CRC32_METHOD_SLICE4)
+#error "Invalid CRC32_METHOD selected!"
+#endif
+
+/* CRC32 initial value and final XOR value */
+#define CRC32_INIT                0xFFFFFFFFU
+#define CRC32_XOROUT              0xFFFFFFFFU
+
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+/**
+ * @fn          uint32_t CRC32_Update(uint32_t crc, const void *data, uint32_t len)
+ * @brief       Update running CRC32 (polynomial 0x04C11DB7, reflected) with
+ *              a block of data. No initial or final XOR is applied.
+ * @param[in]   crc   Running CRC value
+ * @param[in]   data  Pointer to data buffer
+ * @param[in]   len   Data length in bytes
+ * @return      Updated CRC value
+ */
+uint32_t CRC32_Update(uint32_t crc, const void *data, uint32_t len);
+
+/**
+ * @fn          uint32_t CRC32_Calculate(const void *data, uint32_t len)
+ * @brief       Calculate standard IEEE 802.3 (Ethernet FCS) CRC32.
+ * @param[in]   data  Pointer to data buffer
+ * @param[in]   len   Data length in bytes
+ * @return      Calculated CRC value
+ */
+uint32_t CRC32_Calculate(const void *data, uint32_t len);
+
+#endif /* CRC32_STM32F10X_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -36,6 +36,7 @@
 #define RTE_SPI_INT_PRIORITY            (1U)
 #define RTE_DMA_INT_PRIORITY            (1U)
 #define RTE_EXTI_INT_PRIORITY           (1U)
+#define RTE_DAC_INT_PRIORITY            (1U)
 
 // <e> USART1 (Universal synchronous asynchronous receiver transmitter)
 // <i> Configuration settings for Driver_USART1 in component ::CMSIS Driver:USART
@@ -184,6 +185,16 @@
 #define RTE_USART1_TX_DMA_NUMBER        1
 #define RTE_USART1_TX_DMA_CHANNEL       4
 #define RTE_USART1_TX_DMA_PRIORITY      0
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART1_Read, USART1_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_USART1_FIFO                 0
+#define RTE_USART1_RX_FIFO_SIZE         64
+#define RTE_USART1_TX_FIFO_SIZE         64
 // </e>
 
 
@@ -377,6 +388,16 @@
 #define RTE_USART2_TX_DMA_NUMBER        1
 #define RTE_USART2_TX_DMA_CHANNEL       7
 #define RTE_USART2_TX_DMA_PRIORITY      0
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART2_Read, USART2_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_USART2_FIFO                 0
+#define RTE_USART2_RX_FIFO_SIZE         64
+#define RTE_USART2_TX_FIFO_SIZE         64
 
 // </e>
 
@@ -633,6 +654,16 @@
 #define RTE_USART3_TX_DMA_NUMBER        1
 #define RTE_USART3_TX_DMA_CHANNEL       2
 #define RTE_USART3_TX_DMA_PRIORITY      0
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART3_Read, USART3_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_USART3_FIFO                 0
+#define RTE_USART3_RX_FIFO_SIZE         64
+#define RTE_USART3_TX_FIFO_SIZE         64
 
 // </e>
 
@@ -692,6 +723,16 @@
 #define RTE_UART4_TX_DMA_NUMBER         2
 #define RTE_UART4_TX_DMA_CHANNEL        5
 #define RTE_UART4_TX_DMA_PRIORITY       0
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART4_Read, USART4_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_UART4_FIFO                  0
+#define RTE_UART4_RX_FIFO_SIZE          64
+#define RTE_UART4_TX_FIFO_SIZE          64
 
 // </e>
 
@@ -752,6 +793,16 @@
 #define RTE_UART5_TX_DMA_NUMBER         2
 #define RTE_UART5_TX_DMA_CHANNEL        1
 #define RTE_UART5_TX_DMA_PRIORITY       0
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART5_Read, USART5_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_UART5_FIFO                  0
+#define RTE_UART5_RX_FIFO_SIZE          64
+#define RTE_UART5_TX_FIFO_SIZE          64
 
 #endif
 // </e>
@@ -1500,6 +1551,70 @@
 // </e>
 
 
+// <e> DAC1 (Digital to Analog Converter 1) [Driver_DAC1]
+// <i> Configuration settings for Driver_DAC1 in component ::CMSIS Driver:DAC
+#define RTE_DAC1                        0
+
+//   <o> DAC1_OUT1 Pin <0=>Not Used <1=>PA4
+#define RTE_DAC1_CH1_OUT_ID             1
+#if    (RTE_DAC1_CH1_OUT_ID == 0)
+#define RTE_DAC1_CH1_OUT                0
+#elif  (RTE_DAC1_CH1_OUT_ID == 1)
+#define RTE_DAC1_CH1_OUT                1
+#define RTE_DAC1_CH1_OUT_PORT           GPIO_PORT_A
+#define RTE_DAC1_CH1_OUT_BIT            GPIO_PIN_4
+#else
+#error "Invalid DAC1_OUT1 Pin Configuration!"
+#endif
+
+//   <o> DAC1_OUT2 Pin <0=>Not Used <1=>PA5
+#define RTE_DAC1_CH2_OUT_ID             0
+#if    (RTE_DAC1_CH2_OUT_ID == 0)
+#define RTE_DAC1_CH2_OUT                0
+#elif  (RTE_DAC1_CH2_OUT_ID == 1)
+#define RTE_DAC1_CH2_OUT                1
+#define RTE_DAC1_CH2_OUT_PORT           GPIO_PORT_A
+#define RTE_DAC1_CH2_OUT_BIT            GPIO_PIN_5
+#else
+#error "Invalid DAC1_OUT2 Pin Configuration!"
+#endif
+
+//   <e> Hardware Trigger
+//     <o1> Timer <6=>TIM6 <7=>TIM7
+//     <i>  Selects basic timer which TRGO output paces conversions
+//   </e>
+#define RTE_DAC1_TRIGGER_HARDWARE       1
+#define RTE_DAC1_TRIGGER_SELECT         6
+
+//   <e> DMA Channel 1
+//     <o1> Number <1=>1 <2=>2
+//     <i>  Selects DMA Number (DMA1 on low and medium density value line devices)
+//     <o2> Channel <3=>3
+//     <i>  Selects DMA Channel (only Channel 3 can be used)
+//     <o3> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define RTE_DAC1_CH1_DMA                1
+#define RTE_DAC1_CH1_DMA_NUMBER         2
+#define RTE_DAC1_CH1_DMA_CHANNEL        3
+#define RTE_DAC1_CH1_DMA_PRIORITY       2
+
+//   <e> DMA Channel 2
+//     <o1> Number <1=>1 <2=>2
+//     <i>  Selects DMA Number (DMA1 on low and medium density value line devices)
+//     <o2> Channel <4=>4
+//     <i>  Selects DMA Channel (only Channel 4 can be used)
+//     <o3> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define RTE_DAC1_CH2_DMA                0
+#define RTE_DAC1_CH2_DMA_NUMBER         2
+#define RTE_DAC1_CH2_DMA_CHANNEL        4
+#define RTE_DAC1_CH2_DMA_PRIORITY       2
+
+// </e>
+
+
 // <e> ETH (Ethernet Interface) [Driver_ETH_MAC0]
 // <i> Configuration settings for Driver_ETH_MAC0 in component ::CMSIS Driver:Ethernet MAC
 #define RTE_ETH                         0
@@ -1793,6 +1908,23 @@
 #else
 #error "Invalid MCO Ethernet Reference Clock Configuration!"
 #endif
+
+//   <h> DMA Descriptors
+//     <o> Number of RX buffers <2-64>
+//     <i> Number of receive DMA descriptors and buffers
+#define RTE_ETH_NUM_RX_BUF              4
+//     <o> Number of TX buffers <2-64>
+//     <i> Number of transmit DMA descriptors and buffers
+#define RTE_ETH_NUM_TX_BUF              2
+//     <o> Buffer size <1524-8188:4>
+//     <i> Size of one receive/transmit buffer in bytes (multiple of 4)
+#define RTE_ETH_BUF_SIZE                1536
+//     <e> Place descriptors and buffers in a dedicated linker section
+//       <s1.32> Section name
+//     </e>
+#define RTE_ETH_DMA_SECTION             0
+#define RTE_ETH_DMA_SECTION_NAME        ".eth_dma"
+//   </h>
 // </e>
 
 
@@ -35,7 +35,7 @@
  *  defines and macros (scope: module-local)
  ******************************************************************************/
 
-#define DAC_DRV_VERSION             ARM_DRIVER_VERSION_MAJOR_MINOR(1,0)
+#define DAC_DRV_VERSION             ARM_DRIVER_VERSION_MAJOR_MINOR(1,1)
 
 /*******************************************************************************
  *  typedefs and structures (scope: module-local)
@@ -60,7 +60,7 @@ static const
 DAC_CAPABILITIES DriverCapabilities = {
     2,  /* Number of channels                         */
     1,  /* Supports output buffer                     */
-    0,  /* Supports external triggers for conversion  */
+    1,  /* Supports external triggers for conversion  */
     0,  /* Supports noise-wave generation             */
     0,  /* Supports triangular-wave generation        */
 };
@@ -168,6 +168,78 @@ void PinConfig(const DAC_PIN *io, const GPIO_PIN_CFG_t *pin_cfg)
   GPIO_PinConfig(io->port, io->pin, pin_cfg);
 }
 
+/**
+ * @fn          int32_t TriggerConfig(DAC_TRIGGER *trigger, uint32_t freq)
+ * @brief       Configure trigger timer to output an update event (TRGO)
+ *              at the requested sample rate.
+ * @param[in]   trigger  Pointer to DAC_TRIGGER
+ * @param[in]   freq     Sample rate in Hz
+ * @return      \ref execution_status
+ */
+static
+int32_t TriggerConfig(DAC_TRIGGER *trigger, uint32_t freq)
+{
+  TIM_TypeDef *tim = trigger->reg;
+  uint32_t ticks, psc;
+
+  if (freq == 0U)
+    return (ARM_DRIVER_ERROR_PARAMETER);
+
+  ticks = (RCC_GetPeriphFreq(trigger->periph) + (freq >> 1U)) / freq;
+
+  /* Basic timer does not count with zero auto-reload value */
+  if (ticks < 2U)
+    return (ARM_DRIVER_ERROR_PARAMETER);
+
+  /* Use the smallest prescaler to keep the finest period resolution */
+  psc = (ticks - 1U) >> 16U;
+
+  tim->CR1 = 0U;
+  tim->CR2 = 0U;
+  tim->PSC = psc;
+  tim->ARR = (ticks / (psc + 1U)) - 1U;
+  /* Load prescaler before update event is routed to TRGO */
+  tim->EGR = TIM_EGR_UG;
+  tim->CNT = 0U;
+  tim->CR2 = TIM_CR2_MMS_1;
+
+  return (ARM_DRIVER_OK);
+}
+
+/**
+ * @fn          void StopTransfer(const DAC_RESOURCES *dac, uint32_t drain)
+ * @brief       Stop trigger timer and DMA transfer, update transferred count.
+ * @param[in]   drain  Non-zero to let the timer generate one more trigger,
+ *                     which converts the last item loaded into DHR
+ */
+static
+void StopTransfer(const DAC_RESOURCES *dac, uint32_t drain)
+{
+  DAC_TRANSFER_INFO *xfer = dac->xfer;
+
+  if (dac->trigger != NULL) {
+    if (drain != 0U) {
+      /* Timer stops by itself after the next update event */
+      dac->trigger->reg->CR1 |= TIM_CR1_OPM;
+    }
+    else {
+      /* Stop trigger timer */
+      dac->trigger->reg->CR1 &= ~TIM_CR1_CEN;
+    }
+  }
+
+  /* Disable DMA requests */
+  dac->reg->CR &= ~(DAC_CR_DMAEN1 | DAC_CR_DMAEN2);
+
+  if (xfer->dma != NULL) {
+    DMA_ChannelDisable(xfer->dma->instance);
+    xfer->cnt = xfer->num - DMA_ChannelTransferItemCount(xfer->dma->instance);
+    xfer->dma = NULL;
+  }
+
+  dac->info->status.busy = 0U;
+}
+
 /**
  * @fn          ARM_DRIVER_VERSION DACx_GetVersion(void)
  * @brief       Get DAC driver version.
@@ -265,6 +337,10 @@ int32_t DAC_PowerControl(ARM_POWER_STATE state, const DAC_RESOURCES *dac)
 
   switch (state) {
     case ARM_POWER_OFF:
+      /* Stop active conversion */
+      if (info->status.busy)
+        StopTransfer(dac, 0U);
+
 #ifdef DAC1_TRG_TIMER_Instance
       /* Disable Timer clock */
       RCC_DisablePeriph(dac->trigger->periph);
@@ -322,7 +398,12 @@ int32_t DAC_PowerControl(ARM_POWER_STATE state, const DAC_RESOURCES *dac)
 
 /**
  * @fn          int32_t DAC_Convert(const void *data, uint32_t num, const DAC_RESOURCES *dac)
- * @brief       Start transfer data to DAC Interface.
+ * @brief       Start transfer data to DAC Interface. Data items are moved by
+ *              DMA to the data holding register on every trigger timer
+ *              update event. Item size is 16-bit for 12-bit formats and
+ *              8-bit for 8-bit format, doubled for DAC_OUTPUT_CHANNEL_BOTH.
+ *              In single mode the last item is output on the trigger after
+ *              DAC_EVENT_CONVERT_COMPLETE, then the timer stops.
  * @param[in]   data  Pointer to buffer with data to transfer to DAC Interface
  * @param[in]   num   Number of data items to send
  * @return      \ref execution_status
@@ -331,8 +412,11 @@ static
 int32_t DAC_Convert(const void *data, uint32_t num, const DAC_RESOURCES *dac)
 {
   DAC_INFO *info;
+  DAC_TRANSFER_INFO *xfer;
+  DAC_DMA *dma;
+  uint32_t cfg, paddr, dmaen;
 
-  if ((data == NULL) || (num == 0U))
+  if ((data == NULL) || (num == 0U) || (num > DAC_DMA_MAX_ITEMS))
     return (ARM_DRIVER_ERROR_PARAMETER);
 
   info = dac->info;
@@ -340,24 +424,119 @@ int32_t DAC_Convert(const void *data, uint32_t num, const DAC_RESOURCES *dac)
   if ((info->state & DAC_CONFIGURED) == 0U || DriverCapabilities.trigger == 0U)
     return (ARM_DRIVER_ERROR);
 
+  if ((info->mode & DAC_CONTROL_Msk) != DAC_MODE_HARDWARE_TRIGGER)
+    return (DAC_ERROR_MODE);
+
   if (info->status.busy)
     return (ARM_DRIVER_ERROR_BUSY);
 
-  /* TODO Implement function */
+  cfg = DMA_MEMORY_TO_PERIPHERAL | DMA_MEMORY_INCREMENT |
+        DMA_HALF_TRANSFER_INTERRUPT | DMA_TRANSFER_COMPLETE_INTERRUPT;
+
+  /* Select DMA channel and data holding register */
+  switch (info->mode & DAC_OUTPUT_CHANNEL_Msk) {
+    case DAC_OUTPUT_CHANNEL_1:
+      dma   = dac->ch1_dma;
+      dmaen = DAC_CR_DMAEN1;
+      switch (info->mode & DAC_DATA_FORMAT_Msk) {
+        case DAC_DATA_FORMAT_12R:
+          paddr = (uint32_t)&dac->reg->DHR12R1;
+          cfg  |= DMA_PERIPHERAL_DATA_16BIT | DMA_MEMORY_DATA_16BIT;
+          break;
+        case DAC_DATA_FORMAT_12L:
+          paddr = (uint32_t)&dac->reg->DHR12L1;
+          cfg  |= DMA_PERIPHERAL_DATA_16BIT | DMA_MEMORY_DATA_16BIT;
+          break;
+        default:
+          paddr = (uint32_t)&dac->reg->DHR8R1;
+          cfg  |= DMA_PERIPHERAL_DATA_8BIT | DMA_MEMORY_DATA_8BIT;
+          break;
+      }
+      break;
+    case DAC_OUTPUT_CHANNEL_2:
+      dma   = dac->ch2_dma;
+      dmaen = DAC_CR_DMAEN2;
+      switch (info->mode & DAC_DATA_FORMAT_Msk) {
+        case DAC_DATA_FORMAT_12R:
+          paddr = (uint32_t)&dac->reg->DHR12R2;
+          cfg  |= DMA_PERIPHERAL_DATA_16BIT | DMA_MEMORY_DATA_16BIT;
+          break;
+        case DAC_DATA_FORMAT_12L:
+          paddr = (uint32_t)&dac->reg->DHR12L2;
+          cfg  |= DMA_PERIPHERAL_DATA_16BIT | DMA_MEMORY_DATA_16BIT;
+          break;
+        default:
+          paddr = (uint32_t)&dac->reg->DHR8R2;
+          cfg  |= DMA_PERIPHERAL_DATA_8BIT | DMA_MEMORY_DATA_8BIT;
+          break;
+      }
+      break;
+    default:
+      /* Both channels share one trigger, channel 1 DMA feeds dual registers */
+      dma   = dac->ch1_dma;
+      dmaen = DAC_CR_DMAEN1;
+      switch (info->mode & DAC_DATA_FORMAT_Msk) {
+        case DAC_DATA_FORMAT_12R:
+          paddr = (uint32_t)&dac->reg->DHR12RD;
+          cfg  |= DMA_PERIPHERAL_DATA_32BIT | DMA_MEMORY_DATA_32BIT;
+          break;
+        case DAC_DATA_FORMAT_12L:
+          paddr = (uint32_t)&dac->reg->DHR12LD;
+          cfg  |= DMA_PERIPHERAL_DATA_32BIT | DMA_MEMORY_DATA_32BIT;
+          break;
+        default:
+          paddr = (uint32_t)&dac->reg->DHR8RD;
+          cfg  |= DMA_PERIPHERAL_DATA_16BIT | DMA_MEMORY_DATA_16BIT;
+          break;
+      }
+      break;
+  }
+
+  if (dma == NULL)
+    return (ARM_DRIVER_ERROR);
+
+  if ((info->mode & DAC_TRANSFER_MODE_Msk) == DAC_TRANSFER_CIRCULAR)
+    cfg |= DMA_CIRCULAR_MODE;
+
+  xfer = dac->xfer;
+  xfer->buf = data;
+  xfer->num = num;
+  xfer->cnt = 0U;
+  xfer->dma = dma;
+
+  info->status.busy = 1U;
+
+  /* Configure and enable DMA channel */
+  cfg |= DMA_PRIORITY(dma->priority);
+  DMA_ChannelConfigure(dma->instance, cfg, paddr, (uint32_t)data, (uint16_t)num);
+  DMA_ChannelEnable(dma->instance);
+
+  /* Enable DAC DMA requests */
+  dac->reg->CR |= dmaen;
+
+  /* Start trigger timer */
+  dac->trigger->reg->CNT = 0U;
+  dac->trigger->reg->CR1 = (dac->trigger->reg->CR1 & ~TIM_CR1_OPM) | TIM_CR1_CEN;
 
   return (ARM_DRIVER_OK);
 }
 
 /**
  * @fn          uint32_t DAC_GetCount(const DAC_RESOURCES *dac)
- * @brief       Get transferred data count.
+ * @brief       Get transferred data count. In circular mode returns the
+ *              position inside the data buffer.
  * @return      number of data items transferred
  */
 static
 uint32_t DAC_GetCount(const DAC_RESOURCES *dac)
 {
-  /* TODO Implement function */
-  return 0UL;
+  DAC_TRANSFER_INFO *xfer = dac->xfer;
+  DAC_DMA *dma = xfer->dma;
+
+  if (dma != NULL)
+    return (xfer->num - DMA_ChannelTransferItemCount(dma->instance));
+
+  return (xfer->cnt);
 }
 
 /**
@@ -378,6 +557,8 @@ int32_t DAC_Control(uint32_t control, uint32_t arg, const DAC_RESOURCES *dac)
     return (ARM_DRIVER_ERROR);
 
   if ((control & DAC_CONTROL_Msk) == DAC_ABORT_CONVERT) {
+    if (info->status.busy)
+      StopTransfer(dac, 0U);
     return (ARM_DRIVER_OK);
   }
 
@@ -412,10 +593,15 @@ int32_t DAC_Control(uint32_t control, uint32_t arg, const DAC_RESOURCES *dac)
         case RCC_PERIPH_TIM7:
           val = DAC_TRIGGER_TIM7;
           break;
+        default:
+          return (DAC_ERROR_MODE);
       }
 
+      /* Configure trigger timer for sample rate in arg */
+      if (TriggerConfig(dac->trigger, arg) != ARM_DRIVER_OK)
+        return (ARM_DRIVER_ERROR_PARAMETER);
+
       dac_cr |= (DAC_CR_TEN1 | val);
-      /* TODO Add timer initialization */
       break;
 
     case DAC_SET_VALUE:
@@ -499,7 +685,16 @@ int32_t DAC_Control(uint32_t control, uint32_t arg, const DAC_RESOURCES *dac)
       return (DAC_ERROR_DATA_FORMAT);
   }
 
-  info->mode = mode;
+  /* Transfer mode */
+  switch (control & DAC_TRANSFER_MODE_Msk) {
+    case DAC_TRANSFER_SINGLE:
+      break;
+    case DAC_TRANSFER_CIRCULAR:
+      mode |= DAC_TRANSFER_CIRCULAR;
+      break;
+    default:
+      return (DAC_ERROR_TRANSFER_MODE);
+  }
 
   /* Enable DAC */
   switch (control & DAC_OUTPUT_CHANNEL_Msk) {
@@ -519,6 +714,7 @@ int32_t DAC_Control(uint32_t control, uint32_t arg, const DAC_RESOURCES *dac)
   /* Configure registers */
   dac->reg->CR = val;
 
+  info->mode   = mode | (control & DAC_OUTPUT_CHANNEL_Msk);
   info->state |= DAC_CONFIGURED;
 
   return (ARM_DRIVER_OK);
@@ -539,6 +735,35 @@ DAC_STATUS DAC_GetStatus(const DAC_RESOURCES *dac)
   return status;
 }
 
+/**
+ * @fn          void DAC_DMA_Event(uint32_t events, const DAC_RESOURCES *dac)
+ * @brief       DAC DMA channel event handler.
+ * @param[in]   events  DMA channel events
+ */
+static
+void DAC_DMA_Event(uint32_t events, const DAC_RESOURCES *dac)
+{
+  DAC_INFO *info = dac->info;
+  uint32_t event = 0U;
+
+  /* Conversion aborted */
+  if (info->status.busy == 0U)
+    return;
+
+  if (events & DMA_CHANNEL_HALF_TRANSFER)
+    event |= DAC_EVENT_HALF_COMPLETE;
+
+  if (events & DMA_CHANNEL_TRANSFER_COMPLETE) {
+    /* Last item is loaded into DHR, it is output on the next trigger */
+    if ((info->mode & DAC_TRANSFER_MODE_Msk) != DAC_TRANSFER_CIRCULAR)
+      StopTransfer(dac, 1U);
+    event |= DAC_EVENT_CONVERT_COMPLETE;
+  }
+
+  if ((event != 0U) && (info->cb_event != NULL))
+    info->cb_event(event);
+}
+
 /* DAC1 */
 #if defined(USE_DAC1)
 static
@@ -583,6 +808,20 @@ DAC_STATUS DAC1_GetStatus(void)
   return DAC_GetStatus(&DAC1_Resources);
 }
 
+#ifdef DAC1_CH1_DMA_Instance
+void DAC1_CH1_DMA_Handler(uint32_t events)
+{
+  DAC_DMA_Event(events, &DAC1_Resources);
+}
+#endif
+
+#ifdef DAC1_CH2_DMA_Instance
+void DAC1_CH2_DMA_Handler(uint32_t events)
+{
+  DAC_DMA_Event(events, &DAC1_Resources);
+}
+#endif
+
 DRIVER_DAC Driver_DAC1 = {
   DACx_GetVersion,
   DACx_GetCapabilities,
@@ -56,6 +56,9 @@
 #define DAC_TRIGGER_TIM7              (2UL << DAC_CR_TSEL1_Pos)
 #define DAC_TRIGGER_SOFTWARE          (7UL << DAC_CR_TSEL1_Pos)
 
+/* Maximum number of items for one DMA transfer */
+#define DAC_DMA_MAX_ITEMS             (0xFFFFUL)
+
 /* DAC configuration definitions */
 #if (RTE_DAC1 == 1)
   #define USE_DAC1
@@ -71,7 +74,12 @@
 
   #if (RTE_DAC1_CH2_DMA == 1)
     #define DAC1_CH2_DMA_Instance    DMAx_CHANNELy(RTE_DAC1_CH2_DMA_NUMBER, RTE_DAC1_CH2_DMA_CHANNEL)
-    #define DAC1_CH2_DMA_IRQn        DMAx_CHANNELy_IRQn(RTE_DAC1_CH2_DMA_NUMBER, RTE_DAC1_CH2_DMA_CHANNEL)
+    #if (RTE_DAC1_CH2_DMA_NUMBER == 2) && !defined(STM32F105xC) && !defined(STM32F107xC)
+      /* DMA2 Channel4 and Channel5 share one interrupt line */
+      #define DAC1_CH2_DMA_IRQn      DMA2_Channel4_5_IRQn
+    #else
+      #define DAC1_CH2_DMA_IRQn      DMAx_CHANNELy_IRQn(RTE_DAC1_CH2_DMA_NUMBER, RTE_DAC1_CH2_DMA_CHANNEL)
+    #endif
     #define DAC1_CH2_DMA_Channel     RTE_DAC1_CH2_DMA_CHANNEL
     #define DAC1_CH2_DMA_Priority    RTE_DAC1_CH2_DMA_PRIORITY
 
@@ -144,8 +152,9 @@ typedef struct _DAC_INFO {
 /* DAC Transfer Information (Run-Time) */
 typedef struct _DAC_TRANSFER_INFO {
   uint32_t              num;            /* Total number of transfers */
-  uint32_t             *buf;            /* Pointer to data buffer    */
+  const void           *buf;            /* Pointer to data buffer    */
   uint32_t              cnt;            /* Number of data sent       */
+  DAC_DMA              *dma;            /* Active DMA channel        */
 } DAC_TRANSFER_INFO;
 
 typedef const struct _DAC_TRIGGER {
@@ -35,10 +35,11 @@ extern "C"
  *  defines and macros (scope: module-local)
  ******************************************************************************/
 
-#define DAC_API_VERSION   ARM_DRIVER_VERSION_MAJOR_MINOR(1,0)  /* API version */
+#define DAC_API_VERSION   ARM_DRIVER_VERSION_MAJOR_MINOR(1,1)  /* API version */
 
 /* DAC Event */
 #define DAC_EVENT_CONVERT_COMPLETE    (1UL << 0)  ///< Data Convert completed
+#define DAC_EVENT_HALF_COMPLETE       (1UL << 1)  ///< First half of data buffer converted
 
 /*----- DAC Control Codes ----------------------------------------------------*/
 #define DAC_CONTROL_Pos               (0U)
@@ -47,7 +48,7 @@ extern "C"
 /*----- DAC Control Codes: Mode -----*/
 #define DAC_MODE_NO_TRIGGER           (0UL << DAC_CONTROL_Pos)
 #define DAC_MODE_SOFTWARE_TRIGGER     (1UL << DAC_CONTROL_Pos)
-#define DAC_MODE_HARDWARE_TRIGGER     (2UL << DAC_CONTROL_Pos)
+#define DAC_MODE_HARDWARE_TRIGGER     (2UL << DAC_CONTROL_Pos)   ///< arg = Sample rate in Hz
 
 /*----- DAC Control Codes: Mode Parameters: Output Channel -----*/
 #define DAC_OUTPUT_CHANNEL_Pos        (4U)
@@ -69,6 +70,12 @@ extern "C"
 #define DAC_DATA_FORMAT_12L           (1UL << DAC_DATA_FORMAT_Pos)
 #define DAC_DATA_FORMAT_8R            (2UL << DAC_DATA_FORMAT_Pos)
 
+/*----- DAC Control Codes: Mode Parameters: Transfer Mode -----*/
+#define DAC_TRANSFER_MODE_Pos         (12U)
+#define DAC_TRANSFER_MODE_Msk         (1UL << DAC_TRANSFER_MODE_Pos)
+#define DAC_TRANSFER_SINGLE           (0UL << DAC_TRANSFER_MODE_Pos)  ///< Stop after the data buffer is converted (default)
+#define DAC_TRANSFER_CIRCULAR         (1UL << DAC_TRANSFER_MODE_Pos)  ///< Restart from the beginning of the data buffer until aborted
+
 /*----- DAC Control Codes: Miscellaneous Controls  -----*/
 #define DAC_SET_VALUE                 (3UL << DAC_CONTROL_Pos)
 #define DAC_ABORT_CONVERT             (4UL << DAC_CONTROL_Pos)
@@ -78,6 +85,7 @@ extern "C"
 #define DAC_ERROR_DATA_FORMAT         (ARM_DRIVER_ERROR_SPECIFIC - 2)     ///< Specified Data Format not supported
 #define DAC_ERROR_OUTPUT_CHANNEL      (ARM_DRIVER_ERROR_SPECIFIC - 3)     ///< Specified Output Channel not supported
 #define DAC_ERROR_OUTPUT_BUFFER       (ARM_DRIVER_ERROR_SPECIFIC - 4)     ///< Specified Output Buffer not supported
+#define DAC_ERROR_TRANSFER_MODE       (ARM_DRIVER_ERROR_SPECIFIC - 5)     ///< Specified Transfer Mode not supported
 
 /*******************************************************************************
  *  typedefs and structures (scope: module-local)
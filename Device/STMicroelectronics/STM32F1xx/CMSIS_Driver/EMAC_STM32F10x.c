@@ -62,14 +62,15 @@
 
 #include "EMAC_STM32F10x.h"
 #include "GPIO_STM32F10x.h"
+#include "CRC32_STM32F10x.h"
 
 #define ARM_ETH_MAC_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(2,1) /* driver version */
 
 
 /* ETH Memory Buffer configuration */
-#define NUM_RX_BUF          4U          /* 0x1800 for Rx (4*1536=6K)          */
-#define NUM_TX_BUF          2U          /* 0x0C00 for Tx (2*1536=3K)          */
-#define ETH_BUF_SIZE        1536U       /* ETH Receive/Transmit buffer size   */
+#define NUM_RX_BUF          ((uint32_t)RTE_ETH_NUM_RX_BUF)  /* Number of Rx buffers    */
+#define NUM_TX_BUF          ((uint32_t)RTE_ETH_NUM_TX_BUF)  /* Number of Tx buffers    */
+#define ETH_BUF_SIZE        ((uint32_t)RTE_ETH_BUF_SIZE)    /* Rx/Tx buffer size       */
 
 /* Interrupt Handler Prototype */
 void ETH_IRQHandler (void);
@@ -138,10 +139,10 @@ static const ARM_ETH_MAC_CAPABILITIES DriverCapabilities = {
 static EMAC_CTRL Emac;
 static uint32_t  PhyTimeout;
 
-static RX_Desc   rx_desc[NUM_RX_BUF];
-static TX_Desc   tx_desc[NUM_TX_BUF];
-static uint32_t  rx_buf [NUM_RX_BUF][ETH_BUF_SIZE>>2];
-static uint32_t  tx_buf [NUM_TX_BUF][ETH_BUF_SIZE>>2];
+static RX_Desc   rx_desc[NUM_RX_BUF]                  ETH_DMA_MEM;
+static TX_Desc   tx_desc[NUM_TX_BUF]                  ETH_DMA_MEM;
+static uint32_t  rx_buf [NUM_RX_BUF][ETH_BUF_SIZE>>2] ETH_DMA_MEM;
+static uint32_t  tx_buf [NUM_TX_BUF][ETH_BUF_SIZE>>2] ETH_DMA_MEM;
 
 
 /**
@@ -185,44 +186,68 @@ static void init_tx_desc (void) {
 }
 
 /**
-  \fn          uint32_t crc32_8bit_rev (uint32_t crc32, uint8_t val)
-  \brief       Calculate 32-bit CRC (Polynomial: 0x04C11DB7, data bit-reversed).
-  \param[in]   crc32  CRC initial value
-  \param[in]   val    Input value
-  \return      Calculated CRC value
+  \fn          void update_missed (void)
+  \brief       Accumulate missed frame counters into driver statistics.
+  \return      none.
 */
-static uint32_t crc32_8bit_rev (uint32_t crc32, uint8_t val) {
-  uint32_t n;
-
-  crc32 ^= __RBIT (val);
-  for (n = 8; n; n--) {
-    if (crc32 & 0x80000000U) {
-      crc32 <<= 1;
-      crc32  ^= 0x04C11DB7U;
-    } else {
-      crc32 <<= 1;
-    }
-  }
-  return (crc32);
+static void update_missed (void) {
+  uint32_t val;
+
+  /* Counters are cleared on read */
+  val = ETH->DMAMFBOCR;
+  Emac.stats.rx_missed   += (val & ETH_DMAMFBOCR_MFC) >> ETH_DMAMFBOCR_MFC_Pos;
+  Emac.stats.rx_overflow += (val & ETH_DMAMFBOCR_MFA) >> ETH_DMAMFBOCR_MFA_Pos;
 }
 
 /**
-  \fn          uint32_t crc32_data (const uint8_t *data, uint32_t len)
-  \brief       Calculate standard 32-bit Ethernet CRC.
-  \param[in]   data  Pointer to buffer containing the data
-  \param[in]   len   Data length in bytes
-  \return      Calculated CRC value
+  \fn          void rx_release (uint32_t idx)
+  \brief       Return Rx DMA descriptor back to ETH-DMA.
+  \param[in]   idx  Descriptor index
+  \return      none.
 */
-static uint32_t crc32_data (const uint8_t *data, uint32_t len) {
-  uint32_t cnt, crc;
+static void rx_release (uint32_t idx) {
 
-  crc = 0xFFFFFFFFU;
-  for (cnt = len; cnt; cnt--) {
-    crc = crc32_8bit_rev (crc, *data++);
+  rx_desc[idx].Stat = DMA_RX_OWN;
+  Emac.stats.rx_frames++;
+
+  if (ETH->DMASR & ETH_DMASR_RBUS) {
+    /* Receive buffer unavailable, resume DMA */
+    ETH->DMASR   = ETH_DMASR_RBUS;
+    ETH->DMARPDR = 0;
+    Emac.stats.rx_resume++;
+    update_missed ();
   }
-  return (crc ^ 0xFFFFFFFFU);
 }
 
+/**
+  \fn          void tx_start (uint32_t flags)
+  \brief       Hand current Tx DMA descriptor to ETH-DMA and start transmission.
+  \param[in]   flags  Frame transmit flags (see ARM_ETH_MAC_TX_FRAME_...)
+  \return      none.
+*/
+static void tx_start (uint32_t flags) {
+  uint32_t ctrl;
+
+  ctrl = tx_desc[Emac.tx_index].CtrlStat & ~DMA_TX_CIC;
+#if (EMAC_CHECKSUM_OFFLOAD != 0)
+  if (Emac.tx_cks_offload) { ctrl |= DMA_TX_CIC; }
+#endif
+  ctrl &= ~(DMA_TX_IC | DMA_TX_TTSE);
+  ctrl |=   DMA_TX_FS | DMA_TX_LS;
+  if (flags & ARM_ETH_MAC_TX_FRAME_EVENT)     { ctrl |= DMA_TX_IC; }
+#if (EMAC_TIME_STAMP != 0)
+  if (flags & ARM_ETH_MAC_TX_FRAME_TIMESTAMP) { ctrl |= DMA_TX_TTSE; }
+  Emac.tx_ts_index = Emac.tx_index;
+#endif
+  tx_desc[Emac.tx_index].CtrlStat = ctrl | DMA_TX_OWN;
+
+  Emac.tx_index++;
+  if (Emac.tx_index == NUM_TX_BUF) { Emac.tx_index = 0U; }
+
+  /* Start frame transmission */
+  ETH->DMASR   = ETH_DMASR_TPSS;
+  ETH->DMATPDR = 0U;
+}
 
 /* Ethernet Driver functions */
 
@@ -353,7 +378,7 @@ static int32_t PowerControl (ARM_POWER_STATE state) {
       __ETHMACPTP_CLK_DISABLE();
       #endif
 
-      Emac.flags &= ~EMAC_FLAG_POWER;
+      Emac.flags &= ~(EMAC_FLAG_POWER | EMAC_FLAG_TX_LOAN | EMAC_FLAG_RX_POLL);
       break;
 
     case ARM_POWER_LOW:
@@ -426,6 +451,8 @@ static int32_t PowerControl (ARM_POWER_STATE state) {
       NVIC_ClearPendingIRQ (ETH_IRQn);
       NVIC_EnableIRQ (ETH_IRQn);
 
+      memset (&Emac.stats, 0, sizeof (EMAC_STATS));
+      Emac.rx_loan   = 0U;
       Emac.frame_end = NULL;
       Emac.flags    |= EMAC_FLAG_POWER;
       break;
@@ -552,7 +579,7 @@ static int32_t SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_
 
   /* Calculate 64-bit Hash table for remaining MAC addresses */
   for ( ; num_addr; ptr_addr++, num_addr--) {
-    crc = crc32_data (&ptr_addr->b[0], 6U) >> 26;
+    crc = __RBIT (CRC32_Calculate (&ptr_addr->b[0], 6U)) >> 26;
     if (crc & 0x20U) {
       ETH->MACHTHR |= (1U << (crc & 0x1FU));
     }
@@ -576,7 +603,6 @@ static int32_t SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_
 */
 static int32_t SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
   uint8_t *dst = Emac.frame_end;
-  uint32_t ctrl;
 
   if ((frame == NULL) || (len == 0U)) {
     return ARM_DRIVER_ERROR_PARAMETER;
@@ -586,12 +612,18 @@ static int32_t SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
     return ARM_DRIVER_ERROR;
   }
 
+  if (Emac.flags & EMAC_FLAG_TX_LOAN) {
+    /* Transmit buffer is lent to application */
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
   if (dst == NULL) {
     /* Start of a new transmit frame */
     if (tx_desc[Emac.tx_index].CtrlStat & DMA_TX_OWN) {
       /* Transmitter is busy, wait */
       return ARM_DRIVER_ERROR_BUSY;
     }
+    tx_desc[Emac.tx_index].Addr = (uint8_t *)&tx_buf[Emac.tx_index];
     dst = tx_desc[Emac.tx_index].Addr;
     tx_desc[Emac.tx_index].Size = len;
   }
@@ -617,26 +649,9 @@ static int32_t SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
   }
 
   /* Frame is now ready, send it to DMA */
-  ctrl = tx_desc[Emac.tx_index].CtrlStat & ~DMA_TX_CIC;
-#if (EMAC_CHECKSUM_OFFLOAD != 0)
-  if (Emac.tx_cks_offload) { ctrl |= DMA_TX_CIC; }
-#endif
-  ctrl &= ~(DMA_TX_IC | DMA_TX_TTSE);
-  if (flags & ARM_ETH_MAC_TX_FRAME_EVENT)     { ctrl |= DMA_TX_IC; }
-#if (EMAC_TIME_STAMP != 0)
-  if (flags & ARM_ETH_MAC_TX_FRAME_TIMESTAMP) { ctrl |= DMA_TX_TTSE; }
-  Emac.tx_ts_index = Emac.tx_index;
-#endif
-  tx_desc[Emac.tx_index].CtrlStat = ctrl | DMA_TX_OWN;
-
-  Emac.tx_index++;
-  if (Emac.tx_index == NUM_TX_BUF) { Emac.tx_index = 0U; }
+  tx_start (flags);
   Emac.frame_end = NULL;
 
-  /* Start frame transmission */
-  ETH->DMASR   = ETH_DMASR_TPSS;
-  ETH->DMATPDR = 0U;
-
   return ARM_DRIVER_OK;
 }
 
@@ -661,6 +676,11 @@ static int32_t ReadFrame (uint8_t *frame, uint32_t len) {
     return ARM_DRIVER_ERROR;
   }
 
+  if (Emac.rx_loan & (1ULL << Emac.rx_index)) {
+    /* Receive buffer is lent to application */
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
   /* Fast-copy data to frame buffer */
   for ( ; len > 7U; frame += 8, src += 8, len -= 8U) {
     ((__packed uint32_t *)frame)[0] = ((uint32_t *)src)[0];
@@ -673,16 +693,11 @@ static int32_t ReadFrame (uint8_t *frame, uint32_t len) {
   if (len > 0U) { frame[0] = src[0]; }
 
   /* Return this block back to ETH-DMA */
-  rx_desc[Emac.rx_index].Stat = DMA_RX_OWN;
+  rx_release (Emac.rx_index);
 
   Emac.rx_index++;
   if (Emac.rx_index == NUM_RX_BUF) { Emac.rx_index = 0; }
 
-  if (ETH->DMASR & ETH_DMASR_RBUS) {
-    /* Receive buffer unavailable, resume DMA */
-    ETH->DMASR   = ETH_DMASR_RBUS;
-    ETH->DMARPDR = 0;
-  }
   return (cnt);
 }
 
@@ -702,6 +717,10 @@ static uint32_t GetRxFrameSize (void) {
     /* Owned by DMA */
     return (0U);
   }
+  if (Emac.rx_loan & (1ULL << Emac.rx_index)) {
+    /* Lent to application, not yet released */
+    return (0U);
+  }
   if (((stat & DMA_RX_ES) != 0) ||
       ((stat & DMA_RX_FS) == 0) ||
       ((stat & DMA_RX_LS) == 0)) {
@@ -1045,14 +1064,323 @@ static int32_t PHY_Write (uint8_t phy_addr, uint8_t reg_addr, uint16_t data) {
 }
 
 
+/**
+  \fn          int32_t EMAC_GetStatistics (EMAC_STATS *stats)
+  \brief       Get Ethernet MAC driver statistics.
+  \param[out]  stats  Pointer to statistics structure for data to read into
+  \return      \ref execution_status
+*/
+int32_t EMAC_GetStatistics (EMAC_STATS *stats) {
+
+  if (stats == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  update_missed ();
+  *stats = Emac.stats;
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t EMAC_AcquireRxFrame (uint8_t **frame)
+  \brief       Lend the DMA buffer of the received Ethernet frame to the
+               application without copying. The buffer must be handed back
+               with \ref EMAC_ReleaseRxFrame. Frame time stamp must be read
+               before the frame is acquired.
+  \param[out]  frame  Pointer where the frame buffer address is written to
+  \return      number of data bytes in frame or execution status
+                 - value >= 0: number of data bytes in frame
+                 - value < 0: error occurred, value is execution status as defined with \ref execution_status
+*/
+int32_t EMAC_AcquireRxFrame (uint8_t **frame) {
+  uint32_t size;
+
+  if (frame == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  size = GetRxFrameSize ();
+  if (size == 0U) {
+    /* No frame available */
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+  if (size == 0xFFFFFFFFU) {
+    /* Invalid frame, discard it with ReadFrame */
+    return ARM_DRIVER_ERROR;
+  }
+
+  *frame = (uint8_t *)rx_desc[Emac.rx_index].Addr;
+  Emac.rx_loan |= (1ULL << Emac.rx_index);
+
+  Emac.rx_index++;
+  if (Emac.rx_index == NUM_RX_BUF) { Emac.rx_index = 0; }
+
+  return ((int32_t)size);
+}
+
+/**
+  \fn          int32_t EMAC_ReleaseRxFrame (const uint8_t *frame)
+  \brief       Hand the frame buffer lent by \ref EMAC_AcquireRxFrame back to ETH-DMA.
+               Buffers may be released in any order.
+  \param[in]   frame  Frame buffer address returned by \ref EMAC_AcquireRxFrame
+  \return      \ref execution_status
+*/
+int32_t EMAC_ReleaseRxFrame (const uint8_t *frame) {
+  uint32_t idx;
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  idx = ((uint32_t)frame - (uint32_t)&rx_buf[0]) / sizeof(rx_buf[0]);
+  if ((idx >= NUM_RX_BUF) || (frame != rx_desc[idx].Addr) ||
+      ((Emac.rx_loan & (1ULL << idx)) == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  Emac.rx_loan &= ~(1ULL << idx);
+  rx_release (idx);
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t EMAC_AcquireTxBuffer (uint8_t **buf)
+  \brief       Lend the DMA buffer of the next free transmit descriptor to the
+               application. The frame is built in place and sent with
+               \ref EMAC_CommitTxFrame.
+  \param[out]  buf  Pointer where the buffer address is written to
+  \return      buffer size in bytes or execution status
+                 - value > 0: buffer size in bytes
+                 - value < 0: error occurred, value is execution status as defined with \ref execution_status
+*/
+int32_t EMAC_AcquireTxBuffer (uint8_t **buf) {
+
+  if (buf == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_TX_LOAN) || (Emac.frame_end != NULL) ||
+      (tx_desc[Emac.tx_index].CtrlStat & DMA_TX_OWN)) {
+    /* Buffer already lent, fragments pending or transmitter busy */
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  tx_desc[Emac.tx_index].Addr = (uint8_t *)&tx_buf[Emac.tx_index];
+  *buf = tx_desc[Emac.tx_index].Addr;
+  Emac.flags |= EMAC_FLAG_TX_LOAN;
+
+  return ((int32_t)ETH_BUF_SIZE);
+}
+
+/**
+  \fn          int32_t EMAC_CommitTxFrame (uint32_t len, uint32_t flags)
+  \brief       Send Ethernet frame built in the buffer lent by \ref EMAC_AcquireTxBuffer.
+  \param[in]   len    Frame length in bytes (0 cancels the transmission)
+  \param[in]   flags  Frame transmit flags (see ARM_ETH_MAC_TX_FRAME_...)
+  \return      \ref execution_status
+*/
+int32_t EMAC_CommitTxFrame (uint32_t len, uint32_t flags) {
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_TX_LOAN) == 0U) {
+    /* No buffer lent */
+    return ARM_DRIVER_ERROR;
+  }
+
+  if ((len > ETH_BUF_SIZE) || (flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  Emac.flags &= ~EMAC_FLAG_TX_LOAN;
+
+  if (len != 0U) {
+    tx_desc[Emac.tx_index].Size = len;
+    tx_start (flags);
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t EMAC_SendFrameSG (const EMAC_TX_FRAG *frag, uint32_t num, uint32_t flags)
+  \brief       Send Ethernet frame composed of fragments without copying.
+               Each fragment is transmitted from its own chained descriptor,
+               so fragment data must stay valid until the frame is sent.
+  \param[in]   frag   Pointer to array of frame fragments
+  \param[in]   num    Number of fragments (1 .. number of Tx buffers)
+  \param[in]   flags  Frame transmit flags (see ARM_ETH_MAC_TX_FRAME_...)
+  \return      \ref execution_status
+*/
+int32_t EMAC_SendFrameSG (const EMAC_TX_FRAG *frag, uint32_t num, uint32_t flags) {
+  uint32_t i, idx, first, ctrl, ctrl_first;
+
+  if ((frag == NULL) || (num == 0U) || (num > NUM_TX_BUF) ||
+      (flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if ((Emac.flags & EMAC_FLAG_TX_LOAN) || (Emac.frame_end != NULL)) {
+    /* Buffer lent or fragments pending */
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  /* Check fragments and availability of descriptors */
+  idx = Emac.tx_index;
+  for (i = 0U; i < num; i++) {
+    if ((frag[i].data == NULL) || (frag[i].len == 0U) || (frag[i].len > DMA_RX_TBS1)) {
+      return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    if (tx_desc[idx].CtrlStat & DMA_TX_OWN) {
+      /* Transmitter is busy, wait */
+      return ARM_DRIVER_ERROR_BUSY;
+    }
+    idx++;
+    if (idx == NUM_TX_BUF) { idx = 0U; }
+  }
+
+  /* Build descriptor chain, first descriptor is handed to DMA last */
+  first      = Emac.tx_index;
+  ctrl_first = 0U;
+  idx        = first;
+  for (i = 0U; i < num; i++) {
+    ctrl = DMA_TX_TCH;
+    if (i == 0U) {
+      ctrl |= DMA_TX_FS;
+#if (EMAC_CHECKSUM_OFFLOAD != 0)
+      if (Emac.tx_cks_offload) { ctrl |= DMA_TX_CIC; }
+#endif
+#if (EMAC_TIME_STAMP != 0)
+      if (flags & ARM_ETH_MAC_TX_FRAME_TIMESTAMP) { ctrl |= DMA_TX_TTSE; }
+#endif
+    }
+    if (i == (num - 1U)) {
+      ctrl |= DMA_TX_LS;
+      if (flags & ARM_ETH_MAC_TX_FRAME_EVENT) { ctrl |= DMA_TX_IC; }
+#if (EMAC_TIME_STAMP != 0)
+      Emac.tx_ts_index = (uint8_t)idx;
+#endif
+    }
+    tx_desc[idx].Addr = (uint8_t *)frag[i].data;
+    tx_desc[idx].Size = frag[i].len;
+    if (i == 0U) {
+      ctrl_first = ctrl;
+    }
+    else {
+      tx_desc[idx].CtrlStat = ctrl | DMA_TX_OWN;
+    }
+    idx++;
+    if (idx == NUM_TX_BUF) { idx = 0U; }
+  }
+  tx_desc[first].CtrlStat = ctrl_first | DMA_TX_OWN;
+  Emac.tx_index = (uint8_t)idx;
+
+  /* Start frame transmission */
+  ETH->DMASR   = ETH_DMASR_TPSS;
+  ETH->DMATPDR = 0U;
+
+  return ARM_DRIVER_OK;
+}
+
+
+/**
+  \fn          int32_t EMAC_SetRxPolling (bool enable)
+  \brief       Enable or disable receive polling mode. In polling mode the
+               receive interrupt is masked after the first RX event and the
+               application drains the ring, then re-arms the interrupt with
+               \ref EMAC_RxPollComplete.
+  \param[in]   enable  true = polling mode, false = interrupt per frame
+  \return      \ref execution_status
+*/
+int32_t EMAC_SetRxPolling (bool enable) {
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (enable) {
+    Emac.flags |= EMAC_FLAG_RX_POLL;
+  }
+  else {
+    Emac.flags &= ~EMAC_FLAG_RX_POLL;
+    ETH->DMAIER |= ETH_DMAIER_RIE;
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn          int32_t EMAC_RxPollComplete (void)
+  \brief       End a receive polling round. Re-arms the receive interrupt when
+               the ring is empty; otherwise the application must keep polling.
+  \return      \ref execution_status
+                 - \ref ARM_DRIVER_OK: ring empty, receive interrupt re-armed
+                 - \ref ARM_DRIVER_ERROR_BUSY: frames pending, continue polling
+*/
+int32_t EMAC_RxPollComplete (void) {
+
+  if ((Emac.flags & EMAC_FLAG_POWER) == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if ((ETH->DMAIER & ETH_DMAIER_RIE) != 0U) {
+    /* Interrupt already armed */
+    return ARM_DRIVER_OK;
+  }
+
+  /* Clear stale receive status, then check the ring */
+  ETH->DMASR = ETH_DMASR_RS;
+  if (GetRxFrameSize () != 0U) {
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  /* Frame received after the check raises the interrupt at once */
+  ETH->DMAIER |= ETH_DMAIER_RIE;
+  Emac.stats.rx_rearm++;
+
+  return ARM_DRIVER_OK;
+}
+
+
 /* Ethernet IRQ Handler */
 void ETH_IRQHandler (void) {
   uint32_t dmasr, macsr, event = 0;
 
   dmasr = ETH->DMASR;
+  if ((ETH->DMAIER & ETH_DMAIER_RIE) == 0U) {
+    /* Receive polled, leave RS pending for EMAC_RxPollComplete */
+    dmasr &= ~ETH_DMASR_RS;
+  }
   ETH->DMASR = dmasr & (ETH_DMASR_NIS | ETH_DMASR_RS | ETH_DMASR_TS);
   if (dmasr & ETH_DMASR_TS)   { event |= ARM_ETH_MAC_EVENT_TX_FRAME; }
-  if (dmasr & ETH_DMASR_RS)   { event |= ARM_ETH_MAC_EVENT_RX_FRAME; }
+  if (dmasr & ETH_DMASR_RS) {
+    event |= ARM_ETH_MAC_EVENT_RX_FRAME;
+    Emac.stats.rx_irq++;
+    if (Emac.flags & EMAC_FLAG_RX_POLL) {
+      /* Mask receive interrupt until the ring is drained */
+      ETH->DMAIER &= ~ETH_DMAIER_RIE;
+    }
+  }
   macsr = ETH->MACSR;
 #if (EMAC_TIME_STAMP != 0)
   if (macsr & ETH_MACSR_TSTS) { event |= ARM_ETH_MAC_EVENT_TIMER_ALARM; }
@@ -53,6 +53,23 @@
 #error "HCLK too slow for Ethernet! Check settings in RTE_Device.h!"
 #endif
 
+/* DMA descriptor ring configuration */
+#if ((RTE_ETH_NUM_RX_BUF < 2) || (RTE_ETH_NUM_RX_BUF > 64) || \
+     (RTE_ETH_NUM_TX_BUF < 2) || (RTE_ETH_NUM_TX_BUF > 64))
+#error "Ethernet DMA descriptor count in RTE_Device.h is invalid!"
+#endif
+
+#if ((RTE_ETH_BUF_SIZE < 1524) || (RTE_ETH_BUF_SIZE > 8188) || ((RTE_ETH_BUF_SIZE & 3) != 0))
+#error "Ethernet DMA buffer size in RTE_Device.h is invalid!"
+#endif
+
+/* DMA descriptor and buffer memory placement */
+#if (RTE_ETH_DMA_SECTION)
+#define ETH_DMA_MEM     __attribute__((section(RTE_ETH_DMA_SECTION_NAME)))
+#else
+#define ETH_DMA_MEM
+#endif
+
 #define ETH_MDC_GPIOx        RTE_ETH_MDI_MDC_PORT
 #define ETH_MDC_GPIO_Pin     RTE_ETH_MDI_MDC_PIN
 #define ETH_MDIO_GPIOx       RTE_ETH_MDI_MDIO_PORT
@@ -116,6 +133,8 @@
 /* EMAC Driver state flags */
 #define EMAC_FLAG_INIT      (1 << 0)    // Driver initialized
 #define EMAC_FLAG_POWER     (1 << 1)    // Driver power on
+#define EMAC_FLAG_TX_LOAN   (1 << 2)    // Transmit buffer lent to application
+#define EMAC_FLAG_RX_POLL   (1 << 3)    // Receive polling mode enabled
 
 /* PTP subsecond increment value */
 #define PTPSSIR_Val(hclk)     ((0x7FFFFFFFU + (hclk)/2U) / (hclk))
@@ -206,12 +225,28 @@ typedef struct tx_desc {
 #endif
 } TX_Desc;
 
+/* EMAC Transmit Fragment */
+typedef struct {
+  const uint8_t *data;                  // Fragment data
+  uint32_t       len;                   // Fragment length in bytes
+} EMAC_TX_FRAG;
+
 /* EMAC Pin Descriptor */
 typedef struct _ETH_PIN {
   GPIO_TypeDef *port;
   uint16_t      pin;
 } ETH_PIN;
 
+/* EMAC Driver Statistics */
+typedef struct {
+  uint32_t      rx_frames;              // Frames released back to DMA
+  uint32_t      rx_resume;              // Stalled receive DMA resumed
+  uint32_t      rx_missed;              // Frames missed, no free descriptor
+  uint32_t      rx_overflow;            // Frames missed, receive FIFO overflow
+  uint32_t      rx_irq;                 // Receive interrupts signalled
+  uint32_t      rx_rearm;               // Receive interrupt re-armed after polling
+} EMAC_STATS;
+
 /* EMAC Driver Control Information */
 typedef struct {
   ARM_ETH_MAC_SignalEvent_t cb_event;   // Event callback
@@ -225,6 +260,18 @@ typedef struct {
   uint8_t       tx_ts_index;            // Transmit Timestamp descriptor index
 #endif
   uint8_t      *frame_end;              // End of assembled frame fragments
+  uint64_t      rx_loan;                // Receive buffers lent to application
+  EMAC_STATS    stats;                  // Driver statistics
 } EMAC_CTRL;
 
+/* Driver extension functions */
+extern int32_t EMAC_GetStatistics   (EMAC_STATS *stats);
+extern int32_t EMAC_AcquireRxFrame  (uint8_t **frame);
+extern int32_t EMAC_ReleaseRxFrame  (const uint8_t *frame);
+extern int32_t EMAC_AcquireTxBuffer (uint8_t **buf);
+extern int32_t EMAC_CommitTxFrame   (uint32_t len, uint32_t flags);
+extern int32_t EMAC_SendFrameSG     (const EMAC_TX_FRAG *frag, uint32_t num, uint32_t flags);
+extern int32_t EMAC_SetRxPolling    (bool enable);
+extern int32_t EMAC_RxPollComplete  (void);
+
 #endif /* __EMAC_STM32F10X_H */
@@ -43,6 +43,14 @@ typedef struct {
   uint32_t mask;
 } Reg_Mask_t;
 
+/* Clock tree snapshot */
+typedef struct {
+  uint32_t sysclk;
+  uint32_t hclk;
+  uint32_t pclk1;
+  uint32_t pclk2;
+} Clocks_t;
+
 /*******************************************************************************
  *  global variable definitions  (scope: module-exported)
  ******************************************************************************/
@@ -57,6 +65,16 @@ uint8_t AHBPrescTable[16] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 7, 8, 9};
 static const
 uint8_t APBPrescTable[8] = {0, 0, 0, 0, 1, 2, 3, 4};
 
+/* Clock tree generation, starts at 1 so zeroed driver caches are stale */
+static volatile uint32_t ClockGeneration = 1U;
+
+/* Clock tree snapshot and the generation it was taken for */
+static Clocks_t ClockSnapshot;
+static uint32_t SnapshotGeneration;
+
+/* Clock change subscribers */
+static RCC_ClockSubscriber_t *ClockSubscribers;
+
 #if defined(STM32F105xC) || defined(STM32F107xC)
   static const
   uint8_t pllmul_tbl[16] = {0, 0, 4, 5, 6, 7, 8, 9, 0, 0, 0, 0, 0, 13, 0, 0};
@@ -95,6 +113,82 @@ void GetClockEnableReg(RCC_Periph_t periph, Reg_Mask_t *param)
   }
 }
 
+/**
+ * @fn          void ClockSnapshotUpdate(void)
+ * @brief       Decode RCC registers into the clock tree snapshot.
+ */
+static
+void ClockSnapshotUpdate(void)
+{
+  uint32_t sysclk, hclk;
+  uint32_t rcc_cfgr = RCC->CFGR;
+  uint32_t gen = ClockGeneration;
+
+  /* Get SYSCLK Frequency ----------------------------------------------------*/
+  switch (rcc_cfgr & RCC_CFGR_SWS) {
+    default: /* HSI used as system clock */
+    case RCC_CFGR_SWS_HSI:  /* HSI used as system clock */
+      sysclk = RTE_HSI;
+      break;
+
+    case RCC_CFGR_SWS_HSE:  /* HSE used as system clock */
+      sysclk = RTE_HSE;
+      break;
+
+    case RCC_CFGR_SWS_PLL:  /* PLL used as system clock */
+    {
+      uint32_t pllm, prediv;
+
+      pllm = pllmul_tbl[(rcc_cfgr & RCC_CFGR_PLLMULL_Msk) >> RCC_CFGR_PLLMULL_Pos];
+
+      if ((rcc_cfgr & RCC_CFGR_PLLSRC) == 0U) {
+        /* HSI used as PLL clock source : PLLCLK = HSI/2 * PLLMUL */
+        sysclk = (RTE_HSI >> 1U) * pllm;
+      }
+      else {
+#if defined(STM32F105xC) || defined(STM32F107xC)
+        uint32_t rcc_cfgr2 = RCC->CFGR2;
+
+        prediv = ((rcc_cfgr2 & RCC_CFGR2_PREDIV1_Msk) >> RCC_CFGR2_PREDIV1_Pos) +1U;
+
+        if ((rcc_cfgr2 & RCC_CFGR2_PREDIV1SRC) == 0U) {
+          /* HSE used as PLL clock source : PLLCLK = HSE/PREDIV1 * PLLMUL */
+          sysclk = RTE_HSE * pllm / prediv;
+        }
+        else {
+          /* PLL2 selected as Prediv1 source */
+          /* PLLCLK = PLL2CLK / PREDIV1 * PLLMUL with PLL2CLK = HSE/PREDIV2 * PLL2MUL */
+          uint32_t prediv2 = ((rcc_cfgr2 & RCC_CFGR2_PREDIV2) >> RCC_CFGR2_PREDIV2_Pos) + 1U;
+          uint32_t pll2m = pllmul2_tbl[(rcc_cfgr2 & RCC_CFGR2_PLL2MUL) >> RCC_CFGR2_PLL2MUL_Pos];
+          sysclk = (uint32_t)(((uint64_t)RTE_HSE * (uint64_t)pll2m * (uint64_t)pllm) / ((uint64_t)prediv2 * (uint64_t)prediv));
+        }
+#elif defined(STM32F100xB) || defined(STM32F100xE)
+        /* HSE used as PLL clock source : PLLCLK = HSE/PREDIV1 * PLLMUL */
+        prediv = ((RCC->CFGR2 & RCC_CFGR2_PREDIV1_Msk) >> RCC_CFGR2_PREDIV1_Pos) + 1U;
+        sysclk = RTE_HSE * pllm / prediv;
+#else
+        /* HSE used as PLL clock source : PLLCLK = HSE/PREDIV1 * PLLMUL */
+        prediv = ((rcc_cfgr & RCC_CFGR_PLLXTPRE_Msk) >> RCC_CFGR_PLLXTPRE_Pos) +1U;
+        sysclk = RTE_HSE * pllm / prediv;
+#endif
+      }
+      break;
+    }
+  }
+
+  ClockSnapshot.sysclk = sysclk;
+
+  /* Compute HCLK clock frequency --------------------------------------------*/
+  hclk = (sysclk >> AHBPrescTable[(rcc_cfgr & RCC_CFGR_HPRE_Msk) >> RCC_CFGR_HPRE_Pos]);
+  ClockSnapshot.hclk = hclk;
+
+  /* Compute PCLK clock frequency --------------------------------------------*/
+  ClockSnapshot.pclk1 = (hclk >> APBPrescTable[(rcc_cfgr & RCC_CFGR_PPRE1_Msk) >> RCC_CFGR_PPRE1_Pos]);
+  ClockSnapshot.pclk2 = (hclk >> APBPrescTable[(rcc_cfgr & RCC_CFGR_PPRE2_Msk) >> RCC_CFGR_PPRE2_Pos]);
+
+  SnapshotGeneration = gen;
+}
+
 /*******************************************************************************
  *  function implementations (scope: module-exported)
  ******************************************************************************/
@@ -142,6 +236,8 @@ void RCC_ClkReset(void)
   /* Disable all interrupts and clear pending bits  */
   RCC->CIR = 0x009F0000;
 #endif
+
+  RCC_ClockChanged();
 }
 
 /**
@@ -216,6 +312,8 @@ void RCC_OscInit(const RCC_OscInit_t *init)
       while ((RCC->CR & RCC_CR_PLLRDY) == 0U);
     }
   }
+
+  RCC_ClockChanged();
 }
 
 /**
@@ -266,92 +364,111 @@ void RCC_ClkInit(const RCC_ClkInit_t *init, uint32_t flash_latency)
 
   /* Enable Prefetch buffer */
   FLASH->ACR |= FLASH_ACR_PRFTBE;
+
+  RCC_ClockChanged();
 }
 
 /**
  * @fn        uint32_t RCC_GetFreq(RCC_FREQ_t type)
- * @brief     Get Clock Frequency
+ * @brief     Get Clock Frequency from the clock tree snapshot
  * @param[in] type  @ref RCC_FREQ_t
  * @return    Returns clock frequency in Hz
  */
 uint32_t RCC_GetFreq(RCC_FREQ_t type)
 {
+  if (SnapshotGeneration != ClockGeneration)
+    ClockSnapshotUpdate();
+
   switch (type) {
     case RCC_FREQ_HSI:
       return RTE_HSI;
     case RCC_FREQ_HSE:
       return RTE_HSE;
+    case RCC_FREQ_SYSCLK:
+      return ClockSnapshot.sysclk;
+    case RCC_FREQ_AHB:
+      return ClockSnapshot.hclk;
+    case RCC_FREQ_APB1:
+      return ClockSnapshot.pclk1;
+    default:
+      return ClockSnapshot.pclk2;
   }
+}
 
-  uint32_t sysclk;
-  uint32_t rcc_cfgr = RCC->CFGR;
+/**
+ * @fn          void RCC_ClockChanged(void)
+ * @brief       Notify drivers that the clock tree has been changed. Called by
+ *              the RCC configuration functions, must be called by code that
+ *              changes RCC clock settings directly. The clock tree snapshot
+ *              is refreshed before the subscribers are called.
+ */
+void RCC_ClockChanged(void)
+{
+  RCC_ClockSubscriber_t *sub;
 
-  /* Get SYSCLK Frequency ----------------------------------------------------*/
-  switch (rcc_cfgr & RCC_CFGR_SWS) {
-    default: /* HSI used as system clock */
-    case RCC_CFGR_SWS_HSI:  /* HSI used as system clock */
-      sysclk = RTE_HSI;
-      break;
+  ClockGeneration++;
 
-    case RCC_CFGR_SWS_HSE:  /* HSE used as system clock */
-      sysclk = RTE_HSE;
-      break;
+  /* Skip 0, which marks a driver cache as never filled */
+  if (ClockGeneration == 0U)
+    ClockGeneration = 1U;
 
-    case RCC_CFGR_SWS_PLL:  /* PLL used as system clock */
-    {
-      uint32_t pllm, prediv;
+  ClockSnapshotUpdate();
 
-      pllm = pllmul_tbl[(rcc_cfgr & RCC_CFGR_PLLMULL_Msk) >> RCC_CFGR_PLLMULL_Pos];
-
-      if ((rcc_cfgr & RCC_CFGR_PLLSRC) == 0U) {
-        /* HSI used as PLL clock source : PLLCLK = HSI/2 * PLLMUL */
-        sysclk = (RTE_HSI >> 1U) * pllm;
-      }
-      else {
-#if defined(STM32F105xC) || defined(STM32F107xC)
-        uint32_t rcc_cfgr2 = RCC->CFGR2;
+  for (sub = ClockSubscribers; sub != NULL; sub = sub->next) {
+    sub->cb_event(RCC_CLOCK_EVENT_CHANGED, sub->arg);
+  }
+}
 
-        prediv = ((rcc_cfgr2 & RCC_CFGR2_PREDIV1_Msk) >> RCC_CFGR2_PREDIV1_Pos) +1U;
+/**
+ * @fn          uint32_t RCC_GetClockGeneration(void)
+ * @brief       Get clock tree generation. Drivers keep the generation their
+ *              cached clock dividers were computed for and recompute them
+ *              once when it differs.
+ * @return      Clock tree generation, never 0
+ */
+uint32_t RCC_GetClockGeneration(void)
+{
+  return ClockGeneration;
+}
 
-        if ((rcc_cfgr2 & RCC_CFGR2_PREDIV1SRC) == 0U) {
-          /* HSE used as PLL clock source : PLLCLK = HSE/PREDIV1 * PLLMUL */
-          sysclk = RTE_HSE * pllm / prediv;
-        }
-        else {
-          /* PLL2 selected as Prediv1 source */
-          /* PLLCLK = PLL2CLK / PREDIV1 * PLLMUL with PLL2CLK = HSE/PREDIV2 * PLL2MUL */
-          uint32_t prediv2 = ((rcc_cfgr2 & RCC_CFGR2_PREDIV2) >> RCC_CFGR2_PREDIV2_Pos) + 1U;
-          uint32_t pll2m = pllmul2_tbl[(rcc_cfgr2 & RCC_CFGR2_PLL2MUL) >> RCC_CFGR2_PLL2MUL_Pos];
-          sysclk = (uint32_t)(((uint64_t)RTE_HSE * (uint64_t)pll2m * (uint64_t)pllm) / ((uint64_t)prediv2 * (uint64_t)prediv));
-        }
-#elif defined(STM32F100xB) || defined(STM32F100xE)
-        /* HSE used as PLL clock source : PLLCLK = HSE/PREDIV1 * PLLMUL */
-        prediv = ((RCC->CFGR2 & RCC_CFGR2_PREDIV1_Msk) >> RCC_CFGR2_PREDIV1_Pos) + 1U;
-        sysclk = RTE_HSE * pllm / prediv;
-#else
-        /* HSE used as PLL clock source : PLLCLK = HSE/PREDIV1 * PLLMUL */
-        prediv = ((rcc_cfgr & RCC_CFGR_PLLXTPRE_Msk) >> RCC_CFGR_PLLXTPRE_Pos) +1U;
-        sysclk = RTE_HSE * pllm / prediv;
-#endif
-      }
-      break;
-    }
-  }
+/**
+ * @fn          void RCC_ClockSubscribe(RCC_ClockSubscriber_t *sub)
+ * @brief       Register callback invoked after each clock tree change.
+ * @param[in]   sub  Pointer to subscriber with cb_event and arg set,
+ *                   must stay valid until unsubscribed
+ */
+void RCC_ClockSubscribe(RCC_ClockSubscriber_t *sub)
+{
+  RCC_ClockSubscriber_t *it;
 
-  if (type == RCC_FREQ_SYSCLK)
-    return sysclk;
+  if ((sub == NULL) || (sub->cb_event == NULL))
+    return;
 
-  /* Compute HCLK clock frequency --------------------------------------------*/
-  uint32_t hclk = (sysclk >> AHBPrescTable[(rcc_cfgr & RCC_CFGR_HPRE_Msk) >> RCC_CFGR_HPRE_Pos]);
+  for (it = ClockSubscribers; it != NULL; it = it->next) {
+    if (it == sub)
+      return;
+  }
 
-  if (type == RCC_FREQ_AHB)
-    return hclk;
+  sub->next = ClockSubscribers;
+  ClockSubscribers = sub;
+}
 
-  /* Compute PCLK clock frequency --------------------------------------------*/
-  if (type == RCC_FREQ_APB1)
-    return (hclk >> APBPrescTable[(rcc_cfgr & RCC_CFGR_PPRE1_Msk) >> RCC_CFGR_PPRE1_Pos]);
+/**
+ * @fn          void RCC_ClockUnsubscribe(RCC_ClockSubscriber_t *sub)
+ * @brief       Remove clock change callback.
+ * @param[in]   sub  Pointer to subscriber
+ */
+void RCC_ClockUnsubscribe(RCC_ClockSubscriber_t *sub)
+{
+  RCC_ClockSubscriber_t **it;
 
-  return (hclk >> APBPrescTable[(rcc_cfgr & RCC_CFGR_PPRE2_Msk) >> RCC_CFGR_PPRE2_Pos]);
+  for (it = &ClockSubscribers; *it != NULL; it = &(*it)->next) {
+    if (*it == sub) {
+      *it = sub->next;
+      sub->next = NULL;
+      break;
+    }
+  }
 }
 
 /**
@@ -24,6 +24,7 @@
  *  includes
  ******************************************************************************/
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*******************************************************************************
@@ -153,6 +154,9 @@
 #define RCC_PERIPH_APB1_MASK            (0x81013600)
 #define RCC_PERIPH_APB2_MASK            (0xFFC00002)
 
+/* Clock change events */
+#define RCC_CLOCK_EVENT_CHANGED         (1UL << 0)    /* Clock tree has been changed */
+
 /*******************************************************************************
  *  typedefs and structures
  ******************************************************************************/
@@ -341,6 +345,15 @@ typedef struct RCC_ClkInit_s {
   uint32_t APB2_clk_div;
 } RCC_ClkInit_t;
 
+typedef void (*RCC_ClockEvent_t)(uint32_t event, void *arg);
+
+/* Clock change subscriber, storage owned by the subscriber */
+typedef struct RCC_ClockSubscriber_s {
+  RCC_ClockEvent_t cb_event;
+  void *arg;
+  struct RCC_ClockSubscriber_s *next;
+} RCC_ClockSubscriber_t;
+
 /*******************************************************************************
  *  exported variables
  ******************************************************************************/
@@ -377,9 +390,42 @@ void RCC_OscInit(const RCC_OscInit_t *init);
  */
 void RCC_ClkInit(const RCC_ClkInit_t *init, uint32_t flash_latency);
 
+/**
+ * @fn          void RCC_ClockChanged(void)
+ * @brief       Notify drivers that the clock tree has been changed. Called by
+ *              the RCC configuration functions, must be called by code that
+ *              changes RCC clock settings directly. The clock tree snapshot
+ *              is refreshed before the subscribers are called.
+ */
+void RCC_ClockChanged(void);
+
+/**
+ * @fn          uint32_t RCC_GetClockGeneration(void)
+ * @brief       Get clock tree generation. Drivers keep the generation their
+ *              cached clock dividers were computed for and recompute them
+ *              once when it differs.
+ * @return      Clock tree generation, never 0
+ */
+uint32_t RCC_GetClockGeneration(void);
+
+/**
+ * @fn          void RCC_ClockSubscribe(RCC_ClockSubscriber_t *sub)
+ * @brief       Register callback invoked after each clock tree change.
+ * @param[in]   sub  Pointer to subscriber with cb_event and arg set,
+ *                   must stay valid until unsubscribed
+ */
+void RCC_ClockSubscribe(RCC_ClockSubscriber_t *sub);
+
+/**
+ * @fn          void RCC_ClockUnsubscribe(RCC_ClockSubscriber_t *sub)
+ * @brief       Remove clock change callback.
+ * @param[in]   sub  Pointer to subscriber
+ */
+void RCC_ClockUnsubscribe(RCC_ClockSubscriber_t *sub);
+
 /**
  * @fn        uint32_t RCC_GetFreq(RCC_FREQ_t type)
- * @brief     Get Clock Frequency
+ * @brief     Get Clock Frequency from the clock tree snapshot
  * @param[in] type  @ref RCC_FREQ_t
  * @return    Returns clock frequency in Hz
  */
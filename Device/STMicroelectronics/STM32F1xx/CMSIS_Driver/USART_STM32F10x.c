@@ -112,6 +112,13 @@ static USART_TRANSFER_INFO USART1_TransferInfo = {0};
   };
 #endif
 
+#ifdef USART1_RX_FIFO_SIZE
+  static uint8_t    USART1_RxFifoBuf[USART1_RX_FIFO_SIZE];
+  static uint8_t    USART1_TxFifoBuf[USART1_TX_FIFO_SIZE];
+  static USART_FIFO USART1_RxFifo = {USART1_RxFifoBuf, USART1_RX_FIFO_SIZE, 0U, 0U};
+  static USART_FIFO USART1_TxFifo = {USART1_TxFifoBuf, USART1_TX_FIFO_SIZE, 0U, 0U};
+#endif
+
 /* USART1 Resources */
 static const USART_RESOURCES USART1_Resources = {
   {     // Capabilities
@@ -203,6 +210,13 @@ static const USART_RESOURCES USART1_Resources = {
   &USART1_DMA_Rx,
 #else
   NULL,
+#endif
+#ifdef USART1_RX_FIFO_SIZE
+  &USART1_RxFifo,
+  &USART1_TxFifo,
+#else
+  NULL,
+  NULL,
 #endif
   &USART1_Info,
   &USART1_TransferInfo
@@ -250,6 +264,13 @@ static USART_TRANSFER_INFO USART2_TransferInfo = {0};
   };
 #endif
 
+#ifdef USART2_RX_FIFO_SIZE
+  static uint8_t    USART2_RxFifoBuf[USART2_RX_FIFO_SIZE];
+  static uint8_t    USART2_TxFifoBuf[USART2_TX_FIFO_SIZE];
+  static USART_FIFO USART2_RxFifo = {USART2_RxFifoBuf, USART2_RX_FIFO_SIZE, 0U, 0U};
+  static USART_FIFO USART2_TxFifo = {USART2_TxFifoBuf, USART2_TX_FIFO_SIZE, 0U, 0U};
+#endif
+
 /* USART2 Resources */
 static const USART_RESOURCES USART2_Resources = {
   {     // Capabilities
@@ -341,6 +362,13 @@ static const USART_RESOURCES USART2_Resources = {
   &USART2_DMA_Rx,
 #else
   NULL,
+#endif
+#ifdef USART2_RX_FIFO_SIZE
+  &USART2_RxFifo,
+  &USART2_TxFifo,
+#else
+  NULL,
+  NULL,
 #endif
   &USART2_Info,
   &USART2_TransferInfo
@@ -388,6 +416,13 @@ static USART_TRANSFER_INFO USART3_TransferInfo = {0};
   };
 #endif
 
+#ifdef USART3_RX_FIFO_SIZE
+  static uint8_t    USART3_RxFifoBuf[USART3_RX_FIFO_SIZE];
+  static uint8_t    USART3_TxFifoBuf[USART3_TX_FIFO_SIZE];
+  static USART_FIFO USART3_RxFifo = {USART3_RxFifoBuf, USART3_RX_FIFO_SIZE, 0U, 0U};
+  static USART_FIFO USART3_TxFifo = {USART3_TxFifoBuf, USART3_TX_FIFO_SIZE, 0U, 0U};
+#endif
+
 /* USART3 Resources */
 static const USART_RESOURCES USART3_Resources = {
   {     // Capabilities
@@ -479,6 +514,13 @@ static const USART_RESOURCES USART3_Resources = {
   &USART3_DMA_Rx,
 #else
   NULL,
+#endif
+#ifdef USART3_RX_FIFO_SIZE
+  &USART3_RxFifo,
+  &USART3_TxFifo,
+#else
+  NULL,
+  NULL,
 #endif
   &USART3_Info,
   &USART3_TransferInfo
@@ -516,6 +558,13 @@ static USART_TRANSFER_INFO UART4_TransferInfo = {0};
   };
 #endif
 
+#ifdef UART4_RX_FIFO_SIZE
+  static uint8_t    UART4_RxFifoBuf[UART4_RX_FIFO_SIZE];
+  static uint8_t    UART4_TxFifoBuf[UART4_TX_FIFO_SIZE];
+  static USART_FIFO UART4_RxFifo = {UART4_RxFifoBuf, UART4_RX_FIFO_SIZE, 0U, 0U};
+  static USART_FIFO UART4_TxFifo = {UART4_TxFifoBuf, UART4_TX_FIFO_SIZE, 0U, 0U};
+#endif
+
 /* UART4 Resources */
 static const USART_RESOURCES USART4_Resources = {
   {     // Capabilities
@@ -571,6 +620,13 @@ static const USART_RESOURCES USART4_Resources = {
   &UART4_DMA_Rx,
 #else
   NULL,
+#endif
+#ifdef UART4_RX_FIFO_SIZE
+  &UART4_RxFifo,
+  &UART4_TxFifo,
+#else
+  NULL,
+  NULL,
 #endif
   &UART4_Info,
   &UART4_TransferInfo
@@ -609,6 +665,13 @@ static USART_TRANSFER_INFO UART5_TransferInfo = {0};
   };
 #endif
 
+#ifdef UART5_RX_FIFO_SIZE
+  static uint8_t    UART5_RxFifoBuf[UART5_RX_FIFO_SIZE];
+  static uint8_t    UART5_TxFifoBuf[UART5_TX_FIFO_SIZE];
+  static USART_FIFO UART5_RxFifo = {UART5_RxFifoBuf, UART5_RX_FIFO_SIZE, 0U, 0U};
+  static USART_FIFO UART5_TxFifo = {UART5_TxFifoBuf, UART5_TX_FIFO_SIZE, 0U, 0U};
+#endif
+
 // UART5 Resources
 static const USART_RESOURCES USART5_Resources = {
   {     // Capabilities
@@ -664,6 +727,13 @@ static const USART_RESOURCES USART5_Resources = {
   &UART5_DMA_Rx,
 #else
   NULL,
+#endif
+#ifdef UART5_RX_FIFO_SIZE
+  &UART5_RxFifo,
+  &UART5_TxFifo,
+#else
+  NULL,
+  NULL,
 #endif
   &UART5_Info,
   &UART5_TransferInfo
@@ -674,6 +744,90 @@ static const USART_RESOURCES USART5_Resources = {
  *  function implementations (scope: module-local)
  ******************************************************************************/
 
+#ifdef __USART_FIFO
+/**
+ * @fn          uint32_t USART_FifoCount(USART_FIFO *fifo)
+ * @brief       Get number of bytes stored in FIFO.
+ * @param[in]   fifo  Pointer to FIFO
+ * @return      number of bytes stored
+ */
+__STATIC_INLINE
+uint32_t USART_FifoCount(USART_FIFO *fifo)
+{
+  return (fifo->head - fifo->tail);
+}
+
+/**
+ * @fn          uint32_t USART_FifoPut(USART_FIFO *fifo, const uint8_t *data, uint32_t num)
+ * @brief       Copy data into FIFO. Called by the producer only.
+ * @param[in]   fifo  Pointer to FIFO
+ * @param[in]   data  Pointer to data to store
+ * @param[in]   num   Number of bytes to store
+ * @return      number of bytes stored
+ */
+static
+uint32_t USART_FifoPut(USART_FIFO *fifo, const uint8_t *data, uint32_t num)
+{
+  uint32_t head = fifo->head;
+  uint32_t idx, n;
+
+  n = fifo->size - (head - fifo->tail);
+  if (num > n) {
+    num = n;
+  }
+
+  idx = head & (fifo->size - 1U);
+  n = fifo->size - idx;
+  if (n > num) {
+    n = num;
+  }
+
+  memcpy(&fifo->buf[idx], data, n);
+  memcpy(&fifo->buf[0], &data[n], num - n);
+
+  /* Data must be visible before the write index moves */
+  __DMB();
+  fifo->head = head + num;
+
+  return (num);
+}
+
+/**
+ * @fn          uint32_t USART_FifoGet(USART_FIFO *fifo, uint8_t *data, uint32_t num)
+ * @brief       Copy data out of FIFO. Called by the consumer only.
+ * @param[in]   fifo  Pointer to FIFO
+ * @param[out]  data  Pointer to buffer for data
+ * @param[in]   num   Number of bytes to fetch
+ * @return      number of bytes fetched
+ */
+static
+uint32_t USART_FifoGet(USART_FIFO *fifo, uint8_t *data, uint32_t num)
+{
+  uint32_t tail = fifo->tail;
+  uint32_t idx, n;
+
+  n = fifo->head - tail;
+  if (num > n) {
+    num = n;
+  }
+
+  idx = tail & (fifo->size - 1U);
+  n = fifo->size - idx;
+  if (n > num) {
+    n = num;
+  }
+
+  memcpy(data, &fifo->buf[idx], n);
+  memcpy(&data[n], &fifo->buf[0], num - n);
+
+  /* Data must be copied out before the slots are released */
+  __DMB();
+  fifo->tail = tail + num;
+
+  return (num);
+}
+#endif
+
 /**
  * @fn          void PinConfig(const USART_PIN *io, const GPIO_PIN_CFG_t *pin_cfg)
  * @brief       Configure Pin
@@ -784,6 +938,25 @@ int32_t USART_Uninitialize(const USART_RESOURCES *usart)
   return (ARM_DRIVER_OK);
 }
 
+/**
+ * @fn          void USART_ClockEvent(uint32_t event, void *arg)
+ * @brief       Recompute baud rate divider after a clock tree change.
+ * @param[in]   event  \ref RCC_CLOCK_EVENT_CHANGED
+ * @param[in]   arg    Pointer to USART resources
+ */
+static
+void USART_ClockEvent(uint32_t event, void *arg)
+{
+  const USART_RESOURCES *usart = (const USART_RESOURCES *)arg;
+  USART_INFO *info = usart->info;
+
+  if ((event & RCC_CLOCK_EVENT_CHANGED) == 0U)
+    return;
+
+  if (((info->flags & USART_FLAG_CONFIGURED) != 0U) && (info->baudrate != 0U))
+    usart->reg->BRR = USART_BAUDRATE_DIVIDER(RCC_GetPeriphFreq(usart->periph), info->baudrate);
+}
+
 /**
  * @fn          int32_t USART_PowerControl(ARM_POWER_STATE state)
  * @brief       Control USART Interface Power.
@@ -813,6 +986,9 @@ int32_t USART_PowerControl(ARM_POWER_STATE state, const USART_RESOURCES *usart)
       /* Disable USART clock */
       RCC_DisablePeriph(usart->periph);
 
+      /* Stop following clock changes */
+      RCC_ClockUnsubscribe(&info->clk_sub);
+
       /* Clear Status flags */
       info->status.tx_busy = 0U;
       info->status.rx_busy = 0U;
@@ -823,6 +999,14 @@ int32_t USART_PowerControl(ARM_POWER_STATE state, const USART_RESOURCES *usart)
       info->status.rx_parity_error = 0U;
       xfer->send_active = 0U;
 
+#ifdef __USART_FIFO
+      /* Flush software FIFOs */
+      if (usart->rx_fifo != NULL) {
+        usart->rx_fifo->head = usart->rx_fifo->tail = 0U;
+        usart->tx_fifo->head = usart->tx_fifo->tail = 0U;
+      }
+#endif
+
       info->flags &= ~USART_FLAG_POWERED;
       break;
 
@@ -848,12 +1032,26 @@ int32_t USART_PowerControl(ARM_POWER_STATE state, const USART_RESOURCES *usart)
       xfer->break_flag = 0U;
       info->mode = 0U;
       info->flow_control = 0U;
+      info->baudrate = 0U;
+
+#ifdef __USART_FIFO
+      /* Flush software FIFOs */
+      if (usart->rx_fifo != NULL) {
+        usart->rx_fifo->head = usart->rx_fifo->tail = 0U;
+        usart->tx_fifo->head = usart->tx_fifo->tail = 0U;
+      }
+#endif
 
       info->flags |= USART_FLAG_POWERED;
 
       /* Enable USART clock */
       RCC_EnablePeriph(usart->periph);
 
+      /* Keep baud rate across clock changes */
+      info->clk_sub.cb_event = USART_ClockEvent;
+      info->clk_sub.arg = (void *)((uint32_t)usart);
+      RCC_ClockSubscribe(&info->clk_sub);
+
       /* Clear and Enable USART IRQ */
       NVIC_ClearPendingIRQ(usart->irq_num);
       NVIC_SetPriority(usart->irq_num, RTE_SPI_INT_PRIORITY);
@@ -912,6 +1110,13 @@ int32_t USART_Send(const void *data, uint32_t num, const USART_RESOURCES *usart)
     return ARM_DRIVER_ERROR_BUSY;
   }
 
+#ifdef __USART_FIFO
+  if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U)) {
+    /* Data queued by Write is not transmitted yet */
+    return (ARM_DRIVER_ERROR_BUSY);
+  }
+#endif
+
   cr1 = reg->CR1;
 
   /* Set Send active flag */
@@ -1026,11 +1231,36 @@ int32_t USART_Receive(void *data, uint32_t num, const USART_RESOURCES *usart)
   xfer->rx_buf = (uint8_t *)data;
   xfer->rx_cnt = 0U;
 
+  cr1 = reg->CR1;
+
+#ifdef __USART_FIFO
+  /* Hand over data already collected in the receive FIFO */
+  if ((usart->rx_fifo != NULL) && (info->mode != ARM_USART_MODE_SYNCHRONOUS_MASTER)) {
+    uint32_t sz = (((cr1 & USART_CR1_PCE) == 0U) && ((cr1 & USART_CR1_M) != 0U)) ? 2U : 1U;
+    uint32_t cnt = USART_FifoCount(usart->rx_fifo) / sz;
+
+    if (cnt > num) {
+      cnt = num;
+    }
+
+    USART_FifoGet(usart->rx_fifo, xfer->rx_buf, cnt * sz);
+    xfer->rx_buf += cnt * sz;
+    xfer->rx_cnt = cnt;
+
+    if (cnt == num) {
+      /* Request completely served from FIFO */
+      reg->CR1 = cr1 | USART_CR1_RXNEIE;
+      if (info->cb_event) {
+        info->cb_event(ARM_USART_EVENT_RECEIVE_COMPLETE);
+      }
+      return (ARM_DRIVER_OK);
+    }
+  }
+#endif
+
   /* Set RX busy flag */
   info->status.rx_busy = 1U;
 
-  cr1 = reg->CR1;
-
 #ifdef __USART_DMA_RX
 
   cfg = DMA_MEMORY_INCREMENT;
@@ -1053,7 +1283,7 @@ int32_t USART_Receive(void *data, uint32_t num, const USART_RESOURCES *usart)
       cfg |= DMA_PERIPHERAL_DATA_16BIT | DMA_MEMORY_DATA_16BIT;
     }
 
-    DMA_ChannelConfigure(usart->dma_rx->instance, cfg, (uint32_t)(&reg->DR), (uint32_t)data, num);
+    DMA_ChannelConfigure(usart->dma_rx->instance, cfg, (uint32_t)(&reg->DR), (uint32_t)xfer->rx_buf, num - xfer->rx_cnt);
     DMA_ChannelEnable(usart->dma_rx->instance);
 
     reg->CR3 |= USART_CR3_DMAR;
@@ -1222,6 +1452,12 @@ int32_t USART_Control(uint32_t control, uint32_t arg, const USART_RESOURCES *usa
           /* Clear break and Send Active flag */
           xfer->break_flag = 0U;
           xfer->send_active = 0U;
+#ifdef __USART_FIFO
+          /* Resume transmission of data queued by Write */
+          if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U)) {
+            reg->CR1 |= USART_CR1_TXEIE;
+          }
+#endif
         }
       }
       return (ARM_DRIVER_OK);
@@ -1240,6 +1476,13 @@ int32_t USART_Control(uint32_t control, uint32_t arg, const USART_RESOURCES *usa
         DMA_ChannelDisable(usart->dma_tx->instance);
       }
 
+#ifdef __USART_FIFO
+      /* Discard data queued by Write */
+      if (usart->tx_fifo != NULL) {
+        usart->tx_fifo->tail = usart->tx_fifo->head;
+      }
+#endif
+
       /* Clear break flag */
       xfer->break_flag = 0U;
       /* Clear Send active flag */
@@ -1262,6 +1505,13 @@ int32_t USART_Control(uint32_t control, uint32_t arg, const USART_RESOURCES *usa
 
       /* Clear RX busy status */
       info->status.rx_busy = 0U;
+
+#ifdef __USART_FIFO
+      /* Keep collecting received data into receive FIFO */
+      if ((usart->rx_fifo != NULL) && ((info->flags & USART_FLAG_RX_ENABLED) != 0U)) {
+        reg->CR1 |= USART_CR1_RXNEIE;
+      }
+#endif
       return (ARM_DRIVER_OK);
 
     /* Abort transfer */
@@ -1287,9 +1537,23 @@ int32_t USART_Control(uint32_t control, uint32_t arg, const USART_RESOURCES *usa
         DMA_ChannelDisable(usart->dma_rx->instance);
       }
 
+#ifdef __USART_FIFO
+      /* Discard data queued by Write */
+      if (usart->tx_fifo != NULL) {
+        usart->tx_fifo->tail = usart->tx_fifo->head;
+      }
+#endif
+
       /* Clear busy statuses */
       info->status.rx_busy = 0U;
       xfer->send_active = 0U;
+
+#ifdef __USART_FIFO
+      /* Keep collecting received data into receive FIFO */
+      if ((usart->rx_fifo != NULL) && ((info->flags & USART_FLAG_RX_ENABLED) != 0U)) {
+        reg->CR1 |= USART_CR1_RXNEIE;
+      }
+#endif
       return (ARM_DRIVER_OK);
 
     /* Control TX */
@@ -1651,6 +1915,7 @@ int32_t USART_Control(uint32_t control, uint32_t arg, const USART_RESOURCES *usa
 
   /* Configure Baud rate register */
   reg->BRR = val;
+  info->baudrate = arg;
 
   /* Configuration is OK - Mode is valid */
   info->mode = mode;
@@ -1771,6 +2036,11 @@ ARM_USART_STATUS USART_GetStatus(const USART_RESOURCES *usart)
   if (usart->xfer->send_active != 0U) {
     status.tx_busy = 1U;
   }
+#ifdef __USART_FIFO
+  else if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U)) {
+    status.tx_busy = 1U;
+  }
+#endif
   else {
     status.tx_busy = ((usart->reg->SR & USART_SR_TC) ? (0U) : (1U));
   }
@@ -1856,6 +2126,89 @@ ARM_USART_MODEM_STATUS USART_GetModemStatus(const USART_RESOURCES *usart)
   return modem_status;
 }
 
+#ifdef __USART_FIFO
+/**
+ * @fn          int32_t USART_Read(void *data, uint32_t num, const USART_RESOURCES *usart)
+ * @brief       Read data collected in the receive FIFO without blocking.
+ * @param[out]  data  Pointer to buffer for data read from FIFO
+ * @param[in]   num   Maximum number of data items to read
+ * @param[in]   usart Pointer to USART resources
+ * @return      number of data items read (0 when FIFO is empty) or \ref execution_status on error
+ */
+static
+int32_t USART_Read(void *data, uint32_t num, const USART_RESOURCES *usart)
+{
+  uint32_t cr1, sz, cnt;
+
+  if ((data == NULL) || (num == 0U)) {
+    /* Invalid parameters */
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
+  if ((usart->info->flags & USART_FLAG_CONFIGURED) == 0U) {
+    /* USART is not configured (mode not selected) */
+    return (ARM_DRIVER_ERROR);
+  }
+
+  /* Nine bit data without parity occupies two bytes per item */
+  cr1 = usart->reg->CR1;
+  sz = (((cr1 & USART_CR1_PCE) == 0U) && ((cr1 & USART_CR1_M) != 0U)) ? 2U : 1U;
+
+  cnt = USART_FifoCount(usart->rx_fifo) / sz;
+  if (num > cnt) {
+    num = cnt;
+  }
+
+  USART_FifoGet(usart->rx_fifo, (uint8_t *)data, num * sz);
+
+  return ((int32_t)num);
+}
+
+/**
+ * @fn          int32_t USART_Write(const void *data, uint32_t num, const USART_RESOURCES *usart)
+ * @brief       Queue data into the transmit FIFO without blocking.
+ * @param[in]   data  Pointer to buffer with data to write into FIFO
+ * @param[in]   num   Maximum number of data items to write
+ * @param[in]   usart Pointer to USART resources
+ * @return      number of data items queued (0 when FIFO is full) or \ref execution_status on error
+ */
+static
+int32_t USART_Write(const void *data, uint32_t num, const USART_RESOURCES *usart)
+{
+  uint32_t cr1, sz, cnt;
+
+  if ((data == NULL) || (num == 0U)) {
+    /* Invalid parameters */
+    return (ARM_DRIVER_ERROR_PARAMETER);
+  }
+
+  if ((usart->info->flags & USART_FLAG_CONFIGURED) == 0U) {
+    /* USART is not configured (mode not selected) */
+    return (ARM_DRIVER_ERROR);
+  }
+
+  /* Nine bit data without parity occupies two bytes per item */
+  cr1 = usart->reg->CR1;
+  sz = (((cr1 & USART_CR1_PCE) == 0U) && ((cr1 & USART_CR1_M) != 0U)) ? 2U : 1U;
+
+  cnt = (usart->tx_fifo->size - USART_FifoCount(usart->tx_fifo)) / sz;
+  if (num > cnt) {
+    num = cnt;
+  }
+
+  if (num != 0U) {
+    USART_FifoPut(usart->tx_fifo, (const uint8_t *)data, num * sz);
+
+    /* Start transmitter unless Send owns it, it picks up the FIFO when done */
+    if (usart->xfer->send_active == 0U) {
+      usart->reg->CR1 |= USART_CR1_TXEIE;
+    }
+  }
+
+  return ((int32_t)num);
+}
+#endif
+
 /**
  * @fn          void USART_IRQHandler(const USART_RESOURCES *usart)
  * @brief       USART Interrupt handler.
@@ -1881,11 +2234,33 @@ void USART_IRQHandler(const USART_RESOURCES *usart)
   if (sr & USART_SR_RXNE & reg->CR1) {
     /* Check for RX overflow */
     if (info->status.rx_busy == 0U) {
-      /* New receive has not been started */
-      /* Dump RX data */
-      reg->DR;
-      info->status.rx_overflow = 1;
-      event |= ARM_USART_EVENT_RX_OVERFLOW;
+#ifdef __USART_FIFO
+      if (usart->rx_fifo != NULL) {
+        /* Store RX data into receive FIFO */
+        data = (uint16_t)reg->DR;
+
+        /* If nine bit data, no parity */
+        val = reg->CR1;
+        val = (((val & USART_CR1_PCE) == 0U) && ((val & USART_CR1_M) != 0U)) ? 2U : 1U;
+
+        if ((usart->rx_fifo->size - USART_FifoCount(usart->rx_fifo)) >= val) {
+          USART_FifoPut(usart->rx_fifo, (uint8_t *)&data, val);
+        }
+        else {
+          /* FIFO full, data is lost */
+          info->status.rx_overflow = 1;
+          event |= ARM_USART_EVENT_RX_OVERFLOW;
+        }
+      }
+      else
+#endif
+      {
+        /* New receive has not been started */
+        /* Dump RX data */
+        reg->DR;
+        info->status.rx_overflow = 1;
+        event |= ARM_USART_EVENT_RX_OVERFLOW;
+      }
     }
     else {
       if ((info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) && (xfer->sync_mode == USART_SYNC_MODE_TX)) {
@@ -1908,8 +2283,10 @@ void USART_IRQHandler(const USART_RESOURCES *usart)
 
       /* Check if requested amount of data is received */
       if (xfer->rx_cnt == xfer->rx_num) {
-        /* Disable IDLE interrupt */
-        reg->CR1 &= ~USART_CR1_IDLEIE;
+        /* Disable IDLE interrupt, kept as RX timeout notification in buffered mode */
+        if (usart->rx_fifo == NULL) {
+          reg->CR1 &= ~USART_CR1_IDLEIE;
+        }
         /* Clear RX busy flag and set receive transfer complete event */
         info->status.rx_busy = 0U;
         if (info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) {
@@ -1950,6 +2327,23 @@ void USART_IRQHandler(const USART_RESOURCES *usart)
       /* Send break */
       reg->CR1 |= USART_CR1_SBK;
     }
+#ifdef __USART_FIFO
+    else if (xfer->send_active == 0U) {
+      /* Buffered mode: drain transmit FIFO */
+      val = reg->CR1;
+      val = (((val & USART_CR1_PCE) == 0U) && ((val & USART_CR1_M) != 0U)) ? 2U : 1U;
+
+      if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) >= val)) {
+        USART_FifoGet(usart->tx_fifo, (uint8_t *)&data, val);
+        reg->DR = data;
+      }
+      else {
+        /* FIFO empty, disable TXE and wait for transmission complete */
+        reg->CR1 &= ~USART_CR1_TXEIE;
+        reg->CR1 |= USART_CR1_TCIE;
+      }
+    }
+#endif
     else {
       if (xfer->tx_num != xfer->tx_cnt) {
         if ((info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) && (xfer->sync_mode == USART_SYNC_MODE_RX)) {
@@ -1982,6 +2376,13 @@ void USART_IRQHandler(const USART_RESOURCES *usart)
 
         xfer->send_active = 0U;
 
+#ifdef __USART_FIFO
+        /* Resume transmission of data queued by Write */
+        if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U)) {
+          reg->CR1 |= USART_CR1_TXEIE;
+        }
+#endif
+
         /* Set send complete event */
         if (info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) {
           if ((xfer->sync_mode == USART_SYNC_MODE_TX) && ((info->flags & USART_FLAG_RX_ENABLED) == 0U)) {
@@ -2066,6 +2467,13 @@ void USART_TX_DMA_Complete(const USART_RESOURCES *usart)
   /* TC interrupt enable */
   usart->reg->CR1 |= USART_CR1_TCIE;
 
+#ifdef __USART_FIFO
+  /* Resume transmission of data queued by Write */
+  if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U)) {
+    usart->reg->CR1 |= USART_CR1_TXEIE;
+  }
+#endif
+
   /* Set Send Complete event for asynchronous transfers */
   if (info->mode != ARM_USART_MODE_SYNCHRONOUS_MASTER) {
     if (info->cb_event) {
@@ -2088,7 +2496,9 @@ void USART_RX_DMA_Complete(const USART_RESOURCES *usart)
   }
 
   /* Disable IDLE interrupt */
-  usart->reg->CR1 &= ~USART_CR1_IDLEIE;
+  if (usart->rx_fifo == NULL) {
+    usart->reg->CR1 &= ~USART_CR1_IDLEIE;
+  }
 
   event = 0U;
 
@@ -2149,6 +2559,11 @@ static ARM_USART_MODEM_STATUS  USART1_GetModemStatus  (void)
        void                    USART1_RX_DMA_Handler  (uint32_t events)                                     {        USART_RX_DMA_Complete(&USART1_Resources); }
 #endif
 
+#ifdef USART1_RX_FIFO_SIZE
+       int32_t                 USART1_Read            (void *data, uint32_t num)                            { return USART_Read (data, num, &USART1_Resources); }
+       int32_t                 USART1_Write           (const void *data, uint32_t num)                      { return USART_Write (data, num, &USART1_Resources); }
+#endif
+
 /* USART1 Driver Control Block */
 ARM_DRIVER_USART Driver_USART1 = {
     USARTx_GetVersion,
@@ -2192,6 +2607,11 @@ static ARM_USART_MODEM_STATUS  USART2_GetModemStatus  (void)
        void                    USART2_RX_DMA_Handler  (uint32_t events)                                     {        USART_RX_DMA_Complete(&USART2_Resources); }
 #endif
 
+#ifdef USART2_RX_FIFO_SIZE
+       int32_t                 USART2_Read            (void *data, uint32_t num)                            { return USART_Read (data, num, &USART2_Resources); }
+       int32_t                 USART2_Write           (const void *data, uint32_t num)                      { return USART_Write (data, num, &USART2_Resources); }
+#endif
+
 /* USART2 Driver Control Block */
 ARM_DRIVER_USART Driver_USART2 = {
     USARTx_GetVersion,
@@ -2235,6 +2655,11 @@ static ARM_USART_MODEM_STATUS  USART3_GetModemStatus  (void)
        void                    USART3_RX_DMA_Handler  (uint32_t events)                                     {        USART_RX_DMA_Complete(&USART3_Resources); }
 #endif
 
+#ifdef USART3_RX_FIFO_SIZE
+       int32_t                 USART3_Read            (void *data, uint32_t num)                            { return USART_Read (data, num, &USART3_Resources); }
+       int32_t                 USART3_Write           (const void *data, uint32_t num)                      { return USART_Write (data, num, &USART3_Resources); }
+#endif
+
 /* USART3 Driver Control Block */
 ARM_DRIVER_USART Driver_USART3 = {
     USARTx_GetVersion,
@@ -2278,6 +2703,11 @@ static ARM_USART_MODEM_STATUS  USART4_GetModemStatus  (void)
        void                    UART4_RX_DMA_Handler   (uint32_t events)                                     {        USART_RX_DMA_Complete(&USART4_Resources); }
 #endif
 
+#ifdef UART4_RX_FIFO_SIZE
+       int32_t                 USART4_Read            (void *data, uint32_t num)                            { return USART_Read (data, num, &USART4_Resources); }
+       int32_t                 USART4_Write           (const void *data, uint32_t num)                      { return USART_Write (data, num, &USART4_Resources); }
+#endif
+
 /* USART4 Driver Control Block */
 ARM_DRIVER_USART Driver_USART4 = {
     USARTx_GetVersion,
@@ -2321,6 +2751,11 @@ static ARM_USART_MODEM_STATUS  USART5_GetModemStatus  (void)
        void                    UART5_RX_DMA_Handler   (uint32_t events)                                     {        USART_RX_DMA_Complete(&USART5_Resources); }
 #endif
 
+#ifdef UART5_RX_FIFO_SIZE
+       int32_t                 USART5_Read            (void *data, uint32_t num)                            { return USART_Read (data, num, &USART5_Resources); }
+       int32_t                 USART5_Write           (const void *data, uint32_t num)                      { return USART_Write (data, num, &USART5_Resources); }
+#endif
+
 /* USART5 Driver Control Block */
 ARM_DRIVER_USART Driver_USART5 = {
     USARTx_GetVersion,
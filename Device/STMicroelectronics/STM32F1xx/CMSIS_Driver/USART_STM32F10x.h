@@ -61,6 +61,15 @@
     #define USART1_TX_DMA_Handler     DMAx_CHANNELy_EVENT(RTE_USART1_TX_DMA_NUMBER, RTE_USART1_TX_DMA_CHANNEL)
   #endif
 
+  #if (RTE_USART1_FIFO == 1)
+    #if (((RTE_USART1_RX_FIFO_SIZE & (RTE_USART1_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_USART1_TX_FIFO_SIZE & (RTE_USART1_TX_FIFO_SIZE - 1)) != 0))
+      #error "USART1 FIFO size must be a power of two!"
+    #endif
+    #define USART1_RX_FIFO_SIZE       RTE_USART1_RX_FIFO_SIZE
+    #define USART1_TX_FIFO_SIZE       RTE_USART1_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_USART1_TX == 1)
     #define USE_USART1_TX_Pin         1U
     #define USART1_TX_GPIOx           RTE_USART1_TX_PORT
@@ -116,6 +125,15 @@
     #define USART2_TX_DMA_Handler     DMAx_CHANNELy_EVENT(RTE_USART2_TX_DMA_NUMBER, RTE_USART2_TX_DMA_CHANNEL)
   #endif
 
+  #if (RTE_USART2_FIFO == 1)
+    #if (((RTE_USART2_RX_FIFO_SIZE & (RTE_USART2_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_USART2_TX_FIFO_SIZE & (RTE_USART2_TX_FIFO_SIZE - 1)) != 0))
+      #error "USART2 FIFO size must be a power of two!"
+    #endif
+    #define USART2_RX_FIFO_SIZE       RTE_USART2_RX_FIFO_SIZE
+    #define USART2_TX_FIFO_SIZE       RTE_USART2_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_USART2_TX == 1)
     #define USE_USART2_TX_Pin         1U
     #define USART2_TX_GPIOx           RTE_USART2_TX_PORT
@@ -176,6 +194,15 @@
     #define USART3_TX_DMA_Handler     DMAx_CHANNELy_EVENT(RTE_USART3_TX_DMA_NUMBER, RTE_USART3_TX_DMA_CHANNEL)
   #endif
 
+  #if (RTE_USART3_FIFO == 1)
+    #if (((RTE_USART3_RX_FIFO_SIZE & (RTE_USART3_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_USART3_TX_FIFO_SIZE & (RTE_USART3_TX_FIFO_SIZE - 1)) != 0))
+      #error "USART3 FIFO size must be a power of two!"
+    #endif
+    #define USART3_RX_FIFO_SIZE       RTE_USART3_RX_FIFO_SIZE
+    #define USART3_TX_FIFO_SIZE       RTE_USART3_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_USART3_TX == 1)
     #define USE_USART3_TX_Pin         1U
     #define USART3_TX_GPIOx           RTE_USART3_TX_PORT
@@ -236,6 +263,15 @@
     #define UART4_TX_DMA_Handler      DMAx_CHANNELy_EVENT(RTE_UART4_TX_DMA_NUMBER, RTE_UART4_TX_DMA_CHANNEL)
   #endif
 
+  #if (RTE_UART4_FIFO == 1)
+    #if (((RTE_UART4_RX_FIFO_SIZE & (RTE_UART4_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_UART4_TX_FIFO_SIZE & (RTE_UART4_TX_FIFO_SIZE - 1)) != 0))
+      #error "UART4 FIFO size must be a power of two!"
+    #endif
+    #define UART4_RX_FIFO_SIZE        RTE_UART4_RX_FIFO_SIZE
+    #define UART4_TX_FIFO_SIZE        RTE_UART4_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_UART4_TX == 1)
     #define USE_UART4_TX_Pin          1U
     #define UART4_TX_GPIOx            RTE_UART4_TX_PORT
@@ -278,6 +314,15 @@
     #define UART5_TX_DMA_Handler      DMAx_CHANNELy_EVENT(RTE_UART5_TX_DMA_NUMBER, RTE_UART5_TX_DMA_CHANNEL)
   #endif
 
+  #if (RTE_UART5_FIFO == 1)
+    #if (((RTE_UART5_RX_FIFO_SIZE & (RTE_UART5_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_UART5_TX_FIFO_SIZE & (RTE_UART5_TX_FIFO_SIZE - 1)) != 0))
+      #error "UART5 FIFO size must be a power of two!"
+    #endif
+    #define UART5_RX_FIFO_SIZE        RTE_UART5_RX_FIFO_SIZE
+    #define UART5_TX_FIFO_SIZE        RTE_UART5_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_UART5_TX == 1)
     #define USE_UART5_TX_Pin          1U
     #define UART5_TX_GPIOx            RTE_UART5_TX_PORT
@@ -367,6 +412,14 @@
 #define __USART_DMA
 #endif
 
+#if (defined(USART1_RX_FIFO_SIZE) || \
+     defined(USART2_RX_FIFO_SIZE) || \
+     defined(USART3_RX_FIFO_SIZE) || \
+     defined(UART4_RX_FIFO_SIZE) || \
+     defined(UART5_RX_FIFO_SIZE))
+#define __USART_FIFO
+#endif
+
 // USART BRR macro
 #define USART_DIVIDER(_PCLK_, _BAUD_)           (((_PCLK_)*25)/(4*(_BAUD_)))
 #define USART_DIVIDER_MANTISA(_PCLK_, _BAUD_)     (USART_DIVIDER((_PCLK_), (_BAUD_))/100)
@@ -424,6 +477,14 @@ typedef struct _USART_TRANSFER_INFO {
   uint8_t               send_active;    // Send active flag
 } USART_TRANSFER_INFO;
 
+// USART software FIFO (single producer, single consumer)
+typedef struct _USART_FIFO {
+  uint8_t              *buf;            // FIFO storage
+  uint32_t              size;           // FIFO size in bytes (power of two)
+  volatile uint32_t     head;           // Write index, advanced by producer only
+  volatile uint32_t     tail;           // Read index, advanced by consumer only
+} USART_FIFO;
+
 typedef struct _USART_STATUS {
   uint8_t tx_busy;                      // Transmitter busy flag
   uint8_t rx_busy;                      // Receiver busy flag
@@ -441,6 +502,8 @@ typedef struct _USART_INFO {
   uint8_t                 flags;               // Current USART flags
   uint32_t                mode;                // Current USART mode
   uint32_t                flow_control;        // Flow control
+  uint32_t                baudrate;            // Configured baudrate
+  RCC_ClockSubscriber_t   clk_sub;             // Clock change subscription
 } USART_INFO;
 
 // USART Resources definition
@@ -452,8 +515,39 @@ typedef const struct {
   IRQn_Type               irq_num;             // USART IRQ Number
   USART_DMA               *dma_tx;             // Transmit stream register interface
   USART_DMA               *dma_rx;             // Receive stream register interface
+  USART_FIFO              *rx_fifo;            // Receive FIFO (buffered mode)
+  USART_FIFO              *tx_fifo;            // Transmit FIFO (buffered mode)
   USART_INFO              *info;               // Run-Time Information
   USART_TRANSFER_INFO     *xfer;               // USART transfer information
 } USART_RESOURCES;
 
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+#ifdef USART1_RX_FIFO_SIZE
+extern int32_t USART1_Read(void *data, uint32_t num);
+extern int32_t USART1_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef USART2_RX_FIFO_SIZE
+extern int32_t USART2_Read(void *data, uint32_t num);
+extern int32_t USART2_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef USART3_RX_FIFO_SIZE
+extern int32_t USART3_Read(void *data, uint32_t num);
+extern int32_t USART3_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef UART4_RX_FIFO_SIZE
+extern int32_t USART4_Read(void *data, uint32_t num);
+extern int32_t USART4_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef UART5_RX_FIFO_SIZE
+extern int32_t USART5_Read(void *data, uint32_t num);
+extern int32_t USART5_Write(const void *data, uint32_t num);
+#endif
+
 #endif /* USART_STM32F10X_H_ */
@@ -43,6 +43,7 @@
 #define RTE_SPI_INT_PRIORITY            (1U)
 #define RTE_SPI_DMA_INT_PRIORITY        (1U)
 #define RTE_EXTI_INT_PRIORITY           (1U)
+#define RTE_MEMDMA_DMA_INT_PRIORITY     (1U)
 
 // <e> USART1 (Universal synchronous asynchronous receiver transmitter) [Driver_USART1]
 // <i> Configuration settings for Driver_USART1 in component ::CMSIS Driver:USART
@@ -165,6 +166,17 @@
 #define RTE_USART1_TX_DMA_CHANNEL       4
 #define RTE_USART1_TX_DMA_PRIORITY      0
 
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART1_Read, USART1_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_USART1_FIFO                 0
+#define RTE_USART1_RX_FIFO_SIZE         64
+#define RTE_USART1_TX_FIFO_SIZE         64
+
 // </e> USART1 (Universal synchronous asynchronous receiver transmitter) [Driver_USART1]
 
 // <e> USART2 (Universal synchronous asynchronous receiver transmitter) [Driver_USART2]
@@ -293,6 +305,17 @@
 #define RTE_USART2_TX_DMA_CHANNEL       4
 #define RTE_USART2_TX_DMA_PRIORITY      0
 
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART2_Read, USART2_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_USART2_FIFO                 0
+#define RTE_USART2_RX_FIFO_SIZE         64
+#define RTE_USART2_TX_FIFO_SIZE         64
+
 // </e> USART2 (Universal synchronous asynchronous receiver transmitter) [Driver_USART2]
 
 // <e> USART3 (Universal synchronous asynchronous receiver transmitter) [Driver_USART3]
@@ -449,6 +472,17 @@
 #define RTE_USART3_TX_DMA_CHANNEL       4
 #define RTE_USART3_TX_DMA_PRIORITY      0
 
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART3_Read, USART3_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_USART3_FIFO                 0
+#define RTE_USART3_RX_FIFO_SIZE         64
+#define RTE_USART3_TX_FIFO_SIZE         64
+
 // </e> USART3 (Universal synchronous asynchronous receiver transmitter) [Driver_USART3]
 
 // <e> UART4 (Universal asynchronous receiver transmitter) [Driver_USART4]
@@ -548,6 +582,17 @@
 #define RTE_UART4_TX_DMA_CHANNEL        4
 #define RTE_UART4_TX_DMA_PRIORITY       0
 
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART4_Read, USART4_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_UART4_FIFO                  0
+#define RTE_UART4_RX_FIFO_SIZE          64
+#define RTE_UART4_TX_FIFO_SIZE          64
+
 // </e> UART4 (Universal asynchronous receiver transmitter) [Driver_USART4]
 
 // <e> UART5 (Universal asynchronous receiver transmitter) [Driver_USART5]
@@ -642,6 +687,17 @@
 #define RTE_UART5_TX_DMA_CHANNEL        4
 #define RTE_UART5_TX_DMA_PRIORITY       0
 
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART5_Read, USART5_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_UART5_FIFO                  0
+#define RTE_UART5_RX_FIFO_SIZE          64
+#define RTE_UART5_TX_FIFO_SIZE          64
+
 // </e> UART5 (Universal asynchronous receiver transmitter) [Driver_USART5]
 
 // <e> USART6 (Universal synchronous asynchronous receiver transmitter) [Driver_USART6]
@@ -780,6 +836,17 @@
 #define RTE_USART6_TX_DMA_CHANNEL       5
 #define RTE_USART6_TX_DMA_PRIORITY      0
 
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART6_Read, USART6_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_USART6_FIFO                 0
+#define RTE_USART6_RX_FIFO_SIZE         64
+#define RTE_USART6_TX_FIFO_SIZE         64
+
 // </e> USART6 (Universal synchronous asynchronous receiver transmitter) [Driver_USART6]
 
 // <e> UART7 (Universal asynchronous receiver transmitter) [Driver_USART7]
@@ -874,6 +941,17 @@
 #define RTE_UART7_TX_DMA_CHANNEL        5
 #define RTE_UART7_TX_DMA_PRIORITY       0
 
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART7_Read, USART7_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_UART7_FIFO                  0
+#define RTE_UART7_RX_FIFO_SIZE          64
+#define RTE_UART7_TX_FIFO_SIZE          64
+
 // </e> UART7 (Universal asynchronous receiver transmitter) [Driver_USART7]
 
 // <e> UART8 (Universal asynchronous receiver transmitter) [Driver_USART8]
@@ -948,6 +1026,17 @@
 #define RTE_UART8_TX_DMA_CHANNEL        5
 #define RTE_UART8_TX_DMA_PRIORITY       0
 
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART8_Read, USART8_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_UART8_FIFO                  0
+#define RTE_UART8_RX_FIFO_SIZE          64
+#define RTE_UART8_TX_FIFO_SIZE          64
+
 // </e> UART8 (Universal asynchronous receiver transmitter) [Driver_USART8]
 
 // <e> UART9 (Universal asynchronous receiver transmitter) [Driver_USART9]
@@ -1022,6 +1111,17 @@
 #define RTE_UART9_TX_DMA_CHANNEL        5
 #define RTE_UART9_TX_DMA_PRIORITY       0
 
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART9_Read, USART9_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_UART9_FIFO                  0
+#define RTE_UART9_RX_FIFO_SIZE          64
+#define RTE_UART9_TX_FIFO_SIZE          64
+
 // </e> UART9 (Universal asynchronous receiver transmitter) [Driver_USART9]
 
 // <e> UART10 (Universal asynchronous receiver transmitter) [Driver_USART10]
@@ -1096,6 +1196,17 @@
 #define RTE_UART10_TX_DMA_CHANNEL       5
 #define RTE_UART10_TX_DMA_PRIORITY      0
 
+//   <e> Buffered mode
+//   <i> Software RX/TX FIFOs serviced by the interrupt handler (USART10_Read, USART10_Write)
+//     <o1> RX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Receive FIFO size in bytes (power of two)
+//     <o2> TX FIFO size <16=>16 <32=>32 <64=>64 <128=>128 <256=>256 <512=>512 <1024=>1024
+//     <i>  Transmit FIFO size in bytes (power of two)
+//   </e>
+#define RTE_UART10_FIFO                 0
+#define RTE_UART10_RX_FIFO_SIZE         64
+#define RTE_UART10_TX_FIFO_SIZE         64
+
 // </e> UART10 (Universal asynchronous receiver transmitter) [Driver_USART10]
 
 // <e> I2C1 (Inter-integrated Circuit Interface 1) [Driver_I2C1]
@@ -1128,6 +1239,39 @@
 #else
   #error "Invalid I2C1_SDA Pin Configuration!"
 #endif
+
+//   <e> DMA Rx
+//     <o1> Number <1=>1
+//     <i>  Selects DMA Number (only DMA1 can be used)
+//     <o2> Stream <0=>0 <5=>5
+//     <i>  Selects DMA Stream (only Stream 0 or 5 can be used)
+//     <o3> Channel <1=>1
+//     <i>  Selects DMA Channel (only Channel 1 can be used)
+//     <o4> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define RTE_I2C1_RX_DMA                 0
+#define RTE_I2C1_RX_DMA_NUMBER          1
+#define RTE_I2C1_RX_DMA_STREAM          0
+#define RTE_I2C1_RX_DMA_CHANNEL         1
+#define RTE_I2C1_RX_DMA_PRIORITY        0
+
+//   <e> DMA Tx
+//     <o1> Number <1=>1
+//     <i>  Selects DMA Number (only DMA1 can be used)
+//     <o2> Stream <6=>6 <7=>7
+//     <i>  Selects DMA Stream (only Stream 6 or 7 can be used)
+//     <o3> Channel <1=>1
+//     <i>  Selects DMA Channel (only Channel 1 can be used)
+//     <o4> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define RTE_I2C1_TX_DMA                 0
+#define RTE_I2C1_TX_DMA_NUMBER          1
+#define RTE_I2C1_TX_DMA_STREAM          6
+#define RTE_I2C1_TX_DMA_CHANNEL         1
+#define RTE_I2C1_TX_DMA_PRIORITY        0
+
 // </e> I2C1 (Inter-integrated Circuit Interface 1) [Driver_I2C1]
 
 // <e> I2C2 (Inter-integrated Circuit Interface 2) [Driver_I2C2]
@@ -1168,6 +1312,39 @@
 #else
   #error "Invalid I2C2_SDA Pin Configuration!"
 #endif
+
+//   <e> DMA Rx
+//     <o1> Number <1=>1
+//     <i>  Selects DMA Number (only DMA1 can be used)
+//     <o2> Stream <2=>2 <3=>3
+//     <i>  Selects DMA Stream (only Stream 2 or 3 can be used)
+//     <o3> Channel <7=>7
+//     <i>  Selects DMA Channel (only Channel 7 can be used)
+//     <o4> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define RTE_I2C2_RX_DMA                 0
+#define RTE_I2C2_RX_DMA_NUMBER          1
+#define RTE_I2C2_RX_DMA_STREAM          2
+#define RTE_I2C2_RX_DMA_CHANNEL         7
+#define RTE_I2C2_RX_DMA_PRIORITY        0
+
+//   <e> DMA Tx
+//     <o1> Number <1=>1
+//     <i>  Selects DMA Number (only DMA1 can be used)
+//     <o2> Stream <7=>7
+//     <i>  Selects DMA Stream (only Stream 7 can be used)
+//     <o3> Channel <7=>7
+//     <i>  Selects DMA Channel (only Channel 7 can be used)
+//     <o4> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define RTE_I2C2_TX_DMA                 0
+#define RTE_I2C2_TX_DMA_NUMBER          1
+#define RTE_I2C2_TX_DMA_STREAM          7
+#define RTE_I2C2_TX_DMA_CHANNEL         7
+#define RTE_I2C2_TX_DMA_PRIORITY        0
+
 // </e> I2C2 (Inter-integrated Circuit Interface 2) [Driver_I2C2]
 
 // <e> I2C3 (Inter-integrated Circuit Interface 3) [Driver_I2C3]
@@ -1200,6 +1377,39 @@
 #else
   #error "Invalid I2C3_SDA Pin Configuration!"
 #endif
+
+//   <e> DMA Rx
+//     <o1> Number <1=>1
+//     <i>  Selects DMA Number (only DMA1 can be used)
+//     <o2> Stream <2=>2
+//     <i>  Selects DMA Stream (only Stream 2 can be used)
+//     <o3> Channel <3=>3
+//     <i>  Selects DMA Channel (only Channel 3 can be used)
+//     <o4> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define RTE_I2C3_RX_DMA                 0
+#define RTE_I2C3_RX_DMA_NUMBER          1
+#define RTE_I2C3_RX_DMA_STREAM          2
+#define RTE_I2C3_RX_DMA_CHANNEL         3
+#define RTE_I2C3_RX_DMA_PRIORITY        0
+
+//   <e> DMA Tx
+//     <o1> Number <1=>1
+//     <i>  Selects DMA Number (only DMA1 can be used)
+//     <o2> Stream <4=>4
+//     <i>  Selects DMA Stream (only Stream 4 can be used)
+//     <o3> Channel <3=>3
+//     <i>  Selects DMA Channel (only Channel 3 can be used)
+//     <o4> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//     <i>  Selects DMA Priority
+//   </e>
+#define RTE_I2C3_TX_DMA                 0
+#define RTE_I2C3_TX_DMA_NUMBER          1
+#define RTE_I2C3_TX_DMA_STREAM          4
+#define RTE_I2C3_TX_DMA_CHANNEL         3
+#define RTE_I2C3_TX_DMA_PRIORITY        0
+
 // </e> I2C3 (Inter-integrated Circuit Interface 3) [Driver_I2C3]
 
 // <e> I2S2 (Inter-IC Sound Interface 2) [Driver_SAI2]
@@ -2305,6 +2515,51 @@
 
 // </e>
 
+// <e> MEMDMA (Memory to memory DMA copy and fill service)
+// <i> Configuration settings for the memory to memory DMA service
+//   <o1> Number <2=>2
+//   <i>  Selects DMA Number (only DMA2 can be used)
+//   <o2> Stream <0-7>
+//   <i>  Selects DMA Stream, must not be used by other drivers
+//   <o3> Priority <0=>Low <1=>Medium <2=>High <3=>Very High
+//   <i>  Selects DMA Priority
+//   <o4> CPU copy threshold <0-65535>
+//   <i>  Requests shorter than this number of bytes are done by the CPU
+//   <i>  when no DMA request is queued
+// </e>
+#define RTE_MEMDMA                      0
+#define RTE_MEMDMA_DMA_NUMBER           2
+#define RTE_MEMDMA_DMA_STREAM           4
+#define RTE_MEMDMA_DMA_PRIORITY         0
+#define RTE_MEMDMA_CPU_THRESHOLD        128
+
+// <e> DFS (Dynamic frequency scaling governor)
+// <i> Drivers hold a performance lock while transfers are active,
+// <i> DFS_Idle switches to the low operating point when no lock is held
+#define RTE_DFS                         0
+// </e>
+
+// <h> DMA stream pool
+// <i> Streams handed out at run time by DMA_StreamAllocate. The DMA driver
+// <i> owns the interrupt handlers of these streams, they must not be used
+// <i> by statically configured drivers.
+//   <o0> DMA1 streams <0x00-0xFF>
+//   <i>  Bit mask of DMA1 streams 0..7
+//   <o1> DMA2 streams <0x00-0xFF>
+//   <i>  Bit mask of DMA2 streams 0..7
+// </h>
+#define RTE_DMA1_POOL                   0x00
+#define RTE_DMA2_POOL                   0x00
+
+// <e> I2C bus recovery
+// <i> A master transfer without bus activity for the timeout is aborted
+// <i> and a bus held low is cleared by nine SCL pulses and a STOP
+// <i> when the next master transfer is started
+//   <o1> Bus timeout [ms] <1-1000>
+// </e>
+#define RTE_I2C_BUS_RECOVERY            0
+#define RTE_I2C_BUS_TIMEOUT             25
+
 #endif /* RTE_DEVICE_H_ */
 
 /* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,322 @@
+/*
+ * Copyright (C) 2019 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Dynamic Frequency Scaling for STMicroelectronics STM32F4xx
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include "DFS_STM32F4xx.h"
+
+/*******************************************************************************
+ *  external declarations
+ ******************************************************************************/
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define DFS_CLK_TYPE_ALL      (RCC_CLK_TYPE_SYSCLK | RCC_CLK_TYPE_HCLK | \
+                               RCC_CLK_TYPE_PCLK1  | RCC_CLK_TYPE_PCLK2)
+
+/*******************************************************************************
+ *  typedefs and structures (scope: module-local)
+ ******************************************************************************/
+
+typedef struct DFS_Governor_s {
+  const DFS_OperatingPoint_t *high;
+  const DFS_OperatingPoint_t *low;
+  const DFS_OperatingPoint_t *point;
+  volatile uint32_t lock_cnt;
+  uint32_t switch_cnt;
+  uint32_t latency_last;
+  uint32_t latency_max;
+} DFS_Governor_t;
+
+/*******************************************************************************
+ *  global variable definitions  (scope: module-exported)
+ ******************************************************************************/
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static DFS_Governor_t Governor;
+
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+/**
+ * @fn          uint32_t CyclesToNs(uint32_t cycles, uint32_t freq)
+ * @brief       Convert core clock cycles to nanoseconds.
+ */
+static
+uint32_t CyclesToNs(uint32_t cycles, uint32_t freq)
+{
+  if (freq == 0U)
+    return 0U;
+
+  return (uint32_t)(((uint64_t)cycles * 1000000000ULL) / freq);
+}
+
+/**
+ * @fn          bool PllEqual(const RCC_PllInit_t *a, const RCC_PllInit_t *b)
+ * @brief       Compare main PLL settings of two operating points.
+ */
+static
+bool PllEqual(const RCC_PllInit_t *a, const RCC_PllInit_t *b)
+{
+  if (a->state != b->state)
+    return false;
+
+  if (a->state != RCC_PLL_ON)
+    return true;
+
+  return ((a->source == b->source) && (a->m == b->m) &&
+          (a->n == b->n) && (a->p == b->p) && (a->q == b->q));
+}
+
+/**
+ * @fn          void SetClocks(const DFS_OperatingPoint_t *op)
+ * @brief       Select system clock source and bus dividers of operating point.
+ */
+static
+void SetClocks(const DFS_OperatingPoint_t *op)
+{
+  RCC_ClkInit_t clk;
+
+  /* Slowest APB clocks while HCLK changes, keeps both buses in range */
+  RCC->CFGR |= (RCC_CFGR_PPRE1 | RCC_CFGR_PPRE2);
+
+  clk.type         = DFS_CLK_TYPE_ALL;
+  clk.sys_clk_src  = op->sys_clk_src;
+  clk.AHB_clk_div  = op->AHB_clk_div;
+  clk.APB1_clk_div = op->APB1_clk_div;
+  clk.APB2_clk_div = op->APB2_clk_div;
+
+  RCC_ClkInit(&clk, op->flash_latency);
+
+  while ((RCC->CFGR & RCC_CFGR_SWS) != (op->sys_clk_src << RCC_CFGR_SWS_Pos));
+}
+
+/**
+ * @fn          void DFS_Switch(const DFS_OperatingPoint_t *op)
+ * @brief       Switch to operating point. Must be called with interrupts
+ *              disabled. The system runs from HSI while the main PLL or the
+ *              regulator scale is changed. Drivers get one clock change
+ *              notification for the whole sequence.
+ */
+static
+void DFS_Switch(const DFS_OperatingPoint_t *op)
+{
+  static const DFS_OperatingPoint_t hsi = {
+    { RCC_PLL_NONE, 0U, 0U, 0U, 0U, 0U },
+    RCC_SYSCLK_SRC_HSI, RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_HCLK_DIV1,
+    FLASH_LATENCY_0, 0U
+  };
+  const DFS_OperatingPoint_t *cur = Governor.point;
+  RCC_OscInit_t osc;
+  uint32_t t0, t1, t2, t3;
+  uint32_t f_old, f_new;
+  uint32_t latency;
+
+  f_old = RCC_GetFreq(RCC_FREQ_AHB);
+  t0 = DWT->CYCCNT;
+  t1 = t0;
+  t2 = t0;
+
+  RCC_ClockChangeBegin();
+
+  if ((cur == NULL) || !PllEqual(&cur->PLL, &op->PLL) || (cur->vos != op->vos)) {
+    /* Run from HSI */
+    RCC->CR |= RCC_CR_HSION;
+    while ((RCC->CR & RCC_CR_HSIRDY) == 0U);
+
+    SetClocks(&hsi);
+    t1 = DWT->CYCCNT;
+
+    /* Main PLL off, regulator scale can be changed now */
+    osc.OSC_Type = RCC_OSC_TYPE_NONE;
+    osc.PLL      = op->PLL;
+    osc.PLL.state = RCC_PLL_OFF;
+    RCC_OscInit(&osc);
+
+    PWR->CR = (PWR->CR & ~PWR_CR_VOS) | op->vos;
+
+    if (op->PLL.state == RCC_PLL_ON) {
+      osc.PLL.state = RCC_PLL_ON;
+      RCC_OscInit(&osc);
+
+      while ((PWR->CSR & PWR_CSR_VOSRDY) == 0U);
+    }
+
+    t2 = DWT->CYCCNT;
+  }
+
+  SetClocks(op);
+
+  f_new = RCC_GetFreq(RCC_FREQ_AHB);
+  t3 = DWT->CYCCNT;
+
+  latency = CyclesToNs(t1 - t0, f_old) +
+            CyclesToNs(t2 - t1, RTE_HSI) +
+            CyclesToNs(t3 - t2, f_new);
+
+  Governor.point        = op;
+  Governor.latency_last = latency;
+  Governor.switch_cnt++;
+
+  if (latency > Governor.latency_max)
+    Governor.latency_max = latency;
+
+  RCC_ClockChangeEnd();
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+/**
+ * @fn          int32_t DFS_Initialize(const DFS_OperatingPoint_t *high, const DFS_OperatingPoint_t *low)
+ * @brief       Initialize governor and switch to the high operating point.
+ *              Oscillators used by the points must already be running.
+ * @param[in]   high  Operating point used while a performance lock is held
+ * @param[in]   low   Operating point used when idle
+ * @return      \ref execution_status
+ */
+int32_t DFS_Initialize(const DFS_OperatingPoint_t *high, const DFS_OperatingPoint_t *low)
+{
+  uint32_t primask;
+
+  if ((high == NULL) || (low == NULL))
+    return ARM_DRIVER_ERROR_PARAMETER;
+
+  /* Both points must keep the PLL input, it also feeds the I2S PLL */
+  if ((high->PLL.state == RCC_PLL_ON) && (low->PLL.state == RCC_PLL_ON)) {
+    if ((high->PLL.source != low->PLL.source) || (high->PLL.m != low->PLL.m))
+      return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((high->sys_clk_src == RCC_SYSCLK_SRC_PLLCLK && high->PLL.state != RCC_PLL_ON) ||
+      (low->sys_clk_src  == RCC_SYSCLK_SRC_PLLCLK && low->PLL.state  != RCC_PLL_ON))
+    return ARM_DRIVER_ERROR_PARAMETER;
+
+  RCC_EnablePeriph(RCC_PERIPH_PWR);
+
+  /* Cycle counter for switch latency measurement */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  Governor.high         = high;
+  Governor.low          = low;
+  Governor.point        = NULL;
+  Governor.switch_cnt   = 0U;
+  Governor.latency_last = 0U;
+  Governor.latency_max  = 0U;
+
+  DFS_Switch(high);
+
+  __set_PRIMASK(primask);
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn          void DFS_Lock(void)
+ * @brief       Take performance lock. Switches to the high operating point
+ *              at once when it is not active, may be called from interrupts.
+ */
+void DFS_Lock(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+
+  if ((Governor.lock_cnt++ == 0U) && (Governor.high != NULL) && (Governor.point != Governor.high))
+    DFS_Switch(Governor.high);
+
+  __set_PRIMASK(primask);
+}
+
+/**
+ * @fn          void DFS_Unlock(void)
+ * @brief       Release performance lock. The low operating point is entered
+ *              by the next DFS_Idle call.
+ */
+void DFS_Unlock(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+
+  if (Governor.lock_cnt != 0U)
+    Governor.lock_cnt--;
+
+  __set_PRIMASK(primask);
+}
+
+/**
+ * @fn          void DFS_Idle(void)
+ * @brief       Switch to the low operating point when no lock is held.
+ *              Intended to be called from the idle loop.
+ */
+void DFS_Idle(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+
+  if ((Governor.lock_cnt == 0U) && (Governor.low != NULL) && (Governor.point != Governor.low))
+    DFS_Switch(Governor.low);
+
+  __set_PRIMASK(primask);
+}
+
+/**
+ * @fn          void DFS_GetStatus(DFS_Status_t *status)
+ * @brief       Get governor state and switch latency statistics.
+ * @param[out]  status  Pointer to status
+ */
+void DFS_GetStatus(DFS_Status_t *status)
+{
+  uint32_t primask;
+
+  if (status == NULL)
+    return;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  status->point        = Governor.point;
+  status->lock_cnt     = Governor.lock_cnt;
+  status->switch_cnt   = Governor.switch_cnt;
+  status->latency_last = Governor.latency_last;
+  status->latency_max  = Governor.latency_max;
+
+  __set_PRIMASK(primask);
+}
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2019 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Dynamic Frequency Scaling Definitions for STMicroelectronics STM32F4xx
+ */
+
+#ifndef DFS_STM32F4XX_H_
+#define DFS_STM32F4XX_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "stm32f4xx.h"
+#include "RCC_STM32F4xx.h"
+
+#include "Driver_Common.h"
+
+#include "Config/RTE_Device.h"
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+#if !defined(RTE_DFS)
+#define RTE_DFS                         0
+#endif
+
+/* Performance lock taken by drivers for the duration of a transfer */
+#if (RTE_DFS != 0)
+#define DFS_LOCK()                      DFS_Lock()
+#define DFS_UNLOCK()                    DFS_Unlock()
+#else
+#define DFS_LOCK()                      do { } while (0)
+#define DFS_UNLOCK()                    do { } while (0)
+#endif
+
+/* Regulator voltage scaling output selection */
+#if defined(PWR_CR_VOS_0)
+#define DFS_VOS_SCALE1                  (PWR_CR_VOS_0 | PWR_CR_VOS_1)
+#define DFS_VOS_SCALE2                  (PWR_CR_VOS_1)
+#define DFS_VOS_SCALE3                  (PWR_CR_VOS_0)
+#else
+#define DFS_VOS_SCALE1                  (PWR_CR_VOS)
+#define DFS_VOS_SCALE2                  (0U)
+#endif
+
+/*******************************************************************************
+ *  typedefs and structures
+ ******************************************************************************/
+
+/* Operating point. Points using the main PLL must share its source and M
+   factor, the I2S PLL is fed from the same divider. */
+typedef struct DFS_OperatingPoint_s {
+  RCC_PllInit_t PLL;                  // Main PLL, state RCC_PLL_ON or RCC_PLL_OFF
+  uint32_t sys_clk_src;               // RCC_SYSCLK_SRC_xxx
+  uint32_t AHB_clk_div;               // RCC_SYSCLK_DIVx
+  uint32_t APB1_clk_div;              // RCC_HCLK_DIVx
+  uint32_t APB2_clk_div;              // RCC_HCLK_DIVx
+  uint32_t flash_latency;             // FLASH_LATENCY_x for the resulting HCLK
+  uint32_t vos;                       // DFS_VOS_SCALEx
+} DFS_OperatingPoint_t;
+
+typedef struct DFS_Status_s {
+  const DFS_OperatingPoint_t *point;  // Current operating point
+  uint32_t lock_cnt;                  // Performance locks held
+  uint32_t switch_cnt;                // Operating point switches done
+  uint32_t latency_last;              // Duration of the last switch in ns
+  uint32_t latency_max;               // Longest switch duration in ns
+} DFS_Status_t;
+
+/*******************************************************************************
+ *  exported variables
+ ******************************************************************************/
+
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+/**
+ * @fn          int32_t DFS_Initialize(const DFS_OperatingPoint_t *high, const DFS_OperatingPoint_t *low)
+ * @brief       Initialize governor and switch to the high operating point.
+ *              Oscillators used by the points must already be running.
+ * @param[in]   high  Operating point used while a performance lock is held
+ * @param[in]   low   Operating point used when idle
+ * @return      \ref execution_status
+ */
+int32_t DFS_Initialize(const DFS_OperatingPoint_t *high, const DFS_OperatingPoint_t *low);
+
+/**
+ * @fn          void DFS_Lock(void)
+ * @brief       Take performance lock. Switches to the high operating point
+ *              at once when it is not active, may be called from interrupts.
+ */
+void DFS_Lock(void);
+
+/**
+ * @fn          void DFS_Unlock(void)
+ * @brief       Release performance lock. The low operating point is entered
+ *              by the next DFS_Idle call.
+ */
+void DFS_Unlock(void);
+
+/**
+ * @fn          void DFS_Idle(void)
+ * @brief       Switch to the low operating point when no lock is held.
+ *              Intended to be called from the idle loop.
+ */
+void DFS_Idle(void);
+
+/**
+ * @fn          void DFS_GetStatus(DFS_Status_t *status)
+ * @brief       Get governor state and switch latency statistics.
+ * @param[out]  status  Pointer to status
+ */
+void DFS_GetStatus(DFS_Status_t *status);
+
+#endif /* DFS_STM32F4XX_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
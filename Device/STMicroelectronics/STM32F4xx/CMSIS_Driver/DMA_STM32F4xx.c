@@ -38,10 +38,40 @@
 #define DMA_FLAG_HTIF                 (1U << 4) ///< Stream half transfer interrupt flag
 #define DMA_FLAG_TCIF                 (1U << 5) ///< Stream transfer complete interrupt flag
 
+#define DMA_STREAM_NUM                (16U)     ///< DMA1 streams 0..7, DMA2 streams 8..15
+
+/* Request mapping of RM0090, other devices are checked for conflicts only */
+#if defined(STM32F405xx) || defined(STM32F415xx) || defined(STM32F407xx) || defined(STM32F417xx) || \
+    defined(STM32F427xx) || defined(STM32F429xx) || defined(STM32F437xx) || defined(STM32F439xx)
+#define DMA_REQUEST_MAP
+#endif
+
+#if !defined(RTE_DMA1_POOL)
+#define RTE_DMA1_POOL                 (0x00U)
+#endif
+
+#if !defined(RTE_DMA2_POOL)
+#define RTE_DMA2_POOL                 (0x00U)
+#endif
+
+#define DMA_POOL_MASK                 ((uint32_t)RTE_DMA1_POOL | ((uint32_t)RTE_DMA2_POOL << 8U))
+
+#define DMA_MAP(request, dma, stream, channel)  \
+  { DMA_REQUEST_##request, (uint8_t)(((dma) - 1U) * 8U + (stream)), (uint8_t)(channel) }
+
+#define DMA_POOL_IRQ_HANDLER(x, y)    \
+  void DMA##x##_Stream##y##_IRQHandler(void) { DMA_PoolIRQHandler(((x) - 1U) * 8U + (y)); }
+
 /*******************************************************************************
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
 
+typedef struct DMA_RequestMap_s {
+  uint8_t request;                      // DMA_Request_t
+  uint8_t stream;                       // Stream index, DMA_STREAM_NUM range
+  uint8_t channel;                      // Channel number
+} DMA_RequestMap_t;
+
 /*******************************************************************************
  *  global variable definitions  (scope: module-exported)
  ******************************************************************************/
@@ -53,6 +83,70 @@
 /* lookup table for necessary bitshift of flags within status registers */
 static const uint8_t flag_offset[] = {0U, 6U, 16U, 22U};
 
+static DMA_Stream_TypeDef * const StreamBase[DMA_STREAM_NUM] = {
+  DMA1_Stream0, DMA1_Stream1, DMA1_Stream2, DMA1_Stream3,
+  DMA1_Stream4, DMA1_Stream5, DMA1_Stream6, DMA1_Stream7,
+  DMA2_Stream0, DMA2_Stream1, DMA2_Stream2, DMA2_Stream3,
+  DMA2_Stream4, DMA2_Stream5, DMA2_Stream6, DMA2_Stream7,
+};
+
+static const IRQn_Type StreamIRQn[DMA_STREAM_NUM] = {
+  DMA1_Stream0_IRQn, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn,
+  DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, DMA1_Stream7_IRQn,
+  DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn,
+  DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn,
+};
+
+#if defined(DMA_REQUEST_MAP)
+static const DMA_RequestMap_t RequestMap[] = {
+  DMA_MAP(SPI1_RX,     2, 0, 3), DMA_MAP(SPI1_RX,     2, 2, 3),
+  DMA_MAP(SPI1_TX,     2, 3, 3), DMA_MAP(SPI1_TX,     2, 5, 3),
+  DMA_MAP(SPI2_RX,     1, 3, 0),
+  DMA_MAP(SPI2_TX,     1, 4, 0),
+  DMA_MAP(SPI3_RX,     1, 0, 0), DMA_MAP(SPI3_RX,     1, 2, 0),
+  DMA_MAP(SPI3_TX,     1, 5, 0), DMA_MAP(SPI3_TX,     1, 7, 0),
+  DMA_MAP(SPI4_RX,     2, 0, 4), DMA_MAP(SPI4_RX,     2, 3, 5),
+  DMA_MAP(SPI4_TX,     2, 1, 4), DMA_MAP(SPI4_TX,     2, 4, 5),
+  DMA_MAP(SPI5_RX,     2, 3, 2), DMA_MAP(SPI5_RX,     2, 5, 7),
+  DMA_MAP(SPI5_TX,     2, 4, 2), DMA_MAP(SPI5_TX,     2, 6, 7),
+  DMA_MAP(SPI6_RX,     2, 6, 1),
+  DMA_MAP(SPI6_TX,     2, 5, 1),
+  DMA_MAP(I2S2_EXT_RX, 1, 3, 3),
+  DMA_MAP(I2S2_EXT_TX, 1, 4, 2),
+  DMA_MAP(I2S3_EXT_RX, 1, 0, 3), DMA_MAP(I2S3_EXT_RX, 1, 2, 2),
+  DMA_MAP(I2S3_EXT_TX, 1, 5, 2),
+  DMA_MAP(USART1_RX,   2, 2, 4), DMA_MAP(USART1_RX,   2, 5, 4),
+  DMA_MAP(USART1_TX,   2, 7, 4),
+  DMA_MAP(USART2_RX,   1, 5, 4),
+  DMA_MAP(USART2_TX,   1, 6, 4),
+  DMA_MAP(USART3_RX,   1, 1, 4),
+  DMA_MAP(USART3_TX,   1, 3, 4), DMA_MAP(USART3_TX,   1, 4, 7),
+  DMA_MAP(UART4_RX,    1, 2, 4),
+  DMA_MAP(UART4_TX,    1, 4, 4),
+  DMA_MAP(UART5_RX,    1, 0, 4),
+  DMA_MAP(UART5_TX,    1, 7, 4),
+  DMA_MAP(USART6_RX,   2, 1, 5), DMA_MAP(USART6_RX,   2, 2, 5),
+  DMA_MAP(USART6_TX,   2, 6, 5), DMA_MAP(USART6_TX,   2, 7, 5),
+  DMA_MAP(UART7_RX,    1, 3, 5),
+  DMA_MAP(UART7_TX,    1, 1, 5),
+  DMA_MAP(UART8_RX,    1, 6, 5),
+  DMA_MAP(UART8_TX,    1, 0, 5),
+  DMA_MAP(I2C1_RX,     1, 0, 1), DMA_MAP(I2C1_RX,     1, 5, 1),
+  DMA_MAP(I2C1_TX,     1, 6, 1), DMA_MAP(I2C1_TX,     1, 7, 1),
+  DMA_MAP(I2C2_RX,     1, 2, 7), DMA_MAP(I2C2_RX,     1, 3, 7),
+  DMA_MAP(I2C2_TX,     1, 7, 7),
+  DMA_MAP(I2C3_RX,     1, 2, 3),
+  DMA_MAP(I2C3_TX,     1, 4, 3),
+};
+#endif
+
+/* Resources owning each stream, NULL when free */
+static DMA_Resources_t *StreamOwner[DMA_STREAM_NUM];
+
+/* Resources of streams handed out by DMA_StreamAllocate */
+static DMA_Handle_t PoolHandle[DMA_STREAM_NUM];
+static struct DMA_Resources_s PoolResources[DMA_STREAM_NUM];
+
 /*******************************************************************************
  *  function prototypes (scope: module-local)
  ******************************************************************************/
@@ -61,19 +155,114 @@ static const uint8_t flag_offset[] = {0U, 6U, 16U, 22U};
  *  function implementations (scope: module-local)
  ******************************************************************************/
 
+/**
+ * @fn          uint32_t DMA_StreamIndex(const DMA_Stream_TypeDef *stream)
+ * @brief       Get stream index, DMA1 streams 0..7 and DMA2 streams 8..15
+ * @param[in]   stream  Pointer to DMA stream registers
+ * @return      Stream index
+ */
+static
+uint32_t DMA_StreamIndex(const DMA_Stream_TypeDef *stream)
+{
+  uint32_t idx = (((uint32_t)stream & 0xFFU) - 16U) / 24U;
+
+  if (((uint32_t)stream & (uint32_t)(~0x3FF)) == DMA2_BASE)
+    idx += 8U;
+
+  return idx;
+}
+
+/**
+ * @fn          bool DMA_RequestMapped(uint32_t request, uint32_t idx, uint32_t channel)
+ * @brief       Check that a request can be served by a stream and channel
+ * @param[in]   request  DMA_Request_t
+ * @param[in]   idx      Stream index
+ * @param[in]   channel  Channel number
+ * @return      Nonzero when the mapping exists
+ */
+static
+uint32_t DMA_RequestMapped(uint32_t request, uint32_t idx, uint32_t channel)
+{
+  if (request == DMA_REQUEST_NONE)
+    return 1U;
+
+  /* Memory to memory transfers are supported by DMA2 only */
+  if (request == DMA_REQUEST_MEM2MEM)
+    return (idx >= 8U) ? 1U : 0U;
+
+#if defined(DMA_REQUEST_MAP)
+  for (uint32_t i = 0U; i < (sizeof(RequestMap) / sizeof(RequestMap[0])); i++) {
+    if ((RequestMap[i].request == request) &&
+        (RequestMap[i].stream  == idx)     &&
+        (RequestMap[i].channel == channel))
+      return 1U;
+  }
+
+  return 0U;
+#else
+  (void)channel;
+  return 1U;
+#endif
+}
+
+/**
+ * @fn          void DMA_PoolIRQHandler(uint32_t idx)
+ * @brief       Interrupt of a pool stream, routed to its current owner
+ * @param[in]   idx  Stream index
+ */
+static
+void DMA_PoolIRQHandler(uint32_t idx)
+{
+  DMA_Resources_t *res = StreamOwner[idx];
+
+  if (res != NULL)
+    DMA_IRQ_Handle(res);
+  else
+    NVIC_DisableIRQ(StreamIRQn[idx]);
+}
+
 /*******************************************************************************
  *  function implementations (scope: module-exported)
  ******************************************************************************/
 
 /**
- * @fn          void DMA_Initialize(DMA_Resources_t *res)
- * @brief       Initialize DMA stream
+ * @fn          int32_t DMA_Initialize(DMA_Resources_t *res)
+ * @brief       Claim and initialize DMA stream. The stream and channel are
+ *              checked against the request mapping of the device.
  * @param[in]   res  Pointer to DMA resources
+ * @return      ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER for a stream or
+ *              channel not mapped to the request, ARM_DRIVER_ERROR_BUSY when
+ *              the stream is claimed by other resources
  */
-void DMA_Initialize(DMA_Resources_t *res)
+int32_t DMA_Initialize(DMA_Resources_t *res)
 {
+  uint32_t idx, primask;
+
   if (res == NULL)
-    return;
+    return ARM_DRIVER_ERROR_PARAMETER;
+
+  idx = DMA_StreamIndex(res->stream);
+
+  if (DMA_RequestMapped(res->request, idx, (uint32_t)res->channel >> DMA_SxCR_CHSEL_Pos) == 0U)
+    return ARM_DRIVER_ERROR_PARAMETER;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if ((StreamOwner[idx] != NULL) && (StreamOwner[idx] != res)) {
+    __set_PRIMASK(primask);
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  /* Pool streams are handed out by DMA_StreamAllocate only */
+  if ((DMA_POOL_MASK & (1UL << idx)) && (res != &PoolResources[idx])) {
+    __set_PRIMASK(primask);
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  StreamOwner[idx] = res;
+
+  __set_PRIMASK(primask);
 
   uint32_t stream_number = (((uint32_t)res->stream & 0xFFU) - 16U) / 24U;
   uint32_t dma_reg_addr = ((uint32_t)res->stream & (uint32_t)(~0x3FF));
@@ -104,11 +293,13 @@ void DMA_Initialize(DMA_Resources_t *res)
   NVIC_EnableIRQ(res->irq_num);
 
   res->handle->state = DMA_STATE_INITIALIZED;
+
+  return ARM_DRIVER_OK;
 }
 
 /**
  * @fn          void DMA_Uninitialize(DMA_Resources_t res)
- * @brief       Uninitialize DMA stream
+ * @brief       Uninitialize and release DMA stream
  * @param[in]   res  Pointer to DMA resources
  */
 void DMA_Uninitialize(DMA_Resources_t *res)
@@ -117,6 +308,11 @@ void DMA_Uninitialize(DMA_Resources_t *res)
     return;
 
   DMA_Stream_TypeDef *stream = res->stream;
+  uint32_t idx = DMA_StreamIndex(stream);
+
+  /* Stream claimed by other resources is left untouched */
+  if (StreamOwner[idx] != res)
+    return;
 
   /* Disable IRQ */
   NVIC_DisableIRQ(res->irq_num);
@@ -133,11 +329,99 @@ void DMA_Uninitialize(DMA_Resources_t *res)
   res->handle->dma_reg->IFCR = 0x3D << res->handle->bit_offset;
 
   res->handle->state = DMA_STATE_RESET;
+
+  /* Release the stream */
+  StreamOwner[idx] = NULL;
+}
+
+/**
+ * @fn          DMA_Resources_t *DMA_StreamAllocate(DMA_Request_t request, DMA_Priority_t priority, DMA_Callback_t cb_event, uint32_t cb_priority)
+ * @brief       Allocate and initialize a free stream of the pool configured
+ *              by RTE_DMA1_POOL and RTE_DMA2_POOL for a request.
+ * @param[in]   request      DMA request source
+ * @param[in]   priority     DMA stream priority
+ * @param[in]   cb_event     Stream event callback
+ * @param[in]   cb_priority  Stream interrupt priority
+ * @return      Pointer to DMA resources, NULL when no stream is available.
+ *              Devices without request map in this driver (other than
+ *              RM0090 parts) allocate memory to memory streams only,
+ *              peripheral requests need DMA_Initialize with an explicit
+ *              stream and channel.
+ */
+DMA_Resources_t *DMA_StreamAllocate(DMA_Request_t request, DMA_Priority_t priority, DMA_Callback_t cb_event, uint32_t cb_priority)
+{
+  struct DMA_Resources_s *res;
+  uint32_t idx, channel, primask;
+
+  if (request == DMA_REQUEST_NONE)
+    return NULL;
+
+#if !defined(DMA_REQUEST_MAP)
+  /* Channel of a peripheral request is unknown without the request map */
+  if (request != DMA_REQUEST_MEM2MEM)
+    return NULL;
+#endif
+
+  for (idx = 0U; idx < DMA_STREAM_NUM; idx++) {
+    if ((DMA_POOL_MASK & (1UL << idx)) == 0U)
+      continue;
+
+    for (channel = 0U; channel < 8U; channel++) {
+      if (DMA_RequestMapped(request, idx, channel) != 0U)
+        break;
+    }
+
+    if (channel == 8U)
+      continue;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (StreamOwner[idx] != NULL) {
+      __set_PRIMASK(primask);
+      continue;
+    }
+
+    /* Reserve the stream until DMA_Initialize claims it */
+    StreamOwner[idx] = &PoolResources[idx];
+
+    __set_PRIMASK(primask);
+
+    res = &PoolResources[idx];
+    res->handle      = &PoolHandle[idx];
+    res->stream      = StreamBase[idx];
+    res->channel     = (DMA_Channel_t)(channel << DMA_SxCR_CHSEL_Pos);
+    res->priority    = priority;
+    res->cb_event    = cb_event;
+    res->cb_priority = cb_priority;
+    res->irq_num     = StreamIRQn[idx];
+    res->request     = (uint8_t)request;
+
+    DMA_Initialize(res);
+
+    return res;
+  }
+
+  return NULL;
+}
+
+/**
+ * @fn          void DMA_StreamFree(DMA_Resources_t *res)
+ * @brief       Return stream allocated by DMA_StreamAllocate to the pool.
+ * @param[in]   res  Pointer to DMA resources
+ */
+void DMA_StreamFree(DMA_Resources_t *res)
+{
+  if ((res < &PoolResources[0]) || (res >= &PoolResources[DMA_STREAM_NUM]))
+    return;
+
+  DMA_Uninitialize(res);
 }
 
 /**
  * @fn          void DMA_StreamConfig(const DMA_Resources_t *res)
- * @brief       Configure the DMA Stream
+ * @brief       Configure the DMA Stream. Nothing is written when the idle
+ *              stream already holds the configuration.
  * @param[in]   res  Pointer to DMA resources
  */
 void DMA_StreamConfig(const DMA_Resources_t *res)
@@ -145,52 +429,55 @@ void DMA_StreamConfig(const DMA_Resources_t *res)
   if (res == NULL)
     return;
 
-  uint32_t val;
-  DMA_StreamConfig_t *cfg = &res->handle->config;
+  uint32_t cr, fcr;
+  DMA_Handle_t *handle = res->handle;
+  DMA_StreamConfig_t *cfg = &handle->config;
   DMA_Stream_TypeDef *stream = res->stream;
 
-  /* Change DMA peripheral state */
-  res->handle->state = DMA_STATE_BUSY;
-
-  /* Disable the peripheral */
-  stream->CR &= ~DMA_SxCR_EN;
-
-  /* Check if the DMA Stream is disabled */
-  while (stream->CR & DMA_SxCR_EN);
-
-  /* Get the CR register value */
-  val = (stream->CR & (DMA_SxCR_TCIE | DMA_SxCR_HTIE | DMA_SxCR_TEIE | DMA_SxCR_DMEIE));
-
   /* Prepare the DMA Stream configuration */
-  val |= (res->channel      | cfg->Direction    | cfg->PerInc | cfg->MemInc |
-          cfg->PerDataAlign | cfg->MemDataAlign | cfg->Mode   | res->priority);
+  cr = (res->channel      | cfg->Direction    | cfg->PerInc | cfg->MemInc |
+        cfg->PerDataAlign | cfg->MemDataAlign | cfg->Mode   | res->priority);
 
   /* The memory burst and peripheral burst are not used when the FIFO is disabled */
   if(cfg->FIFOMode == DMA_FIFOMODE_ENABLE) {
     /* Get memory burst and peripheral burst */
-    val |= (cfg->MemBurst | cfg->PerBurst);
+    cr |= (cfg->MemBurst | cfg->PerBurst);
   }
 
-  /* Write to DMA Stream CR register */
-  stream->CR = val;
-
-  /* Get the FCR register value */
-  val = (stream->FCR & DMA_SxFCR_FEIE);
-
   /* Prepare the DMA Stream FIFO configuration */
-  val |= cfg->FIFOMode;
+  fcr = cfg->FIFOMode;
 
   /* The FIFO threshold is not used when the FIFO mode is disabled */
   if (cfg->FIFOMode == DMA_FIFOMODE_ENABLE) {
     /* Get the FIFO threshold */
-    val |= cfg->FIFOThreshold;
+    fcr |= cfg->FIFOThreshold;
   }
 
-  /* Write to DMA Stream FCR */
-  stream->FCR = val;
+  /* Idle stream already configured, DMA_StreamEnable only rearms it */
+  if ((handle->state == DMA_STATE_READY) && (handle->cr == cr) && (handle->fcr == fcr) &&
+      ((stream->CR & DMA_SxCR_EN) == 0U))
+    return;
 
   /* Change DMA peripheral state */
-  res->handle->state = DMA_STATE_READY;
+  handle->state = DMA_STATE_BUSY;
+
+  /* Disable the peripheral */
+  stream->CR &= ~DMA_SxCR_EN;
+
+  /* Check if the DMA Stream is disabled */
+  while (stream->CR & DMA_SxCR_EN);
+
+  /* Write to DMA Stream CR register, keep the interrupt enables */
+  stream->CR = (stream->CR & (DMA_SxCR_TCIE | DMA_SxCR_HTIE | DMA_SxCR_TEIE | DMA_SxCR_DMEIE)) | cr;
+
+  /* Write to DMA Stream FCR, keep the FIFO error interrupt enable */
+  stream->FCR = (stream->FCR & DMA_SxFCR_FEIE) | fcr;
+
+  handle->cr  = cr;
+  handle->fcr = fcr;
+
+  /* Change DMA peripheral state */
+  handle->state = DMA_STATE_READY;
 }
 
 /**
@@ -215,15 +502,71 @@ void DMA_StreamEnable(DMA_Resources_t *res, uint32_t per_addr, uint32_t mem_addr
     stream->NDTR = num;
     stream->PAR  = per_addr;
     stream->M0AR = mem_addr;
-    stream->M1AR = 0U;
 
     /* Clear all interrupt flags */
     res->handle->dma_reg->IFCR = 0x3D << res->handle->bit_offset;
 
-    stream->CR |= (DMA_SxCR_TCIE | DMA_SxCR_EN);
+    if (stream->CR & DMA_SxCR_CIRC) {
+      /* Report both ring halves in circular mode */
+      stream->CR |= (DMA_SxCR_HTIE | DMA_SxCR_TCIE | DMA_SxCR_EN);
+    }
+    else {
+      stream->CR |= (DMA_SxCR_TCIE | DMA_SxCR_EN);
+    }
+  }
+}
+
+/**
+ * @fn          void DMA_StreamEnableDoubleBuffer(DMA_Resources_t *res, uint32_t per_addr, uint32_t mem0_addr, uint32_t mem1_addr, uint32_t num)
+ * @brief       Enable stream in double buffer mode
+ * @param[in]   res        Pointer to DMA resources
+ * @param[in]   per_addr   Peripheral address
+ * @param[in]   mem0_addr  Memory 0 address
+ * @param[in]   mem1_addr  Memory 1 address
+ * @param[in]   num        Number of data items per memory buffer
+ */
+void DMA_StreamEnableDoubleBuffer(DMA_Resources_t *res, uint32_t per_addr, uint32_t mem0_addr, uint32_t mem1_addr, uint32_t num)
+{
+  if ((res == NULL) || (per_addr == 0U) || (mem0_addr == 0U) || (mem1_addr == 0U) || (num == 0U))
+    return;
+
+  DMA_Stream_TypeDef *stream = res->stream;
+
+  if (res->handle->state == DMA_STATE_READY) {
+    /* Change DMA peripheral state */
+    res->handle->state = DMA_STATE_BUSY;
+
+    stream->NDTR = num;
+    stream->PAR  = per_addr;
+    stream->M0AR = mem0_addr;
+    stream->M1AR = mem1_addr;
+
+    /* DBM is never part of a prepared configuration, next DMA_StreamConfig rewrites CR */
+    res->handle->cr |= DMA_SxCR_DBM;
+
+    /* Clear all interrupt flags */
+    res->handle->dma_reg->IFCR = 0x3D << res->handle->bit_offset;
+
+    /* Start with memory 0, every transfer complete reports a buffer swap */
+    stream->CR = (stream->CR & ~(DMA_SxCR_CT | DMA_SxCR_HTIE)) |
+                 (DMA_SxCR_DBM | DMA_SxCR_CIRC | DMA_SxCR_TCIE | DMA_SxCR_EN);
   }
 }
 
+/**
+ * @fn          uint32_t DMA_StreamGetTarget(DMA_Resources_t *res)
+ * @brief       Get memory currently targeted by a double buffer stream
+ * @param[in]   res   Pointer to DMA resources
+ * @return      0 = memory 0 (M0AR), 1 = memory 1 (M1AR)
+ */
+uint32_t DMA_StreamGetTarget(DMA_Resources_t *res)
+{
+  if (res == NULL)
+    return 0U;
+
+  return ((res->stream->CR & DMA_SxCR_CT) != 0U) ? 1U : 0U;
+}
+
 /**
  * @fn          void DMA_StreamDisable(DMA_Resources_t *res)
  * @brief       Disable stream and/or stop memory to memory transfer
@@ -240,6 +583,20 @@ void DMA_StreamDisable(DMA_Resources_t *res)
   res->stream->CR &= ~DMA_SxCR_EN;
 }
 
+/**
+ * @fn          uint32_t DMA_StreamGetCount(DMA_Resources_t *res)
+ * @brief       Get number of data items remaining to be transferred
+ * @param[in]   res   Pointer to DMA resources
+ * @return      Value of the stream NDTR register
+ */
+uint32_t DMA_StreamGetCount(DMA_Resources_t *res)
+{
+  if (res == NULL)
+    return 0U;
+
+  return res->stream->NDTR;
+}
+
 /**
  * @fn          void DMA_IRQ_Handle(DMA_Resources_t *res)
  * @brief       DMA Interrupt Handle
@@ -307,11 +664,12 @@ void DMA_IRQ_Handle(DMA_Resources_t *res)
       /* Clear Transfer Complete Interrupt flag */
       dma->IFCR = DMA_FLAG_TCIF << handle->bit_offset;
 
-      if (!(cr & DMA_SxCR_CIRC))
+      if (!(cr & DMA_SxCR_CIRC)) {
         stream->CR &= ~DMA_SxCR_TCIE;
 
-      /* Change the DMA state */
-      handle->state = DMA_STATE_READY;
+        /* Change the DMA state */
+        handle->state = DMA_STATE_READY;
+      }
 
       event |= DMA_EVENT_TRANSFER_COMPLETE;
     }
@@ -321,4 +679,54 @@ void DMA_IRQ_Handle(DMA_Resources_t *res)
     res->cb_event(event);
 }
 
+/* Interrupt handlers of pool streams */
+#if (RTE_DMA1_POOL & (1U << 0))
+DMA_POOL_IRQ_HANDLER(1, 0)
+#endif
+#if (RTE_DMA1_POOL & (1U << 1))
+DMA_POOL_IRQ_HANDLER(1, 1)
+#endif
+#if (RTE_DMA1_POOL & (1U << 2))
+DMA_POOL_IRQ_HANDLER(1, 2)
+#endif
+#if (RTE_DMA1_POOL & (1U << 3))
+DMA_POOL_IRQ_HANDLER(1, 3)
+#endif
+#if (RTE_DMA1_POOL & (1U << 4))
+DMA_POOL_IRQ_HANDLER(1, 4)
+#endif
+#if (RTE_DMA1_POOL & (1U << 5))
+DMA_POOL_IRQ_HANDLER(1, 5)
+#endif
+#if (RTE_DMA1_POOL & (1U << 6))
+DMA_POOL_IRQ_HANDLER(1, 6)
+#endif
+#if (RTE_DMA1_POOL & (1U << 7))
+DMA_POOL_IRQ_HANDLER(1, 7)
+#endif
+#if (RTE_DMA2_POOL & (1U << 0))
+DMA_POOL_IRQ_HANDLER(2, 0)
+#endif
+#if (RTE_DMA2_POOL & (1U << 1))
+DMA_POOL_IRQ_HANDLER(2, 1)
+#endif
+#if (RTE_DMA2_POOL & (1U << 2))
+DMA_POOL_IRQ_HANDLER(2, 2)
+#endif
+#if (RTE_DMA2_POOL & (1U << 3))
+DMA_POOL_IRQ_HANDLER(2, 3)
+#endif
+#if (RTE_DMA2_POOL & (1U << 4))
+DMA_POOL_IRQ_HANDLER(2, 4)
+#endif
+#if (RTE_DMA2_POOL & (1U << 5))
+DMA_POOL_IRQ_HANDLER(2, 5)
+#endif
+#if (RTE_DMA2_POOL & (1U << 6))
+DMA_POOL_IRQ_HANDLER(2, 6)
+#endif
+#if (RTE_DMA2_POOL & (1U << 7))
+DMA_POOL_IRQ_HANDLER(2, 7)
+#endif
+
 /* ----------------------------- End of file ---------------------------------*/
@@ -29,6 +29,8 @@
 
 #include "stm32f4xx.h"
 
+#include "Driver_Common.h"
+
 /*******************************************************************************
  *  defines and macros
  ******************************************************************************/
@@ -64,6 +66,51 @@
 
 typedef void (*DMA_Callback_t)(uint32_t event);
 
+/* DMA request sources known by the stream allocator */
+typedef enum {
+  DMA_REQUEST_NONE = 0U,                /*!< Not checked against request mapping */
+  DMA_REQUEST_MEM2MEM,                  /*!< Memory to memory, any DMA2 stream   */
+  DMA_REQUEST_SPI1_RX,
+  DMA_REQUEST_SPI1_TX,
+  DMA_REQUEST_SPI2_RX,
+  DMA_REQUEST_SPI2_TX,
+  DMA_REQUEST_SPI3_RX,
+  DMA_REQUEST_SPI3_TX,
+  DMA_REQUEST_SPI4_RX,
+  DMA_REQUEST_SPI4_TX,
+  DMA_REQUEST_SPI5_RX,
+  DMA_REQUEST_SPI5_TX,
+  DMA_REQUEST_SPI6_RX,
+  DMA_REQUEST_SPI6_TX,
+  DMA_REQUEST_I2S2_EXT_RX,
+  DMA_REQUEST_I2S2_EXT_TX,
+  DMA_REQUEST_I2S3_EXT_RX,
+  DMA_REQUEST_I2S3_EXT_TX,
+  DMA_REQUEST_USART1_RX,
+  DMA_REQUEST_USART1_TX,
+  DMA_REQUEST_USART2_RX,
+  DMA_REQUEST_USART2_TX,
+  DMA_REQUEST_USART3_RX,
+  DMA_REQUEST_USART3_TX,
+  DMA_REQUEST_UART4_RX,
+  DMA_REQUEST_UART4_TX,
+  DMA_REQUEST_UART5_RX,
+  DMA_REQUEST_UART5_TX,
+  DMA_REQUEST_USART6_RX,
+  DMA_REQUEST_USART6_TX,
+  DMA_REQUEST_UART7_RX,
+  DMA_REQUEST_UART7_TX,
+  DMA_REQUEST_UART8_RX,
+  DMA_REQUEST_UART8_TX,
+  DMA_REQUEST_I2C1_RX,
+  DMA_REQUEST_I2C1_TX,
+  DMA_REQUEST_I2C2_RX,
+  DMA_REQUEST_I2C2_TX,
+  DMA_REQUEST_I2C3_RX,
+  DMA_REQUEST_I2C3_TX,
+  DMA_REQUEST_Reserved = 0x7F
+} DMA_Request_t;
+
 /* DMA States */
 typedef enum {
   DMA_STATE_RESET       = 0U,       /*!< DMA not yet initialized or disabled */
@@ -188,6 +235,8 @@ typedef struct DMA_Handle_s {
   DMA_Base_Reg_t *dma_reg;
   DMA_STATE_t state;
   DMA_StreamConfig_t config;
+  uint32_t cr;                      /*!< Configuration bits last written to CR  */
+  uint32_t fcr;                     /*!< Configuration bits last written to FCR */
 } DMA_Handle_t;
 
 typedef const struct DMA_Resources_s {
@@ -198,7 +247,8 @@ typedef const struct DMA_Resources_s {
   DMA_Callback_t        cb_event;           // Callback event
   uint32_t              cb_priority;        // Callback event priority
   IRQn_Type             irq_num;            // DMA stream IRQ Number
-  uint8_t               reserved[3];        // Reserved
+  uint8_t               request;            // DMA request source, \ref DMA_Request_t
+  uint8_t               reserved[2];        // Reserved
 } DMA_Resources_t;
 
 /*******************************************************************************
@@ -210,22 +260,50 @@ typedef const struct DMA_Resources_s {
  ******************************************************************************/
 
 /**
- * @fn          void DMA_Initialize(DMA_Resources_t *res)
- * @brief       Initialize DMA stream
+ * @fn          int32_t DMA_Initialize(DMA_Resources_t *res)
+ * @brief       Claim and initialize DMA stream. The stream and channel are
+ *              checked against the request mapping of the device.
  * @param[in]   res  Pointer to DMA resources
+ * @return      ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER for a stream or
+ *              channel not mapped to the request, ARM_DRIVER_ERROR_BUSY when
+ *              the stream is claimed by other resources
  */
-void DMA_Initialize(DMA_Resources_t *res);
+int32_t DMA_Initialize(DMA_Resources_t *res);
 
 /**
  * @fn          void DMA_Uninitialize(DMA_Resources_t res)
- * @brief       Uninitialize DMA stream
+ * @brief       Uninitialize and release DMA stream
  * @param[in]   res  Pointer to DMA resources
  */
 void DMA_Uninitialize(DMA_Resources_t *res);
 
+/**
+ * @fn          DMA_Resources_t *DMA_StreamAllocate(DMA_Request_t request, DMA_Priority_t priority, DMA_Callback_t cb_event, uint32_t cb_priority)
+ * @brief       Allocate and initialize a free stream of the pool configured
+ *              by RTE_DMA1_POOL and RTE_DMA2_POOL for a request.
+ * @param[in]   request      DMA request source
+ * @param[in]   priority     DMA stream priority
+ * @param[in]   cb_event     Stream event callback
+ * @param[in]   cb_priority  Stream interrupt priority
+ * @return      Pointer to DMA resources, NULL when no stream is available.
+ *              Devices without request map in this driver (other than
+ *              RM0090 parts) allocate memory to memory streams only,
+ *              peripheral requests need DMA_Initialize with an explicit
+ *              stream and channel.
+ */
+DMA_Resources_t *DMA_StreamAllocate(DMA_Request_t request, DMA_Priority_t priority, DMA_Callback_t cb_event, uint32_t cb_priority);
+
+/**
+ * @fn          void DMA_StreamFree(DMA_Resources_t *res)
+ * @brief       Return stream allocated by DMA_StreamAllocate to the pool.
+ * @param[in]   res  Pointer to DMA resources
+ */
+void DMA_StreamFree(DMA_Resources_t *res);
+
 /**
  * @fn          void DMA_StreamConfig(const DMA_Resources_t *res)
- * @brief       Configure the DMA Stream
+ * @brief       Configure the DMA Stream. Nothing is written when the idle
+ *              stream already holds the configuration.
  * @param[in]   res  Pointer to DMA resources
  */
 void DMA_StreamConfig(const DMA_Resources_t *res);
@@ -240,6 +318,27 @@ void DMA_StreamConfig(const DMA_Resources_t *res);
  */
 void DMA_StreamEnable(DMA_Resources_t *res, uint32_t per_addr, uint32_t mem_addr, uint32_t num);
 
+/**
+ * @fn          void DMA_StreamEnableDoubleBuffer(DMA_Resources_t *res, uint32_t per_addr, uint32_t mem0_addr, uint32_t mem1_addr, uint32_t num)
+ * @brief       Enable stream in double buffer mode. The stream starts with
+ *              memory 0 and swaps to the other memory on every transfer
+ *              complete until it is disabled.
+ * @param[in]   res        Pointer to DMA resources
+ * @param[in]   per_addr   Peripheral address
+ * @param[in]   mem0_addr  Memory 0 address
+ * @param[in]   mem1_addr  Memory 1 address
+ * @param[in]   num        Number of data items per memory buffer
+ */
+void DMA_StreamEnableDoubleBuffer(DMA_Resources_t *res, uint32_t per_addr, uint32_t mem0_addr, uint32_t mem1_addr, uint32_t num);
+
+/**
+ * @fn          uint32_t DMA_StreamGetTarget(DMA_Resources_t *res)
+ * @brief       Get memory currently targeted by a double buffer stream
+ * @param[in]   res   Pointer to DMA resources
+ * @return      0 = memory 0 (M0AR), 1 = memory 1 (M1AR)
+ */
+uint32_t DMA_StreamGetTarget(DMA_Resources_t *res);
+
 /**
  * @fn          void DMA_StreamDisable(DMA_Resources_t *res)
  * @brief       Disable stream and/or stop memory to memory transfer
@@ -247,6 +346,14 @@ void DMA_StreamEnable(DMA_Resources_t *res, uint32_t per_addr, uint32_t mem_addr
  */
 void DMA_StreamDisable(DMA_Resources_t *res);
 
+/**
+ * @fn          uint32_t DMA_StreamGetCount(DMA_Resources_t *res)
+ * @brief       Get number of data items remaining to be transferred
+ * @param[in]   res   Pointer to DMA resources
+ * @return      Value of the stream NDTR register
+ */
+uint32_t DMA_StreamGetCount(DMA_Resources_t *res);
+
 /**
  * @fn          void DMA_IRQ_Handle(DMA_Resources_t *res)
  * @brief       DMA Interrupt Handle
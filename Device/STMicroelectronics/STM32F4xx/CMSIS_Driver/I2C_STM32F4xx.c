@@ -37,6 +37,34 @@
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
 
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+#if defined(USE_I2C1) && defined(I2C1_RX_DMA_Stream)
+static void I2C1_RX_DMA_Complete(uint32_t event);
+#endif
+
+#if defined(USE_I2C1) && defined(I2C1_TX_DMA_Stream)
+static void I2C1_TX_DMA_Complete(uint32_t event);
+#endif
+
+#if defined(USE_I2C2) && defined(I2C2_RX_DMA_Stream)
+static void I2C2_RX_DMA_Complete(uint32_t event);
+#endif
+
+#if defined(USE_I2C2) && defined(I2C2_TX_DMA_Stream)
+static void I2C2_TX_DMA_Complete(uint32_t event);
+#endif
+
+#if defined(USE_I2C3) && defined(I2C3_RX_DMA_Stream)
+static void I2C3_RX_DMA_Complete(uint32_t event);
+#endif
+
+#if defined(USE_I2C3) && defined(I2C3_TX_DMA_Stream)
+static void I2C3_TX_DMA_Complete(uint32_t event);
+#endif
+
 /*******************************************************************************
  *  global variable definitions (scope: module-local)
  ******************************************************************************/
@@ -60,15 +88,55 @@ static const GPIO_PIN_CFG_t I2C_pin_cfg_analog = {
     GPIO_MODE_ANALOG, GPIO_PULL_DISABLE, GPIO_SPEED_LOW
 };
 
+static const GPIO_PIN_CFG_t I2C_pin_cfg_od = {
+    GPIO_MODE_OUT_OD, GPIO_PULL_DISABLE, GPIO_SPEED_MEDIUM
+};
+
 #if defined(USE_I2C1)
 /* I2C1 Information (Run-Time) */
 static I2C_INFO I2C1_Info;
 
+#if defined(I2C1_RX_DMA_Stream)
+static DMA_Handle_t I2C1_RX_DMA_Handle;
+static DMA_Resources_t I2C1_RX_DMA = {
+  &I2C1_RX_DMA_Handle,
+  I2C1_RX_DMA_Stream,
+  I2C1_RX_DMA_Channel,
+  I2C1_RX_DMA_Priority,
+  I2C1_RX_DMA_Complete,
+  RTE_I2C_DMA_INT_PRIORITY,
+  I2C1_RX_DMA_IRQn,
+  DMA_REQUEST_I2C1_RX,
+};
+#endif
+
+#if defined(I2C1_TX_DMA_Stream)
+static DMA_Handle_t I2C1_TX_DMA_Handle;
+static DMA_Resources_t I2C1_TX_DMA = {
+  &I2C1_TX_DMA_Handle,
+  I2C1_TX_DMA_Stream,
+  I2C1_TX_DMA_Channel,
+  I2C1_TX_DMA_Priority,
+  I2C1_TX_DMA_Complete,
+  RTE_I2C_DMA_INT_PRIORITY,
+  I2C1_TX_DMA_IRQn,
+  DMA_REQUEST_I2C1_TX,
+};
+#endif
+
 /* I2C1 Resources */
 static I2C_RESOURCES I2C1_Resources = {
   I2C1,
+#if defined(I2C1_RX_DMA_Stream)
+  &I2C1_RX_DMA,
+#else
   NULL,
+#endif
+#if defined(I2C1_TX_DMA_Stream)
+  &I2C1_TX_DMA,
+#else
   NULL,
+#endif
   {
       I2C1_SCL_GPIO_PORT,
       I2C1_SCL_GPIO_PIN,
@@ -89,11 +157,47 @@ static I2C_RESOURCES I2C1_Resources = {
 /* I2C2 Information (Run-Time) */
 static I2C_INFO I2C2_Info;
 
+#if defined(I2C2_RX_DMA_Stream)
+static DMA_Handle_t I2C2_RX_DMA_Handle;
+static DMA_Resources_t I2C2_RX_DMA = {
+  &I2C2_RX_DMA_Handle,
+  I2C2_RX_DMA_Stream,
+  I2C2_RX_DMA_Channel,
+  I2C2_RX_DMA_Priority,
+  I2C2_RX_DMA_Complete,
+  RTE_I2C_DMA_INT_PRIORITY,
+  I2C2_RX_DMA_IRQn,
+  DMA_REQUEST_I2C2_RX,
+};
+#endif
+
+#if defined(I2C2_TX_DMA_Stream)
+static DMA_Handle_t I2C2_TX_DMA_Handle;
+static DMA_Resources_t I2C2_TX_DMA = {
+  &I2C2_TX_DMA_Handle,
+  I2C2_TX_DMA_Stream,
+  I2C2_TX_DMA_Channel,
+  I2C2_TX_DMA_Priority,
+  I2C2_TX_DMA_Complete,
+  RTE_I2C_DMA_INT_PRIORITY,
+  I2C2_TX_DMA_IRQn,
+  DMA_REQUEST_I2C2_TX,
+};
+#endif
+
 /* I2C2 Resources */
 static I2C_RESOURCES I2C2_Resources = {
   I2C2,
+#if defined(I2C2_RX_DMA_Stream)
+  &I2C2_RX_DMA,
+#else
   NULL,
+#endif
+#if defined(I2C2_TX_DMA_Stream)
+  &I2C2_TX_DMA,
+#else
   NULL,
+#endif
   {
       I2C2_SCL_GPIO_PORT,
       I2C2_SCL_GPIO_PIN,
@@ -113,11 +217,47 @@ static I2C_RESOURCES I2C2_Resources = {
 /* I2C3 Information (Run-Time) */
 static I2C_INFO I2C3_Info;
 
+#if defined(I2C3_RX_DMA_Stream)
+static DMA_Handle_t I2C3_RX_DMA_Handle;
+static DMA_Resources_t I2C3_RX_DMA = {
+  &I2C3_RX_DMA_Handle,
+  I2C3_RX_DMA_Stream,
+  I2C3_RX_DMA_Channel,
+  I2C3_RX_DMA_Priority,
+  I2C3_RX_DMA_Complete,
+  RTE_I2C_DMA_INT_PRIORITY,
+  I2C3_RX_DMA_IRQn,
+  DMA_REQUEST_I2C3_RX,
+};
+#endif
+
+#if defined(I2C3_TX_DMA_Stream)
+static DMA_Handle_t I2C3_TX_DMA_Handle;
+static DMA_Resources_t I2C3_TX_DMA = {
+  &I2C3_TX_DMA_Handle,
+  I2C3_TX_DMA_Stream,
+  I2C3_TX_DMA_Channel,
+  I2C3_TX_DMA_Priority,
+  I2C3_TX_DMA_Complete,
+  RTE_I2C_DMA_INT_PRIORITY,
+  I2C3_TX_DMA_IRQn,
+  DMA_REQUEST_I2C3_TX,
+};
+#endif
+
 /* I2C3 Resources */
 static I2C_RESOURCES I2C3_Resources = {
   I2C3,
+#if defined(I2C3_RX_DMA_Stream)
+  &I2C3_RX_DMA,
+#else
   NULL,
+#endif
+#if defined(I2C3_TX_DMA_Stream)
+  &I2C3_TX_DMA,
+#else
   NULL,
+#endif
   {
       I2C3_SCL_GPIO_PORT,
       I2C3_SCL_GPIO_PIN,
@@ -133,14 +273,441 @@ static I2C_RESOURCES I2C3_Resources = {
 };
 #endif /* USE_I2C3 */
 
-/*******************************************************************************
- *  function prototypes (scope: module-local)
- ******************************************************************************/
-
 /*******************************************************************************
  *  function implementations (scope: module-local)
  ******************************************************************************/
 
+/**
+ * @fn          void I2Cx_MasterDMAStart(I2C_RESOURCES *i2c)
+ * @brief       Arm DMA stream for the data phase of a master transfer. Short
+ *              and 10-bit addressed transfers are done by interrupts.
+ * @param[in]   i2c   Pointer to I2C resources
+ */
+static
+void I2Cx_MasterDMAStart(I2C_RESOURCES *i2c)
+{
+#ifdef I2C_DMA
+  I2C_TRANSFER_INFO *tr = &i2c->info->xfer;
+  DMA_Resources_t *dma;
+
+  dma = (i2c->info->status.direction != 0U) ? i2c->dma_rx : i2c->dma_tx;
+
+  if ((dma == NULL) || (tr->num < 2U) || (tr->num > 0xFFFFU) || (tr->addr & ARM_I2C_ADDRESS_10BIT))
+    return;
+
+  tr->ctrl |= XFER_CTRL_DMA;
+
+  DMA_StreamConfig(dma);
+  DMA_StreamEnable(dma, (uint32_t)&i2c->reg->DR, (uint32_t)tr->data, tr->num);
+
+#if (RTE_I2C_BUS_RECOVERY != 0)
+  /* Event interrupts are masked in the data phase, timeout follows NDTR */
+  i2c->info->dma_cnt = tr->num;
+  i2c->info->stamp   = DWT->CYCCNT;
+#endif
+#else
+  (void)i2c;
+#endif
+}
+
+/**
+ * @fn          void I2Cx_SegmentLoad(I2C_RESOURCES *i2c)
+ * @brief       Prepare transfer information for the active segment of a
+ *              master transfer list.
+ * @param[in]   i2c   Pointer to I2C resources
+ */
+static
+void I2Cx_SegmentLoad(I2C_RESOURCES *i2c)
+{
+  I2C_TRANSFER_INFO *tr = &i2c->info->xfer;
+  const I2C_SEGMENT *seg = &tr->seg[tr->seg_idx];
+
+  tr->num  = seg->num;
+  tr->cnt  = 0U;
+  tr->data = seg->data;
+  tr->addr = (uint16_t)seg->addr;
+  tr->ctrl &= XFER_CTRL_XPENDING;
+
+  if ((tr->seg_idx + 1U) < tr->seg_num) {
+    tr->ctrl |= XFER_CTRL_SEGMENT;
+  }
+
+  if (seg->flags & I2C_SEGMENT_READ) {
+    i2c->info->status.direction = 1U;
+
+    /* Enable acknowledge generation */
+    i2c->reg->CR1 |= I2C_CR1_ACK;
+  }
+  else {
+    i2c->info->status.direction = 0U;
+  }
+
+  I2Cx_MasterDMAStart(i2c);
+}
+
+/**
+ * @fn          void I2Cx_MasterStop(I2C_RESOURCES *i2c)
+ * @brief       End master segment with repeated start when segments follow,
+ *              with stop condition unless the transfer is pending.
+ * @param[in]   i2c   Pointer to I2C resources
+ */
+static
+void I2Cx_MasterStop(I2C_RESOURCES *i2c)
+{
+  uint8_t ctrl = i2c->info->xfer.ctrl;
+
+  if (ctrl & XFER_CTRL_SEGMENT) {
+    i2c->reg->CR1 |= I2C_CR1_START;
+  }
+  else if (ctrl & XFER_CTRL_XPENDING) {
+    i2c->reg->CR2 &= ~I2C_CR2_ITEVTEN;
+  }
+  else {
+    i2c->reg->CR1 |= I2C_CR1_STOP;
+  }
+}
+
+/**
+ * @fn          void I2Cx_MasterDone(I2C_RESOURCES *i2c)
+ * @brief       Master segment completed. Continues with the next segment of
+ *              a transfer list, signals transfer done after the last one.
+ * @param[in]   i2c   Pointer to I2C resources
+ */
+static
+void I2Cx_MasterDone(I2C_RESOURCES *i2c)
+{
+  I2C_INFO *info = i2c->info;
+  I2C_TRANSFER_INFO *tr = &info->xfer;
+
+  if (tr->ctrl & XFER_CTRL_SEGMENT) {
+    tr->seg_cnt += tr->cnt;
+    tr->seg_idx++;
+
+    /* Repeated start is already requested */
+    I2Cx_SegmentLoad(i2c);
+    return;
+  }
+
+  tr->data  =  NULL;
+  tr->ctrl &= ~(XFER_CTRL_XACTIVE | XFER_CTRL_DMA | XFER_CTRL_DMA_DONE);
+
+  info->status.busy = 0U;
+  info->status.mode = 0U;
+
+  if (info->cb_event) {
+    info->cb_event (ARM_I2C_EVENT_TRANSFER_DONE);
+  }
+}
+
+/**
+ * @fn          void I2Cx_Delay(uint32_t us)
+ * @brief       Busy wait used for bit-banged bus clear timing.
+ * @param[in]   us    Delay in microseconds
+ */
+static
+void I2Cx_Delay(uint32_t us)
+{
+  uint32_t cnt = ((RCC_GetFreq(RCC_FREQ_AHB) / 1000000U) * us) / 3U;
+
+  while (cnt--) {
+    __NOP();
+  }
+}
+
+/**
+ * @fn          void I2Cx_Reset(I2C_RESOURCES *i2c)
+ * @brief       Reset I2C peripheral and restore bus speed, own address
+ *              and interrupt configuration.
+ * @param[in]   i2c   Pointer to I2C resources
+ */
+static
+void I2Cx_Reset(I2C_RESOURCES *i2c)
+{
+  I2C_TypeDef *reg = i2c->reg;
+  uint32_t cr1   = reg->CR1 & I2C_CR1_ENGC;
+  uint32_t cr2   = reg->CR2 & I2C_CR2_FREQ;
+  uint32_t ccr   = reg->CCR;
+  uint32_t trise = reg->TRISE;
+  uint32_t oar1  = reg->OAR1;
+  uint32_t oar2  = reg->OAR2;
+
+  RCC_ResetPeriph(i2c->rcc);
+
+  reg->CR2   = cr2 | I2C_CR2_ITEVTEN | I2C_CR2_ITERREN;
+  reg->CCR   = ccr;
+  reg->TRISE = trise;
+  reg->OAR1  = oar1;
+  reg->OAR2  = oar2;
+  reg->CR1   = cr1 | I2C_CR1_PE;
+  /* ACK can be set only while the peripheral is enabled */
+  reg->CR1  |= I2C_CR1_ACK;
+}
+
+/**
+ * @fn          int32_t I2Cx_Abort(I2C_RESOURCES *i2c)
+ * @brief       Abort current transfer. The peripheral is reset, which
+ *              releases SCL and SDA on our side.
+ * @param[in]   i2c   Pointer to I2C resources
+ * @return      \ref execution_status
+ */
+static
+int32_t I2Cx_Abort(I2C_RESOURCES *i2c)
+{
+  I2C_INFO *info = i2c->info;
+
+  NVIC_DisableIRQ(i2c->ev_irq_num);
+  NVIC_DisableIRQ(i2c->er_irq_num);
+
+  info->xfer.data = NULL;
+  info->xfer.ctrl = 0U;
+
+#ifdef I2C_DMA
+  DMA_StreamDisable(i2c->dma_rx);
+  DMA_StreamDisable(i2c->dma_tx);
+#endif
+
+  I2Cx_Reset(i2c);
+
+  info->status.busy      = 0U;
+  info->status.mode      = 0U;
+  info->status.direction = 0U;
+
+  NVIC_ClearPendingIRQ(i2c->ev_irq_num);
+  NVIC_ClearPendingIRQ(i2c->er_irq_num);
+  NVIC_EnableIRQ(i2c->ev_irq_num);
+  NVIC_EnableIRQ(i2c->er_irq_num);
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn          int32_t I2Cx_BusClear(I2C_RESOURCES *i2c)
+ * @brief       Clock out nine SCL pulses followed by a STOP condition to
+ *              release a slave holding SDA low, then reset the peripheral.
+ * @param[in]   i2c   Pointer to I2C resources
+ * @return      \ref execution_status
+ */
+static
+int32_t I2Cx_BusClear(I2C_RESOURCES *i2c)
+{
+  I2C_IO *io = &i2c->io;
+  uint32_t i, tmo;
+  bool released;
+
+  i2c->reg->CR1 &= ~I2C_CR1_PE;
+
+  /* Drive the lines as open-drain outputs */
+  GPIO_PinWrite(io->scl_port, io->scl_pin, GPIO_PIN_OUT_HIGH);
+  GPIO_PinWrite(io->sda_port, io->sda_pin, GPIO_PIN_OUT_HIGH);
+  GPIO_PinConfig(io->scl_port, io->scl_pin, &I2C_pin_cfg_od);
+  GPIO_PinConfig(io->sda_port, io->sda_pin, &I2C_pin_cfg_od);
+
+  for (i = 0U; i < 9U; i++) {
+    GPIO_PinWrite(io->scl_port, io->scl_pin, GPIO_PIN_OUT_LOW);
+    I2Cx_Delay(5U);
+    GPIO_PinWrite(io->scl_port, io->scl_pin, GPIO_PIN_OUT_HIGH);
+
+    /* Slave may stretch the clock, wait up to 1ms */
+    for (tmo = 1000U; (tmo != 0U) && (GPIO_PinRead(io->scl_port, io->scl_pin) == 0U); tmo--) {
+      I2Cx_Delay(1U);
+    }
+    I2Cx_Delay(5U);
+  }
+
+  /* STOP condition: SDA rises while SCL is high */
+  GPIO_PinWrite(io->scl_port, io->scl_pin, GPIO_PIN_OUT_LOW);
+  I2Cx_Delay(5U);
+  GPIO_PinWrite(io->sda_port, io->sda_pin, GPIO_PIN_OUT_LOW);
+  I2Cx_Delay(5U);
+  GPIO_PinWrite(io->scl_port, io->scl_pin, GPIO_PIN_OUT_HIGH);
+  I2Cx_Delay(5U);
+  GPIO_PinWrite(io->sda_port, io->sda_pin, GPIO_PIN_OUT_HIGH);
+  I2Cx_Delay(5U);
+
+  released = (GPIO_PinRead(io->scl_port, io->scl_pin) != 0U) &&
+             (GPIO_PinRead(io->sda_port, io->sda_pin) != 0U);
+
+  /* Give the pins back to the peripheral */
+  GPIO_PinConfig(io->scl_port, io->scl_pin, &I2C_pin_cfg_af);
+  GPIO_PinConfig(io->sda_port, io->sda_pin, &I2C_pin_cfg_af);
+
+  /* Reset clears a BUSY flag latched by the glitches above */
+  I2Cx_Reset(i2c);
+
+  if (i2c->info->cb_event != NULL) {
+    i2c->info->cb_event (ARM_I2C_EVENT_BUS_CLEAR);
+  }
+
+  return (released ? ARM_DRIVER_OK : ARM_DRIVER_ERROR);
+}
+
+#if (RTE_I2C_BUS_RECOVERY != 0)
+/**
+ * @fn          bool I2Cx_Timeout(I2C_RESOURCES *i2c)
+ * @brief       Check if the bus showed no activity for the recovery timeout.
+ *              A DMA data phase counts as activity while NDTR moves.
+ * @param[in]   i2c   Pointer to I2C resources
+ * @return      true when timed out
+ */
+static
+bool I2Cx_Timeout(I2C_RESOURCES *i2c)
+{
+  I2C_INFO *info = i2c->info;
+  uint32_t tmo = (RCC_GetFreq(RCC_FREQ_AHB) / 1000U) * RTE_I2C_BUS_TIMEOUT;
+
+#ifdef I2C_DMA
+  if ((info->xfer.ctrl & (XFER_CTRL_DMA | XFER_CTRL_DMA_DONE)) == XFER_CTRL_DMA) {
+    DMA_Resources_t *dma = (info->status.direction != 0U) ? i2c->dma_rx : i2c->dma_tx;
+    uint32_t cnt = DMA_StreamGetCount(dma);
+
+    if (cnt != info->dma_cnt) {
+      info->dma_cnt = cnt;
+      info->stamp   = DWT->CYCCNT;
+    }
+  }
+#endif
+
+  return ((DWT->CYCCNT - info->stamp) > tmo);
+}
+#endif
+
+/**
+ * @fn          int32_t I2Cx_BusSpeed(I2C_RESOURCES *i2c, uint32_t speed)
+ * @brief       Program CR2.FREQ, CCR and TRISE for bus speed from the
+ *              current peripheral clock.
+ * @param[in]   i2c     Pointer to I2C resources
+ * @param[in]   speed   ARM_I2C_BUS_SPEED_xxx
+ * @return      \ref execution_status
+ */
+static
+int32_t I2Cx_BusSpeed(I2C_RESOURCES *i2c, uint32_t speed)
+{
+  I2C_TypeDef *reg = i2c->reg;
+  uint32_t ccr, trise;
+  uint32_t pclk = RCC_GetPeriphFreq(i2c->rcc);
+
+  switch (speed) {
+    case ARM_I2C_BUS_SPEED_STANDARD:
+      /* Clock = 100kHz,  Rise Time = 1000ns */
+      if (pclk > 50000000U) { return ARM_DRIVER_ERROR_UNSUPPORTED; }
+      if (pclk <  2000000U) { return ARM_DRIVER_ERROR_UNSUPPORTED; }
+      ccr   = (pclk /  100000U) / 2U;
+      trise = (pclk / 1000000U) + 1U;
+      break;
+    case ARM_I2C_BUS_SPEED_FAST:
+      /* Clock = 400kHz,  Rise Time = 300ns */
+      if (pclk > 50000000U) { return ARM_DRIVER_ERROR_UNSUPPORTED; }
+      if (pclk <  4000000U) { return ARM_DRIVER_ERROR_UNSUPPORTED; }
+      if ((pclk >= 10000000U) && ((pclk % 10000000U) == 0U)) {
+        ccr = I2C_CCR_FS | I2C_CCR_DUTY | ((pclk / 400000U) / 25U);
+      } else {
+        ccr = I2C_CCR_FS |                ((pclk / 400000U) / 3U);
+      }
+      trise = (((pclk / 1000000U) * 300U) / 1000U) + 1U;
+      break;
+    default:
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+
+  reg->CR1   &= ~I2C_CR1_PE;           /* Disable I2C peripheral */
+  reg->CR2   &= ~I2C_CR2_FREQ;
+  reg->CR2   |=  pclk / 1000000U;
+  reg->CCR    =  ccr;
+  reg->TRISE  =  trise;
+  reg->CR1   |=  I2C_CR1_PE;           /* Enable I2C peripheral */
+  reg->CR1   |=  I2C_CR1_ACK;          /* Enable acknowledge    */
+
+  i2c->info->bus_speed = speed;
+  i2c->info->flags    |= I2C_FLAG_SETUP;
+  i2c->info->flags    &= ~I2C_FLAG_RETIME;
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn          void I2Cx_ClockEvent(uint32_t event, void *arg)
+ * @brief       Recompute bus timing after a clock tree change. While a
+ *              transfer is in progress the update is deferred to the start
+ *              of the next master transfer.
+ * @param[in]   event  RCC_CLOCK_EVENT_xxx
+ * @param[in]   arg    Pointer to I2C resources
+ */
+static
+void I2Cx_ClockEvent(uint32_t event, void *arg)
+{
+  I2C_RESOURCES *i2c = (I2C_RESOURCES *)arg;
+  I2C_INFO *info = i2c->info;
+
+  if ((event & RCC_CLOCK_EVENT_CHANGED) == 0U)
+    return;
+
+  if ((info->flags & I2C_FLAG_SETUP) == 0U)
+    return;
+
+  if (info->status.busy || (info->xfer.ctrl & XFER_CTRL_XPENDING) || (i2c->reg->SR2 & I2C_SR2_BUSY)) {
+    info->flags |= I2C_FLAG_RETIME;
+    return;
+  }
+
+  I2Cx_BusSpeed(i2c, info->bus_speed);
+}
+
+/**
+ * @fn          int32_t I2Cx_BusAcquire(I2C_RESOURCES *i2c)
+ * @brief       Check driver state and wait for a free bus before a master
+ *              transfer. With bus recovery enabled a stalled transfer is
+ *              aborted and a bus held low is cleared after the timeout.
+ * @param[in]   i2c   Pointer to I2C resources
+ * @return      \ref execution_status
+ */
+static
+int32_t I2Cx_BusAcquire(I2C_RESOURCES *i2c)
+{
+  I2C_INFO *info = i2c->info;
+
+#if (RTE_I2C_BUS_RECOVERY != 0)
+  if (info->status.busy) {
+    if (!I2Cx_Timeout(i2c)) {
+      return ARM_DRIVER_ERROR_BUSY;
+    }
+    I2Cx_Abort(i2c);
+  }
+
+  if ((info->xfer.ctrl & XFER_CTRL_XPENDING) == 0U) {
+    /* New transfer */
+    info->stamp = DWT->CYCCNT;
+
+    while (i2c->reg->SR2 & I2C_SR2_BUSY) {
+      if (I2Cx_Timeout(i2c)) {
+        if ((I2Cx_BusClear(i2c) != ARM_DRIVER_OK) || (i2c->reg->SR2 & I2C_SR2_BUSY)) {
+          return ARM_DRIVER_ERROR_BUSY;
+        }
+      }
+    }
+  }
+
+  info->stamp = DWT->CYCCNT;
+#else
+  if (info->status.busy) {
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  if ((info->xfer.ctrl & XFER_CTRL_XPENDING) == 0U) {
+    /* New transfer */
+    while (i2c->reg->SR2 & I2C_SR2_BUSY) {
+      ; /* Wait until bus released */
+    }
+  }
+#endif
+
+  if ((info->flags & I2C_FLAG_RETIME) && ((info->xfer.ctrl & XFER_CTRL_XPENDING) == 0U)) {
+    /* Bus is idle, apply timing for the changed peripheral clock */
+    I2Cx_BusSpeed(i2c, info->bus_speed);
+  }
+
+  return ARM_DRIVER_OK;
+}
+
 /**
  * @fn      ARM_DRIVER_VERSION I2C_GetVersion(void)
  * @brief   Get driver version.
@@ -243,9 +810,21 @@ int32_t I2Cx_PowerControl(ARM_POWER_STATE state, I2C_RESOURCES *i2c)
       NVIC_DisableIRQ(i2c->ev_irq_num);
       NVIC_DisableIRQ(i2c->er_irq_num);
 
+      /* Uninitialize DMA */
+#ifdef I2C_DMA
+      if (i2c->dma_rx != NULL)
+        DMA_Uninitialize(i2c->dma_rx);
+
+      if (i2c->dma_tx != NULL)
+        DMA_Uninitialize(i2c->dma_tx);
+#endif
+
       /* Disable peripheral clock */
       RCC_DisablePeriph(i2c->rcc);
 
+      /* Stop following clock changes */
+      RCC_ClockUnsubscribe(&info->clk_sub);
+
       info->status.busy             = 0U;
       info->status.mode             = 0U;
       info->status.direction        = 0U;
@@ -253,7 +832,7 @@ int32_t I2Cx_PowerControl(ARM_POWER_STATE state, I2C_RESOURCES *i2c)
       info->status.arbitration_lost = 0U;
       info->status.bus_error        = 0U;
 
-      info->flags &= ~I2C_FLAG_POWER;
+      info->flags &= ~(I2C_FLAG_POWER | I2C_FLAG_SETUP | I2C_FLAG_RETIME);
       break;
 
     case ARM_POWER_FULL:
@@ -274,6 +853,47 @@ int32_t I2Cx_PowerControl(ARM_POWER_STATE state, I2C_RESOURCES *i2c)
       NVIC_EnableIRQ(i2c->ev_irq_num);
       NVIC_EnableIRQ(i2c->er_irq_num);
 
+      /* Initialize DMA */
+#ifdef I2C_DMA
+      if (i2c->dma_rx != NULL) {
+        DMA_StreamConfig_t *cfg = &i2c->dma_rx->handle->config;
+
+        cfg->Direction    = DMA_DIR_PER_TO_MEM;
+        cfg->PerInc       = DMA_PINC_DISABLE;
+        cfg->MemInc       = DMA_MINC_ENABLE;
+        cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+        cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+        cfg->Mode         = DMA_MODE_NORMAL;
+        cfg->FIFOMode     = DMA_FIFOMODE_DISABLE;
+        cfg->MemBurst     = DMA_MBURST_SINGLE;
+        cfg->PerBurst     = DMA_PBURST_SINGLE;
+
+        if (DMA_Initialize(i2c->dma_rx) != ARM_DRIVER_OK) {
+          I2Cx_PowerControl(ARM_POWER_OFF, i2c);
+          return ARM_DRIVER_ERROR;
+        }
+      }
+
+      if (i2c->dma_tx != NULL) {
+        DMA_StreamConfig_t *cfg = &i2c->dma_tx->handle->config;
+
+        cfg->Direction    = DMA_DIR_MEM_TO_PER;
+        cfg->PerInc       = DMA_PINC_DISABLE;
+        cfg->MemInc       = DMA_MINC_ENABLE;
+        cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+        cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+        cfg->Mode         = DMA_MODE_NORMAL;
+        cfg->FIFOMode     = DMA_FIFOMODE_DISABLE;
+        cfg->MemBurst     = DMA_MBURST_SINGLE;
+        cfg->PerBurst     = DMA_PBURST_SINGLE;
+
+        if (DMA_Initialize(i2c->dma_tx) != ARM_DRIVER_OK) {
+          I2Cx_PowerControl(ARM_POWER_OFF, i2c);
+          return ARM_DRIVER_ERROR;
+        }
+      }
+#endif
+
       /* Reset the peripheral */
       RCC_ResetPeriph(i2c->rcc);
 
@@ -291,6 +911,17 @@ int32_t I2Cx_PowerControl(ARM_POWER_STATE state, I2C_RESOURCES *i2c)
       /* Enable acknowledge */
       reg->CR1 |= I2C_CR1_ACK;
 
+#if (RTE_I2C_BUS_RECOVERY != 0)
+      /* Cycle counter for bus timeout tracking */
+      CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+      DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+      /* Follow clock tree changes */
+      info->clk_sub.cb_event = I2Cx_ClockEvent;
+      info->clk_sub.arg      = (void *)((uint32_t)i2c);
+      RCC_ClockSubscribe(&info->clk_sub);
+
       /* Ready for operation */
       info->flags |= I2C_FLAG_POWER;
       break;
@@ -339,48 +970,16 @@ int32_t I2Cx_Control(uint32_t control, uint32_t arg, I2C_RESOURCES *i2c)
       break;
 
     case ARM_I2C_BUS_SPEED:
-    {
-      uint32_t ccr, trise;
-      uint32_t pclk = RCC_GetPeriphFreq(i2c->rcc);
-
-      switch (arg) {
-        case ARM_I2C_BUS_SPEED_STANDARD:
-          /* Clock = 100kHz,  Rise Time = 1000ns */
-          if (pclk > 50000000U) { return ARM_DRIVER_ERROR_UNSUPPORTED; }
-          if (pclk <  2000000U) { return ARM_DRIVER_ERROR_UNSUPPORTED; }
-          ccr   = (pclk /  100000U) / 2U;
-          trise = (pclk / 1000000U) + 1U;
-          break;
-        case ARM_I2C_BUS_SPEED_FAST:
-          /* Clock = 400kHz,  Rise Time = 300ns */
-          if (pclk > 50000000U) { return ARM_DRIVER_ERROR_UNSUPPORTED; }
-          if (pclk <  4000000U) { return ARM_DRIVER_ERROR_UNSUPPORTED; }
-          if ((pclk >= 10000000U) && ((pclk % 10000000U) == 0U)) {
-            ccr = I2C_CCR_FS | I2C_CCR_DUTY | ((pclk / 400000U) / 25U);
-          } else {
-            ccr = I2C_CCR_FS |                ((pclk / 400000U) / 3U);
-          }
-          trise = (((pclk / 1000000U) * 300U) / 1000U) + 1U;
-          break;
-        default:
-          return ARM_DRIVER_ERROR_UNSUPPORTED;
-      }
-
-      reg->CR1   &= ~I2C_CR1_PE;           /* Disable I2C peripheral */
-      reg->CR2   &= ~I2C_CR2_FREQ;
-      reg->CR2   |=  pclk / 1000000U;
-      reg->CCR    =  ccr;
-      reg->TRISE  =  trise;
-      reg->CR1   |=  I2C_CR1_PE;           /* Enable I2C peripheral */
-      reg->CR1   |=  I2C_CR1_ACK;          /* Enable acknowledge    */
-    }
-    break;
+      return I2Cx_BusSpeed(i2c, arg);
 
     case ARM_I2C_BUS_CLEAR:
-      return ARM_DRIVER_ERROR_UNSUPPORTED;
+      if (i2c->info->status.busy) {
+        return ARM_DRIVER_ERROR_BUSY;
+      }
+      return I2Cx_BusClear(i2c);
 
     case ARM_I2C_ABORT_TRANSFER:
-      return ARM_DRIVER_ERROR_UNSUPPORTED;
+      return I2Cx_Abort(i2c);
 
     default:
       return ARM_DRIVER_ERROR_UNSUPPORTED;
@@ -409,6 +1008,7 @@ int32_t I2Cx_MasterTransmit(uint32_t addr, const uint8_t *data, uint32_t num,
 {
   I2C_INFO *info = i2c->info;
   I2C_TypeDef *reg = i2c->reg;
+  int32_t status;
 
   if ((data == NULL) || (num == 0U)) {
     return ARM_DRIVER_ERROR_PARAMETER;
@@ -418,15 +1018,9 @@ int32_t I2Cx_MasterTransmit(uint32_t addr, const uint8_t *data, uint32_t num,
     return ARM_DRIVER_ERROR_PARAMETER;
   }
 
-  if (info->status.busy) {
-    return ARM_DRIVER_ERROR_BUSY;
-  }
-
-  if ((info->xfer.ctrl & XFER_CTRL_XPENDING) == 0U) {
-    /* New transfer */
-    while (reg->SR2 & I2C_SR2_BUSY) {
-      ; /* Wait until bus released */
-    }
+  status = I2Cx_BusAcquire(i2c);
+  if (status != ARM_DRIVER_OK) {
+    return status;
   }
 
   info->status.busy             = 1U;
@@ -440,11 +1034,14 @@ int32_t I2Cx_MasterTransmit(uint32_t addr, const uint8_t *data, uint32_t num,
   info->xfer.data = (uint8_t *)data;
   info->xfer.addr = (uint16_t)(addr);
   info->xfer.ctrl = 0U;
+  info->xfer.seg_cnt = 0;
 
   if (xfer_pending) {
     info->xfer.ctrl |= XFER_CTRL_XPENDING;
   }
 
+  I2Cx_MasterDMAStart(i2c);
+
   /* Generate start and enable event interrupts */
   reg->CR2 &= ~I2C_CR2_ITEVTEN;
   reg->CR1 |=  I2C_CR1_START;
@@ -473,6 +1070,7 @@ int32_t I2Cx_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num,
 {
   I2C_INFO *info = i2c->info;
   I2C_TypeDef *reg = i2c->reg;
+  int32_t status;
 
   if ((data == NULL) || (num == 0U)) {
     return ARM_DRIVER_ERROR_PARAMETER;
@@ -482,15 +1080,9 @@ int32_t I2Cx_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num,
     return ARM_DRIVER_ERROR_PARAMETER;
   }
 
-  if (info->status.busy) {
-    return ARM_DRIVER_ERROR_BUSY;
-  }
-
-  if ((info->xfer.ctrl & XFER_CTRL_XPENDING) == 0U) {
-    /* New transfer */
-    while (reg->SR2 & I2C_SR2_BUSY) {
-      ; /* Wait until bus released */
-    }
+  status = I2Cx_BusAcquire(i2c);
+  if (status != ARM_DRIVER_OK) {
+    return status;
   }
 
   info->status.busy             = 1U;
@@ -504,6 +1096,7 @@ int32_t I2Cx_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num,
   info->xfer.data = data;
   info->xfer.addr = (uint16_t)(addr);
   info->xfer.ctrl = 0U;
+  info->xfer.seg_cnt = 0;
 
   if (xfer_pending) {
     info->xfer.ctrl |= XFER_CTRL_XPENDING;
@@ -512,6 +1105,75 @@ int32_t I2Cx_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num,
   /* Enable acknowledge generation */
   reg->CR1 |= I2C_CR1_ACK;
 
+  I2Cx_MasterDMAStart(i2c);
+
+  /* Generate start and enable event interrupts */
+  reg->CR2 &= ~I2C_CR2_ITEVTEN;
+  reg->CR1 |=  I2C_CR1_START;
+  reg->CR2 |=  I2C_CR2_ITEVTEN;
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn          int32_t I2Cx_MasterTransfer(const I2C_SEGMENT *seg,
+ *                                          uint32_t seg_num,
+ *                                          bool xfer_pending,
+ *                                          I2C_RESOURCES *i2c)
+ * @brief       Start list of master transmit and receive segments. Segments
+ *              are chained with repeated start, one transfer done event is
+ *              signaled after the last segment.
+ * @param[in]   seg           Pointer to segment list, must stay valid until done
+ * @param[in]   seg_num       Number of segments
+ * @param[in]   xfer_pending  Transfer operation is pending - Stop condition will not be generated
+ * @param[in]   i2c           Pointer to I2C resources
+ * @return      \ref execution_status
+ */
+static
+int32_t I2Cx_MasterTransfer(const I2C_SEGMENT *seg, uint32_t seg_num,
+                            bool xfer_pending, I2C_RESOURCES *i2c)
+{
+  I2C_INFO *info = i2c->info;
+  I2C_TypeDef *reg = i2c->reg;
+  int32_t status;
+  uint32_t i;
+
+  if ((seg == NULL) || (seg_num == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  for (i = 0U; i < seg_num; i++) {
+    if ((seg[i].data == NULL) || (seg[i].num == 0U)) {
+      return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    if ((seg[i].addr & ~(ARM_I2C_ADDRESS_10BIT | ARM_I2C_ADDRESS_GC)) > 0x3FFU) {
+      return ARM_DRIVER_ERROR_PARAMETER;
+    }
+  }
+
+  status = I2Cx_BusAcquire(i2c);
+  if (status != ARM_DRIVER_OK) {
+    return status;
+  }
+
+  info->status.busy             = 1U;
+  info->status.mode             = 1U;
+  info->status.bus_error        = 0U;
+  info->status.arbitration_lost = 0U;
+
+  info->xfer.seg     = seg;
+  info->xfer.seg_num = seg_num;
+  info->xfer.seg_idx = 0U;
+  info->xfer.seg_cnt = 0;
+  info->xfer.ctrl    = 0U;
+
+  if (xfer_pending) {
+    info->xfer.ctrl |= XFER_CTRL_XPENDING;
+  }
+
+  I2Cx_SegmentLoad(i2c);
+
   /* Generate start and enable event interrupts */
   reg->CR2 &= ~I2C_CR2_ITEVTEN;
   reg->CR1 |=  I2C_CR1_START;
@@ -551,6 +1213,7 @@ int32_t I2Cx_SlaveTransmit(const uint8_t *data, uint32_t num, I2C_RESOURCES *i2c
   info->xfer.cnt  = 0U;
   info->xfer.data = (uint8_t *)data;
   info->xfer.ctrl = 0U;
+  info->xfer.seg_cnt = 0;
 
   /* Enable acknowledge */
   reg->CR1 |= I2C_CR1_ACK;
@@ -592,6 +1255,7 @@ int32_t I2Cx_SlaveReceive(uint8_t *data, uint32_t num, I2C_RESOURCES *i2c)
   info->xfer.cnt  = 0U;
   info->xfer.data = data;
   info->xfer.ctrl = 0U;
+  info->xfer.seg_cnt = 0;
 
   /* Enable acknowledge generation */
   reg->CR2 |= I2C_CR2_LAST;
@@ -612,7 +1276,7 @@ int32_t I2Cx_SlaveReceive(uint8_t *data, uint32_t num, I2C_RESOURCES *i2c)
 static
 int32_t I2Cx_GetDataCount(I2C_RESOURCES *i2c)
 {
-  return i2c->info->xfer.cnt;
+  return (i2c->info->xfer.seg_cnt + i2c->info->xfer.cnt);
 }
 
 /**
@@ -641,9 +1305,22 @@ void I2Cx_EV_IRQHandler(I2C_RESOURCES *i2c)
 
   sr1 = (uint16_t)i2c->reg->SR1;
 
+#if (RTE_I2C_BUS_RECOVERY != 0)
+  /* Bus activity, restart timeout */
+  i2c->info->stamp = DWT->CYCCNT;
+#endif
+
   if (sr1 & I2C_SR1_SB) {
     /* (EV5): start bit generated, send address */
 
+    if ((tr->ctrl & XFER_CTRL_XACTIVE) && (sr1 & I2C_SR1_RXNE)) {
+      /* Byte of a single byte segment still unread at repeated start */
+      i2c->reg->CR2 &= ~I2C_CR2_ITBUFEN;
+      tr->data[tr->cnt++] = (uint8_t)i2c->reg->DR;
+
+      I2Cx_MasterDone(i2c);
+    }
+
     if (tr->addr & ARM_I2C_ADDRESS_10BIT) {
       /* 10-bit addressing mode */
       data = (uint8_t)(0xF0U | ((tr->addr >> 7) & 0x06U));
@@ -687,7 +1364,11 @@ void I2Cx_EV_IRQHandler(I2C_RESOURCES *i2c)
 
     if ((i2c->info->status.mode != 0U) && (i2c->info->status.direction != 0U)) {
       /* Master mode, receiver */
-      if (tr->num == 1U) {
+      if (tr->ctrl & XFER_CTRL_DMA) {
+        /* NACK follows the last byte of the DMA transfer */
+        i2c->reg->CR2 |= I2C_CR2_LAST | I2C_CR2_DMAEN;
+      }
+      else if (tr->num == 1U) {
         i2c->reg->CR1 &= ~I2C_CR1_ACK;
       }
 
@@ -700,9 +1381,13 @@ void I2Cx_EV_IRQHandler(I2C_RESOURCES *i2c)
         /* Generate repeated start */
         i2c->reg->CR1 |= I2C_CR1_START;
       }
-      else {
+      else if ((tr->ctrl & XFER_CTRL_DMA) == 0U) {
         if (tr->num == 1U) {
-          if ((tr->ctrl & XFER_CTRL_XPENDING) == 0U) {
+          if (tr->ctrl & XFER_CTRL_SEGMENT) {
+            /* Repeated start after the byte */
+            i2c->reg->CR1 |= I2C_CR1_START;
+          }
+          else if ((tr->ctrl & XFER_CTRL_XPENDING) == 0U) {
             i2c->reg->CR1 |= I2C_CR1_STOP;
           }
         }
@@ -765,8 +1450,9 @@ void I2Cx_EV_IRQHandler(I2C_RESOURCES *i2c)
 
     tr->ctrl |= XFER_CTRL_ADDR_DONE | XFER_CTRL_XACTIVE;
 
-    if ((i2c->dma_rx != NULL) && (i2c->dma_tx != NULL)) {
-      /* Enable DMA data transfer */
+    if (tr->ctrl & XFER_CTRL_DMA) {
+      /* Enable DMA data transfer, DMA completion reenables events */
+      i2c->reg->CR2 &= ~I2C_CR2_ITEVTEN;
       i2c->reg->CR2 |= I2C_CR2_DMAEN;
     }
     else {
@@ -801,24 +1487,9 @@ void I2Cx_EV_IRQHandler(I2C_RESOURCES *i2c)
     /* BTF, RxNE or TxE interrupt */
     if (tr->ctrl & XFER_CTRL_DMA_DONE) {
       /* BTF triggered this event */
-      if (i2c->info->status.mode) {
-        if (i2c->info->xfer.ctrl & XFER_CTRL_XPENDING) {
-          /* Disable event interrupt */
-          i2c->reg->CR2 &= ~I2C_CR2_ITEVTEN;
-        }
-        else {
-          /* Generate stop condition */
-          i2c->reg->CR1 |= I2C_CR1_STOP;
-        }
-        tr->data  =  NULL;
-        tr->ctrl &= ~XFER_CTRL_XACTIVE;
-
-        i2c->info->status.busy = 0U;
-        i2c->info->status.mode = 0U;
-
-        if (i2c->info->cb_event) {
-          i2c->info->cb_event (ARM_I2C_EVENT_TRANSFER_DONE);
-        }
+      if ((i2c->info->status.mode) && (sr1 & I2C_SR1_BTF)) {
+        I2Cx_MasterStop(i2c);
+        I2Cx_MasterDone(i2c);
       }
     }
     else if (sr1 & I2C_SR1_TXE) {
@@ -829,22 +1500,8 @@ void I2Cx_EV_IRQHandler(I2C_RESOURCES *i2c)
             /* End master transmit operation */
             i2c->reg->CR2 &= ~I2C_CR2_ITBUFEN;
 
-            if (tr->ctrl & XFER_CTRL_XPENDING) {
-              i2c->reg->CR2 &= ~I2C_CR2_ITEVTEN;
-            }
-            else {
-              i2c->reg->CR1 |= I2C_CR1_STOP;
-            }
-
-            tr->data  = NULL;
-            tr->ctrl &= ~XFER_CTRL_XACTIVE;
-
-            i2c->info->status.busy = 0U;
-            i2c->info->status.mode = 0U;
-
-            if (i2c->info->cb_event) {
-              i2c->info->cb_event (ARM_I2C_EVENT_TRANSFER_DONE);
-            }
+            I2Cx_MasterStop(i2c);
+            I2Cx_MasterDone(i2c);
           }
         }
         else {
@@ -887,28 +1544,15 @@ void I2Cx_EV_IRQHandler(I2C_RESOURCES *i2c)
               /* Two bytes remaining */
               i2c->reg->CR2 &= ~I2C_CR2_ITBUFEN;
 
-              if (tr->ctrl & XFER_CTRL_XPENDING) {
-                i2c->reg->CR2 &= ~I2C_CR2_ITEVTEN;
-              }
-              else {
-                i2c->reg->CR1 |= I2C_CR1_STOP;
-              }
+              I2Cx_MasterStop(i2c);
 
               /* Read data N-1 and N */
               tr->data[tr->cnt++] = (uint8_t)i2c->reg->DR;
               tr->data[tr->cnt++] = (uint8_t)i2c->reg->DR;
 
-              tr->data  = NULL;
-              tr->ctrl &= ~XFER_CTRL_XACTIVE;
-
-              i2c->info->status.busy = 0U;
-              i2c->info->status.mode = 0U;
-
               i2c->reg->CR1 &= ~I2C_CR1_POS;
 
-              if (i2c->info->cb_event) {
-                i2c->info->cb_event (ARM_I2C_EVENT_TRANSFER_DONE);
-              }
+              I2Cx_MasterDone(i2c);
             }
             else {
               /* Three bytes remaining */
@@ -925,20 +1569,12 @@ void I2Cx_EV_IRQHandler(I2C_RESOURCES *i2c)
             /* Single byte transfer completed */
             i2c->reg->CR2 &= ~I2C_CR2_ITBUFEN;
 
-            if (tr->ctrl & XFER_CTRL_XPENDING) {
+            if ((tr->ctrl & (XFER_CTRL_XPENDING | XFER_CTRL_SEGMENT)) == XFER_CTRL_XPENDING) {
               i2c->reg->CR2 &= ~I2C_CR2_ITEVTEN;
             }
-            /* (STOP was already sent during ADDR phase) */
+            /* (STOP or repeated start was already requested during ADDR phase) */
 
-            tr->data  = NULL;
-            tr->ctrl &= ~XFER_CTRL_XACTIVE;
-
-            i2c->info->status.busy = 0U;
-            i2c->info->status.mode = 0U;
-
-            if (i2c->info->cb_event) {
-              i2c->info->cb_event (ARM_I2C_EVENT_TRANSFER_DONE);
-            }
+            I2Cx_MasterDone(i2c);
           }
           else {
             if (tr->cnt == (tr->num - 3U)) {
@@ -973,6 +1609,55 @@ void I2Cx_EV_IRQHandler(I2C_RESOURCES *i2c)
   }
 }
 
+#ifdef I2C_DMA
+/**
+ * @fn          void I2Cx_DMAAbort(I2C_RESOURCES *i2c)
+ * @brief       Stop DMA data phase, update transferred data count and
+ *              restore event interrupts masked for the data phase.
+ * @param[in]   i2c   Pointer to I2C resources
+ */
+static
+void I2Cx_DMAAbort(I2C_RESOURCES *i2c)
+{
+  I2C_TRANSFER_INFO *tr = &i2c->info->xfer;
+  DMA_Resources_t *dma;
+
+  i2c->reg->CR2 &= ~(I2C_CR2_DMAEN | I2C_CR2_LAST);
+  i2c->reg->CR2 |=  I2C_CR2_ITEVTEN;
+
+  dma = (i2c->info->status.direction != 0U) ? i2c->dma_rx : i2c->dma_tx;
+
+  DMA_StreamDisable(dma);
+  tr->cnt = tr->num - DMA_StreamGetCount(dma);
+}
+
+/**
+ * @fn          void I2Cx_DMAError(I2C_RESOURCES *i2c)
+ * @brief       End master transfer on DMA transfer error.
+ * @param[in]   i2c   Pointer to I2C resources
+ */
+static
+void I2Cx_DMAError(I2C_RESOURCES *i2c)
+{
+  I2C_INFO *info = i2c->info;
+
+  I2Cx_DMAAbort(i2c);
+
+  i2c->reg->CR1 |= I2C_CR1_STOP;
+
+  info->xfer.data = NULL;
+  info->xfer.ctrl = 0U;
+
+  info->status.busy      = 0U;
+  info->status.mode      = 0U;
+  info->status.bus_error = 1U;
+
+  if (info->cb_event != NULL) {
+    info->cb_event (ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE | ARM_I2C_EVENT_BUS_ERROR);
+  }
+}
+#endif  /* I2C_DMA */
+
 /**
  * @brief       I2C Master state event handler.
  * @param[in]   i2c   Pointer to I2C resources
@@ -1001,6 +1686,13 @@ void I2Cx_ER_IRQHandler(I2C_RESOURCES *i2c)
     err |= I2C_SR1_OVR;
   }
 
+#ifdef I2C_DMA
+  if ((sr1 & (I2C_SR1_AF | I2C_SR1_ARLO | I2C_SR1_BERR)) && (i2c->info->xfer.ctrl & XFER_CTRL_DMA)) {
+    /* Stop DMA data phase */
+    I2Cx_DMAAbort(i2c);
+  }
+#endif
+
   if (sr1 & I2C_SR1_AF) {
     /* Acknowledge failure */
     err |= I2C_SR1_AF;
@@ -1066,6 +1758,65 @@ void I2Cx_ER_IRQHandler(I2C_RESOURCES *i2c)
   }
 }
 
+#ifdef I2C_DMA
+/**
+ * @fn          void I2C_TX_DMA_Complete(uint32_t event, I2C_RESOURCES *i2c)
+ * @brief       Master transmit DMA event. The transfer ends on the
+ *              following BTF event when the last byte has left the shifter.
+ * @param[in]   event   DMA event
+ * @param[in]   i2c     Pointer to I2C resources
+ */
+static
+void I2C_TX_DMA_Complete(uint32_t event, I2C_RESOURCES *i2c)
+{
+  I2C_TRANSFER_INFO *tr = &i2c->info->xfer;
+
+  if ((tr->ctrl & XFER_CTRL_DMA) == 0U)
+    return;
+
+  if (event & DMA_EVENT_TRANSFER_ERROR) {
+    I2Cx_DMAError(i2c);
+  }
+  else if (event & DMA_EVENT_TRANSFER_COMPLETE) {
+    tr->cnt   = tr->num;
+    tr->ctrl |= XFER_CTRL_DMA_DONE;
+
+    i2c->reg->CR2 &= ~I2C_CR2_DMAEN;
+    i2c->reg->CR2 |=  I2C_CR2_ITEVTEN;
+  }
+}
+
+/**
+ * @fn          void I2C_RX_DMA_Complete(uint32_t event, I2C_RESOURCES *i2c)
+ * @brief       Master receive DMA event. Last byte was NACKed by hardware
+ *              (LAST bit), STOP or repeated start is generated here.
+ * @param[in]   event   DMA event
+ * @param[in]   i2c     Pointer to I2C resources
+ */
+static
+void I2C_RX_DMA_Complete(uint32_t event, I2C_RESOURCES *i2c)
+{
+  I2C_TRANSFER_INFO *tr = &i2c->info->xfer;
+
+  if ((tr->ctrl & XFER_CTRL_DMA) == 0U)
+    return;
+
+  if (event & DMA_EVENT_TRANSFER_ERROR) {
+    I2Cx_DMAError(i2c);
+  }
+  else if (event & DMA_EVENT_TRANSFER_COMPLETE) {
+    i2c->reg->CR2 &= ~(I2C_CR2_DMAEN | I2C_CR2_LAST);
+    i2c->reg->CR2 |=  I2C_CR2_ITEVTEN;
+
+    I2Cx_MasterStop(i2c);
+
+    tr->cnt = tr->num;
+
+    I2Cx_MasterDone(i2c);
+  }
+}
+#endif  /* I2C_DMA */
+
 #if defined(USE_I2C1)
 /* I2C1 Driver wrapper functions */
 
@@ -1099,6 +1850,11 @@ int32_t I2C1_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num, bool xfer
   return (I2Cx_MasterReceive(addr, data, num, xfer_pending, &I2C1_Resources));
 }
 
+int32_t I2C1_MasterTransfer(const I2C_SEGMENT *seg, uint32_t seg_num, bool xfer_pending)
+{
+  return (I2Cx_MasterTransfer(seg, seg_num, xfer_pending, &I2C1_Resources));
+}
+
 static
 int32_t I2C1_SlaveTransmit(const uint8_t *data, uint32_t num)
 {
@@ -1139,6 +1895,32 @@ void I2C1_ER_IRQHandler(void)
   I2Cx_ER_IRQHandler(&I2C1_Resources);
 }
 
+#ifdef I2C1_RX_DMA_Stream
+void I2C1_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&I2C1_RX_DMA);
+}
+
+static
+void I2C1_RX_DMA_Complete(uint32_t event)
+{
+  I2C_RX_DMA_Complete(event, &I2C1_Resources);
+}
+#endif
+
+#ifdef I2C1_TX_DMA_Stream
+void I2C1_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&I2C1_TX_DMA);
+}
+
+static
+void I2C1_TX_DMA_Complete(uint32_t event)
+{
+  I2C_TX_DMA_Complete(event, &I2C1_Resources);
+}
+#endif
+
 #endif  /* USE_I2C1 */
 
 #if defined(USE_I2C2)
@@ -1174,6 +1956,11 @@ int32_t I2C2_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num, bool xfer
   return (I2Cx_MasterReceive(addr, data, num, xfer_pending, &I2C2_Resources));
 }
 
+int32_t I2C2_MasterTransfer(const I2C_SEGMENT *seg, uint32_t seg_num, bool xfer_pending)
+{
+  return (I2Cx_MasterTransfer(seg, seg_num, xfer_pending, &I2C2_Resources));
+}
+
 static
 int32_t I2C2_SlaveTransmit(const uint8_t *data, uint32_t num)
 {
@@ -1214,6 +2001,32 @@ void I2C2_ER_IRQHandler(void)
   I2Cx_ER_IRQHandler(&I2C2_Resources);
 }
 
+#ifdef I2C2_RX_DMA_Stream
+void I2C2_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&I2C2_RX_DMA);
+}
+
+static
+void I2C2_RX_DMA_Complete(uint32_t event)
+{
+  I2C_RX_DMA_Complete(event, &I2C2_Resources);
+}
+#endif
+
+#ifdef I2C2_TX_DMA_Stream
+void I2C2_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&I2C2_TX_DMA);
+}
+
+static
+void I2C2_TX_DMA_Complete(uint32_t event)
+{
+  I2C_TX_DMA_Complete(event, &I2C2_Resources);
+}
+#endif
+
 #endif  /* USE_I2C2 */
 
 #if defined(USE_I2C3)
@@ -1249,6 +2062,11 @@ int32_t I2C3_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num, bool xfer
   return (I2Cx_MasterReceive(addr, data, num, xfer_pending, &I2C3_Resources));
 }
 
+int32_t I2C3_MasterTransfer(const I2C_SEGMENT *seg, uint32_t seg_num, bool xfer_pending)
+{
+  return (I2Cx_MasterTransfer(seg, seg_num, xfer_pending, &I2C3_Resources));
+}
+
 static
 int32_t I2C3_SlaveTransmit(const uint8_t *data, uint32_t num)
 {
@@ -1289,6 +2107,32 @@ void I2C3_ER_IRQHandler(void)
   I2Cx_ER_IRQHandler(&I2C3_Resources);
 }
 
+#ifdef I2C3_RX_DMA_Stream
+void I2C3_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&I2C3_RX_DMA);
+}
+
+static
+void I2C3_RX_DMA_Complete(uint32_t event)
+{
+  I2C_RX_DMA_Complete(event, &I2C3_Resources);
+}
+#endif
+
+#ifdef I2C3_TX_DMA_Stream
+void I2C3_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&I2C3_TX_DMA);
+}
+
+static
+void I2C3_TX_DMA_Complete(uint32_t event)
+{
+  I2C_TX_DMA_Complete(event, &I2C3_Resources);
+}
+#endif
+
 #endif  /* USE_I2C3 */
 
 /*******************************************************************************
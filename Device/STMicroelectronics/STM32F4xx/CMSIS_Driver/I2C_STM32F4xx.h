@@ -30,6 +30,7 @@
 #include "stm32f4xx.h"
 #include "RCC_STM32F4xx.h"
 #include "GPIO_STM32F4xx.h"
+#include "DMA_STM32F4xx.h"
 
 #include "Driver_I2C.h"
 
@@ -39,6 +40,14 @@
  *  defines and macros (scope: module-local)
  ******************************************************************************/
 
+#if !defined(RTE_I2C_BUS_RECOVERY)
+#define RTE_I2C_BUS_RECOVERY            0
+#endif
+
+#if !defined(RTE_I2C_BUS_TIMEOUT)
+#define RTE_I2C_BUS_TIMEOUT             25
+#endif
+
 #if ((defined(RTE_Drivers_I2C1) || \
       defined(RTE_Drivers_I2C2) || \
       defined(RTE_Drivers_I2C3))   \
@@ -58,6 +67,21 @@
   #define I2C1_SDA_GPIO_PORT        RTE_I2C1_SDA_PORT
   #define I2C1_SDA_GPIO_PIN         RTE_I2C1_SDA_PIN
   #define I2C1_SDA_GPIO_FUNC        RTE_I2C1_SDA_FUNC
+
+  #if (RTE_I2C1_RX_DMA == 1)
+    #define I2C1_RX_DMA_Stream      DMAx_STREAMy(RTE_I2C1_RX_DMA_NUMBER, RTE_I2C1_RX_DMA_STREAM)
+    #define I2C1_RX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_I2C1_RX_DMA_NUMBER, RTE_I2C1_RX_DMA_STREAM)
+    #define I2C1_RX_DMA_Channel     DMA_CHANNEL_x(RTE_I2C1_RX_DMA_CHANNEL)
+    #define I2C1_RX_DMA_Priority    DMA_PRIORITY(RTE_I2C1_RX_DMA_PRIORITY)
+    #define I2C1_RX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_I2C1_RX_DMA_NUMBER, RTE_I2C1_RX_DMA_STREAM)
+  #endif
+  #if (RTE_I2C1_TX_DMA == 1)
+    #define I2C1_TX_DMA_Stream      DMAx_STREAMy(RTE_I2C1_TX_DMA_NUMBER, RTE_I2C1_TX_DMA_STREAM)
+    #define I2C1_TX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_I2C1_TX_DMA_NUMBER, RTE_I2C1_TX_DMA_STREAM)
+    #define I2C1_TX_DMA_Channel     DMA_CHANNEL_x(RTE_I2C1_TX_DMA_CHANNEL)
+    #define I2C1_TX_DMA_Priority    DMA_PRIORITY(RTE_I2C1_TX_DMA_PRIORITY)
+    #define I2C1_TX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_I2C1_TX_DMA_NUMBER, RTE_I2C1_TX_DMA_STREAM)
+  #endif
 #endif
 
 /* I2C2 configuration definitions */
@@ -75,6 +99,21 @@
   #define I2C2_SDA_GPIO_PORT        RTE_I2C2_SDA_PORT
   #define I2C2_SDA_GPIO_PIN         RTE_I2C2_SDA_PIN
   #define I2C2_SDA_GPIO_FUNC        RTE_I2C2_SDA_FUNC
+
+  #if (RTE_I2C2_RX_DMA == 1)
+    #define I2C2_RX_DMA_Stream      DMAx_STREAMy(RTE_I2C2_RX_DMA_NUMBER, RTE_I2C2_RX_DMA_STREAM)
+    #define I2C2_RX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_I2C2_RX_DMA_NUMBER, RTE_I2C2_RX_DMA_STREAM)
+    #define I2C2_RX_DMA_Channel     DMA_CHANNEL_x(RTE_I2C2_RX_DMA_CHANNEL)
+    #define I2C2_RX_DMA_Priority    DMA_PRIORITY(RTE_I2C2_RX_DMA_PRIORITY)
+    #define I2C2_RX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_I2C2_RX_DMA_NUMBER, RTE_I2C2_RX_DMA_STREAM)
+  #endif
+  #if (RTE_I2C2_TX_DMA == 1)
+    #define I2C2_TX_DMA_Stream      DMAx_STREAMy(RTE_I2C2_TX_DMA_NUMBER, RTE_I2C2_TX_DMA_STREAM)
+    #define I2C2_TX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_I2C2_TX_DMA_NUMBER, RTE_I2C2_TX_DMA_STREAM)
+    #define I2C2_TX_DMA_Channel     DMA_CHANNEL_x(RTE_I2C2_TX_DMA_CHANNEL)
+    #define I2C2_TX_DMA_Priority    DMA_PRIORITY(RTE_I2C2_TX_DMA_PRIORITY)
+    #define I2C2_TX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_I2C2_TX_DMA_NUMBER, RTE_I2C2_TX_DMA_STREAM)
+  #endif
 #endif
 
 /* I2C3 configuration definitions */
@@ -92,12 +131,37 @@
   #define I2C3_SDA_GPIO_PORT        RTE_I2C3_SDA_PORT
   #define I2C3_SDA_GPIO_PIN         RTE_I2C3_SDA_PIN
   #define I2C3_SDA_GPIO_FUNC        RTE_I2C3_SDA_FUNC
+
+  #if (RTE_I2C3_RX_DMA == 1)
+    #define I2C3_RX_DMA_Stream      DMAx_STREAMy(RTE_I2C3_RX_DMA_NUMBER, RTE_I2C3_RX_DMA_STREAM)
+    #define I2C3_RX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_I2C3_RX_DMA_NUMBER, RTE_I2C3_RX_DMA_STREAM)
+    #define I2C3_RX_DMA_Channel     DMA_CHANNEL_x(RTE_I2C3_RX_DMA_CHANNEL)
+    #define I2C3_RX_DMA_Priority    DMA_PRIORITY(RTE_I2C3_RX_DMA_PRIORITY)
+    #define I2C3_RX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_I2C3_RX_DMA_NUMBER, RTE_I2C3_RX_DMA_STREAM)
+  #endif
+  #if (RTE_I2C3_TX_DMA == 1)
+    #define I2C3_TX_DMA_Stream      DMAx_STREAMy(RTE_I2C3_TX_DMA_NUMBER, RTE_I2C3_TX_DMA_STREAM)
+    #define I2C3_TX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_I2C3_TX_DMA_NUMBER, RTE_I2C3_TX_DMA_STREAM)
+    #define I2C3_TX_DMA_Channel     DMA_CHANNEL_x(RTE_I2C3_TX_DMA_CHANNEL)
+    #define I2C3_TX_DMA_Priority    DMA_PRIORITY(RTE_I2C3_TX_DMA_PRIORITY)
+    #define I2C3_TX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_I2C3_TX_DMA_NUMBER, RTE_I2C3_TX_DMA_STREAM)
+  #endif
+#endif
+
+#if ((defined(USE_I2C1) && defined(I2C1_RX_DMA_Stream)) || \
+     (defined(USE_I2C2) && defined(I2C2_RX_DMA_Stream)) || \
+     (defined(USE_I2C3) && defined(I2C3_RX_DMA_Stream)) || \
+     (defined(USE_I2C1) && defined(I2C1_TX_DMA_Stream)) || \
+     (defined(USE_I2C2) && defined(I2C2_TX_DMA_Stream)) || \
+     (defined(USE_I2C3) && defined(I2C3_TX_DMA_Stream)))
+  #define I2C_DMA
 #endif
 
 /* Current driver status flag definition */
 #define I2C_FLAG_INIT       ((uint8_t)0x01)   // I2C initialized
 #define I2C_FLAG_POWER      ((uint8_t)0x02)   // I2C powered on
 #define I2C_FLAG_SETUP      ((uint8_t)0x04)   // I2C Master configured, clock set
+#define I2C_FLAG_RETIME     ((uint8_t)0x08)   // Bus timing to be recomputed after clock change
 
 /* Transfer status flags definitions */
 #define XFER_CTRL_XPENDING  ((uint8_t)0x01)   // Transfer pending
@@ -106,13 +170,16 @@
 #define XFER_CTRL_DMA_DONE  ((uint8_t)0x08)   // DMA transfer done
 #define XFER_CTRL_WAIT_BTF  ((uint8_t)0x10)   // Wait for byte transfer finished
 #define XFER_CTRL_XACTIVE   ((uint8_t)0x20)   // Transfer active
+#define XFER_CTRL_SEGMENT   ((uint8_t)0x40)   // Segments follow, end with repeated start
+#define XFER_CTRL_DMA       ((uint8_t)0x80)   // Data phase by DMA
+
+/* Master transfer segment flags */
+#define I2C_SEGMENT_READ    (1U << 0)         // Receive segment, transmit otherwise
 
 /*******************************************************************************
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
 
-typedef void* I2C_DMA;
-
 /* I2C Input/Output Configuration */
 typedef const struct _I2C_IO {
   GPIO_PORT_t           scl_port;           // SCL IO port
@@ -123,6 +190,14 @@ typedef const struct _I2C_IO {
   GPIO_PIN_FUNC_t       sda_func;           // SDA AF pin configuration
 } I2C_IO;
 
+/* I2C Master transfer segment */
+typedef struct _I2C_SEGMENT {
+  uint32_t              addr;               // Slave address (7-bit or 10-bit)
+  uint8_t              *data;               // Data to transmit or buffer for received data
+  uint32_t              num;                // Number of data bytes
+  uint32_t              flags;              // Segment flags (I2C_SEGMENT_xxx)
+} I2C_SEGMENT;
+
 /* I2C Transfer Information (Run-Time) */
 typedef struct _I2C_TRANSFER_INFO {
   uint32_t              num;                // Number of data to transfer
@@ -130,6 +205,10 @@ typedef struct _I2C_TRANSFER_INFO {
   uint8_t              *data;               // Data pointer
   uint16_t              addr;               // Device address
   uint8_t               ctrl;               // Transfer control flags
+  const I2C_SEGMENT    *seg;                // Segment list of master transfer
+  uint32_t              seg_num;            // Number of segments
+  uint32_t              seg_idx;            // Active segment index
+  int32_t               seg_cnt;            // Data transferred by completed segments
 } I2C_TRANSFER_INFO;
 
 /* I2C Information (Run-Time) */
@@ -138,13 +217,17 @@ typedef struct _I2C_INFO {
   ARM_I2C_STATUS        status;             // Status flags
   I2C_TRANSFER_INFO     xfer;               // Transfer information
   uint8_t               flags;              // Current I2C state flags
+  uint32_t              stamp;              // Cycle counter at last bus activity
+  uint32_t              dma_cnt;            // DMA items left at last bus activity
+  uint32_t              bus_speed;          // Configured ARM_I2C_BUS_SPEED_xxx
+  RCC_ClockSubscriber_t clk_sub;            // Clock change subscriber
 } I2C_INFO;
 
 /* I2C Resource Configuration */
 typedef struct {
   I2C_TypeDef          *reg;                // I2C peripheral register interface
-  I2C_DMA              *dma_rx;             // I2C DMA Configuration
-  I2C_DMA              *dma_tx;             // I2C DMA Configuration
+  DMA_Resources_t      *dma_rx;             // I2C receive DMA configuration
+  DMA_Resources_t      *dma_tx;             // I2C transmit DMA configuration
   I2C_IO                io;                 // I2C Input/Output pins
   IRQn_Type             ev_irq_num;         // I2C Event IRQ Number
   IRQn_Type             er_irq_num;         // I2C Error IRQ Number
@@ -160,6 +243,18 @@ typedef struct {
  *  exported function prototypes
  ******************************************************************************/
 
+#if defined(USE_I2C1)
+extern int32_t I2C1_MasterTransfer(const I2C_SEGMENT *seg, uint32_t seg_num, bool xfer_pending);
+#endif
+
+#if defined(USE_I2C2)
+extern int32_t I2C2_MasterTransfer(const I2C_SEGMENT *seg, uint32_t seg_num, bool xfer_pending);
+#endif
+
+#if defined(USE_I2C3)
+extern int32_t I2C3_MasterTransfer(const I2C_SEGMENT *seg, uint32_t seg_num, bool xfer_pending);
+#endif
+
 #endif /* I2C_STM32F4XX_H_ */
 
 /* ----------------------------- End of file ---------------------------------*/
@@ -31,7 +31,7 @@
  *  defines and macros (scope: module-local)
  ******************************************************************************/
 
-#define ARM_SAI_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0) /* driver version */
+#define ARM_SAI_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 3) /* driver version */
 
 #define I2S_MODE_MASTER_TX            (2U << SPI_I2SCFGR_I2SCFG_Pos)
 #define I2S_MODE_MASTER_RX            (3U << SPI_I2SCFGR_I2SCFG_Pos)
@@ -95,16 +95,9 @@ static const GPIO_PIN_CFG_t I2S_pin_cfg_analog = {
     GPIO_MODE_ANALOG, GPIO_PULL_DISABLE, GPIO_SPEED_LOW
 };
 
-static const I2S_FreqParam_t i2s_pll_param[] = {
-  /* When the master clock is generated */
-  { 8000, 256, 5},
-  {16000, 213, 2},
-  {22050, 429, 4},
-  {32000, 213, 2},
-  {44100, 271, 2},
-  {48000, 258, 3},
-  {96000, 344, 2},
-};
+/* Recently solved I2S clock settings, shared as I2S PLL is common */
+static I2S_Clock_t i2s_clock_cache[I2S_CLOCK_CACHE_SIZE];
+static uint32_t    i2s_clock_next;
 
 #if defined(USE_I2S2)
 /* SAI2 Information (Run-Time) */
@@ -121,6 +114,7 @@ static const DMA_Resources_t I2S2_TX_DMA = {
   I2S2_TX_DMA_Complete,
   RTE_I2S_DMA_INT_PRIORITY,
   I2S2_TX_DMA_IRQn,
+  DMA_REQUEST_SPI2_TX,
 };
 
 #endif
@@ -136,6 +130,7 @@ static const DMA_Resources_t I2S2_RX_DMA = {
   I2S2_RX_DMA_Complete,
   RTE_I2S_DMA_INT_PRIORITY,
   I2S2_RX_DMA_IRQn,
+  DMA_REQUEST_I2S2_EXT_RX,
 };
 
 #endif
@@ -192,6 +187,7 @@ static const DMA_Resources_t I2S3_TX_DMA = {
   I2S3_TX_DMA_Complete,
   RTE_I2S_DMA_INT_PRIORITY,
   I2S3_TX_DMA_IRQn,
+  DMA_REQUEST_SPI3_TX,
 };
 
 #endif
@@ -207,6 +203,7 @@ static const DMA_Resources_t I2S3_RX_DMA = {
   I2S3_RX_DMA_Complete,
   RTE_I2S_DMA_INT_PRIORITY,
   I2S3_RX_DMA_IRQn,
+  DMA_REQUEST_I2S3_EXT_RX,
 };
 
 #endif
@@ -252,6 +249,97 @@ static I2S_RESOURCES I2S3_Resources = {
  *  function implementations (scope: module-local)
  ******************************************************************************/
 
+/**
+ * @fn          const I2S_Clock_t *I2S_ClockSolve(uint32_t freq, uint32_t ratio)
+ * @brief       Get I2S PLL and prescaler setting with minimum sample rate
+ *              error. All PLLI2SR and prescaler values are searched with the
+ *              nearest PLLI2SN inside its valid range, results are cached
+ *              per sample rate.
+ *              fs = fin * PLLI2SN / (PLLI2SR * ratio * (I2SDIV * 2 + ODD))
+ * @param[in]   freq   Requested audio sample rate in Hz
+ * @param[in]   ratio  256 with MCLK output, otherwise 32 or 64 (channel length * 2)
+ * @return      Pointer to clock setting or NULL if none found
+ */
+static
+const I2S_Clock_t *I2S_ClockSolve(uint32_t freq, uint32_t ratio)
+{
+  I2S_Clock_t *clk;
+  uint64_t vco, den, err, best_err = 0U, best_den = 1U;
+  uint32_t fin, n, n_min, n_max, r, k, best_n = 0U, best_r = 0U, best_k = 0U;
+  int64_t diff;
+  uint32_t idx;
+
+  fin = RCC_GetFreq(RCC_FREQ_PLL_IN);
+
+  if ((freq == 0U) || (fin == 0U))
+    return NULL;
+
+  for (idx = 0U; idx < I2S_CLOCK_CACHE_SIZE; idx++) {
+    clk = &i2s_clock_cache[idx];
+    if ((clk->freq == freq) && (clk->ratio == ratio) && (clk->fin == fin))
+      return clk;
+  }
+
+  for (r = 2U; r <= 7U; r++) {
+    /* PLLI2SN 50..432, VCO output 100..432 MHz, I2S clock up to 192 MHz */
+    n_min = (100000000U + fin - 1U) / fin;
+    n_max = 432000000U / fin;
+    n     = (192000000U * r + r - 1U) / fin;
+    if (n_max > n)
+      n_max = n;
+    if (n_min < 50U)
+      n_min = 50U;
+    if (n_max > 432U)
+      n_max = 432U;
+    if (n_min > n_max)
+      continue;
+
+    for (k = 4U; k <= 511U; k++) {
+      den = (uint64_t)r * ratio * k;
+      n = (uint32_t)(((uint64_t)freq * den + (fin >> 1U)) / fin);
+
+      if (n < n_min)
+        n = n_min;
+      if (n > n_max)
+        n = n_max;
+
+      vco = (uint64_t)fin * n;
+      err = (vco > (freq * den)) ? (vco - (freq * den)) : ((freq * den) - vco);
+
+      /* Compare err / den with best_err / best_den */
+      if ((best_n == 0U) || ((err * best_den) < (best_err * den))) {
+        best_err = err;
+        best_den = den;
+        best_n   = n;
+        best_r   = r;
+        best_k   = k;
+      }
+    }
+  }
+
+  if (best_n == 0U)
+    return NULL;
+
+  clk = &i2s_clock_cache[i2s_clock_next];
+  i2s_clock_next = (i2s_clock_next + 1U) % I2S_CLOCK_CACHE_SIZE;
+
+  clk->freq   = freq;
+  clk->fin    = fin;
+  clk->ratio  = (uint16_t)ratio;
+  clk->plln   = (uint16_t)best_n;
+  clk->pllr   = (uint16_t)best_r;
+  clk->div    = (uint16_t)best_k;
+
+  /* Achieved rate in mHz */
+  vco  = ((uint64_t)fin * best_n * 1000U + (best_den >> 1U)) / best_den;
+  diff = (int64_t)vco - ((int64_t)freq * 1000);
+
+  clk->actual = (uint32_t)((vco + 500U) / 1000U);
+  clk->ppm    = (int32_t)((diff * 1000) / (int64_t)freq);
+
+  return clk;
+}
+
 /**
  * @fn          ARM_DRIVER_VERSION SAIx_GetVersion(void)
  * @brief       Get driver version.
@@ -390,8 +478,15 @@ int32_t I2S_PowerControl(ARM_POWER_STATE state, I2S_RESOURCES *i2s)
       info->status.tx_underflow = 0U;
       info->status.rx_overflow  = 0U;
       info->status.frame_error  = 0U;
+      info->duplex              = 0U;
 
-      info->flags &= ~I2S_FLAG_POWERED;
+      /* Release performance locks of enabled directions */
+      if (info->flags & I2S_FLAG_TX_ENABLE)
+        DFS_UNLOCK();
+      if (info->flags & I2S_FLAG_RX_ENABLE)
+        DFS_UNLOCK();
+
+      info->flags &= ~(I2S_FLAG_POWERED | I2S_FLAG_TX_ENABLE | I2S_FLAG_RX_ENABLE);
       break;
 
     case ARM_POWER_FULL:
@@ -425,7 +520,10 @@ int32_t I2S_PowerControl(ARM_POWER_STATE state, I2S_RESOURCES *i2s)
         cfg->PerBurst     = DMA_PBURST_SINGLE;
 
 
-        DMA_Initialize(i2s->tx_dma);
+        if (DMA_Initialize(i2s->tx_dma) != ARM_DRIVER_OK) {
+          I2S_PowerControl(ARM_POWER_OFF, i2s);
+          return ARM_DRIVER_ERROR;
+        }
       }
 #endif
 
@@ -443,7 +541,10 @@ int32_t I2S_PowerControl(ARM_POWER_STATE state, I2S_RESOURCES *i2s)
         cfg->MemBurst     = DMA_MBURST_SINGLE;
         cfg->PerBurst     = DMA_PBURST_SINGLE;
 
-        DMA_Initialize(i2s->rx_dma);
+        if (DMA_Initialize(i2s->rx_dma) != ARM_DRIVER_OK) {
+          I2S_PowerControl(ARM_POWER_OFF, i2s);
+          return ARM_DRIVER_ERROR;
+        }
       }
 #endif
 
@@ -506,6 +607,7 @@ int32_t I2S_Send(const void *data, uint32_t num, I2S_RESOURCES *i2s)
   /* DMA mode */
   if (i2s->tx_dma != NULL) {
     /* Initialize and start DMA Stream */
+    i2s->tx_dma->handle->config.Mode = DMA_MODE_NORMAL;
     DMA_StreamConfig(i2s->tx_dma);
     DMA_StreamEnable(i2s->tx_dma, (uint32_t)&reg->DR, (uint32_t)data, num);
     /* TX Buffer DMA enable */
@@ -561,6 +663,7 @@ int32_t I2S_Receive(void *data, uint32_t num, I2S_RESOURCES *i2s)
   /* DMA mode */
   if (i2s->rx_dma != NULL) {
     /* Initialize and start DMA Stream */
+    i2s->rx_dma->handle->config.Mode = DMA_MODE_NORMAL;
     DMA_StreamConfig(i2s->rx_dma);
     DMA_StreamEnable(i2s->rx_dma, (uint32_t)&reg->DR, (uint32_t)data, num);
     /* RX Buffer DMA enable */
@@ -577,6 +680,221 @@ int32_t I2S_Receive(void *data, uint32_t num, I2S_RESOURCES *i2s)
   return ARM_DRIVER_OK;
 }
 
+#ifdef I2S_TX_DMA
+/**
+ * @fn          int32_t I2S_StreamSend(const void *buf0, const void *buf1, uint32_t num, I2S_RESOURCES *i2s)
+ * @brief       Start gapless sending from two buffers using DMA double buffer
+ *              mode. ARM_SAI_EVENT_SEND_COMPLETE is signaled each time a
+ *              buffer has been sent and may be refilled, I2S_EVENT_STREAM_BUFFER1
+ *              tells which one. Sending continues until ARM_SAI_ABORT_SEND.
+ * @param[in]   buf0  Pointer to first buffer with data to send
+ * @param[in]   buf1  Pointer to second buffer with data to send
+ * @param[in]   num   Number of data items in each buffer
+ * @param[in]   i2s   Pointer to SAI resources
+ * @return      \ref execution_status
+ */
+static
+int32_t I2S_StreamSend(const void *buf0, const void *buf1, uint32_t num, I2S_RESOURCES *i2s)
+{
+  I2S_INFO *info = i2s->info;
+  SPI_TypeDef *reg = i2s->tx_reg;
+
+  if ((buf0 == NULL) || (buf1 == NULL) || (num == 0U) || (num > 0xFFFFU)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((info->flags & I2S_FLAG_CONFIGURED) == 0U || (info->flags & I2S_FLAG_TX_ENABLE) == 0U) {
+    /* I2S is not configured (mode not selected) */
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (info->status.tx_busy) {
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  info->status.tx_busy      = 1U;
+  info->status.tx_underflow = 0U;
+  info->status.frame_error  = 0U;
+
+  info->tx.buf    = (uint16_t *)buf0;
+  info->tx.cnt    = 0U;
+  info->tx.num    = num;
+  info->tx.stream = 1U;
+
+  /* Data is supplied by DMA only */
+  reg->CR2 &= ~SPI_CR2_TXEIE;
+
+  /* Initialize and start DMA Stream */
+  i2s->tx_dma->handle->config.Mode = DMA_MODE_NORMAL;
+  DMA_StreamConfig(i2s->tx_dma);
+  DMA_StreamEnableDoubleBuffer(i2s->tx_dma, (uint32_t)&reg->DR, (uint32_t)buf0, (uint32_t)buf1, num);
+  /* TX Buffer DMA enable */
+  reg->CR2 |= SPI_CR2_TXDMAEN;
+
+  return ARM_DRIVER_OK;
+}
+#endif  // I2S_TX_DMA
+
+#ifdef I2S_RX_DMA
+/**
+ * @fn          int32_t I2S_StreamReceive(void *buf0, void *buf1, uint32_t num, I2S_RESOURCES *i2s)
+ * @brief       Start gapless receiving into two buffers using DMA double
+ *              buffer mode. ARM_SAI_EVENT_RECEIVE_COMPLETE is signaled each
+ *              time a buffer has been filled, I2S_EVENT_STREAM_BUFFER1 tells
+ *              which one. Receiving continues until ARM_SAI_ABORT_RECEIVE.
+ * @param[out]  buf0  Pointer to first buffer for data to receive
+ * @param[out]  buf1  Pointer to second buffer for data to receive
+ * @param[in]   num   Number of data items in each buffer
+ * @param[in]   i2s   Pointer to SAI resources
+ * @return      \ref execution_status
+ */
+static
+int32_t I2S_StreamReceive(void *buf0, void *buf1, uint32_t num, I2S_RESOURCES *i2s)
+{
+  I2S_INFO *info = i2s->info;
+  SPI_TypeDef *reg = i2s->rx_reg;
+
+  if ((buf0 == NULL) || (buf1 == NULL) || (num == 0U) || (num > 0xFFFFU)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((info->flags & I2S_FLAG_CONFIGURED) == 0U || (info->flags & I2S_FLAG_RX_ENABLE) == 0U) {
+    /* I2S is not configured (mode not selected) */
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (info->status.rx_busy) {
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  info->status.rx_busy      = 1U;
+  info->status.rx_overflow  = 0U;
+  info->status.frame_error  = 0U;
+
+  info->rx.buf    = (uint16_t *)buf0;
+  info->rx.cnt    = 0U;
+  info->rx.num    = num;
+  info->rx.stream = 1U;
+
+  /* Data is collected by DMA only */
+  reg->CR2 &= ~SPI_CR2_RXNEIE;
+
+  /* Initialize and start DMA Stream */
+  i2s->rx_dma->handle->config.Mode = DMA_MODE_NORMAL;
+  DMA_StreamConfig(i2s->rx_dma);
+  DMA_StreamEnableDoubleBuffer(i2s->rx_dma, (uint32_t)&reg->DR, (uint32_t)buf0, (uint32_t)buf1, num);
+  /* RX Buffer DMA enable */
+  reg->CR2 |= SPI_CR2_RXDMAEN;
+
+  return ARM_DRIVER_OK;
+}
+#endif  // I2S_RX_DMA
+
+#if defined(I2S_TX_DMA) && defined(I2S_RX_DMA)
+/**
+ * @fn          int32_t I2S_Transfer(const void *out0, const void *out1, void *in0, void *in1, uint32_t num, I2S_RESOURCES *i2s)
+ * @brief       Start full-duplex transfer on SPIx and I2Sxext. Both DMA
+ *              streams are armed while the frame clock is stopped, so the
+ *              first sent and the first received item belong to the same
+ *              frame. I2S_EVENT_TRANSFER_COMPLETE is signaled once both
+ *              directions reached the end of a buffer. With out1/in1 set
+ *              the transfer runs in double buffer mode until aborted.
+ * @param[in]   out0  Pointer to buffer with data to send
+ * @param[in]   out1  Pointer to second buffer with data to send (stream) or NULL
+ * @param[out]  in0   Pointer to buffer for data to receive
+ * @param[out]  in1   Pointer to second buffer for data to receive (stream) or NULL
+ * @param[in]   num   Number of data items in each buffer
+ * @param[in]   i2s   Pointer to SAI resources
+ * @return      \ref execution_status
+ */
+static
+int32_t I2S_Transfer(const void *out0, const void *out1, void *in0, void *in1, uint32_t num, I2S_RESOURCES *i2s)
+{
+  I2S_INFO *info = i2s->info;
+  SPI_TypeDef *tx_reg = i2s->tx_reg;
+  SPI_TypeDef *rx_reg = i2s->rx_reg;
+  uint8_t stream;
+
+  if ((out0 == NULL) || (in0 == NULL) || (num == 0U) || (num > 0xFFFFU) ||
+      ((out1 == NULL) != (in1 == NULL))) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((i2s->tx_dma == NULL) || (i2s->rx_dma == NULL)) {
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+
+  if (((info->flags & I2S_FLAG_CONFIGURED) == 0U) ||
+      ((info->flags & (I2S_FLAG_TX_ENABLE | I2S_FLAG_RX_ENABLE)) != (I2S_FLAG_TX_ENABLE | I2S_FLAG_RX_ENABLE))) {
+    /* Transmitter and receiver must be configured and enabled */
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (info->status.tx_busy || info->status.rx_busy) {
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+
+  stream = (out1 != NULL) ? 1U : 0U;
+
+  /* Stop frame clock, both directions must start with the same frame */
+  if ((info->tx.master || info->rx.master) && (tx_reg->I2SCFGR & SPI_I2SCFGR_I2SE)) {
+    while ((tx_reg->SR & SPI_SR_TXE) == 0U);
+    while ((tx_reg->SR & SPI_SR_BSY) != 0U);
+  }
+  tx_reg->I2SCFGR &= ~SPI_I2SCFGR_I2SE;
+  rx_reg->I2SCFGR &= ~SPI_I2SCFGR_I2SE;
+
+  /* Data is moved by DMA only */
+  tx_reg->CR2 &= ~SPI_CR2_TXEIE;
+  rx_reg->CR2 &= ~SPI_CR2_RXNEIE;
+
+  /* Clear stale receive data and overrun flag */
+  (void)rx_reg->DR;
+  (void)rx_reg->SR;
+
+  info->status.tx_busy      = 1U;
+  info->status.rx_busy      = 1U;
+  info->status.tx_underflow = 0U;
+  info->status.rx_overflow  = 0U;
+  info->status.frame_error  = 0U;
+
+  info->tx.buf    = (uint16_t *)out0;
+  info->tx.cnt    = 0U;
+  info->tx.num    = num;
+  info->tx.stream = stream;
+  info->rx.buf    = (uint16_t *)in0;
+  info->rx.cnt    = 0U;
+  info->rx.num    = num;
+  info->rx.stream = stream;
+  info->duplex    = 1U;
+
+  /* Initialize and start DMA Streams */
+  i2s->tx_dma->handle->config.Mode = DMA_MODE_NORMAL;
+  i2s->rx_dma->handle->config.Mode = DMA_MODE_NORMAL;
+  DMA_StreamConfig(i2s->tx_dma);
+  DMA_StreamConfig(i2s->rx_dma);
+
+  if (stream) {
+    DMA_StreamEnableDoubleBuffer(i2s->rx_dma, (uint32_t)&rx_reg->DR, (uint32_t)in0, (uint32_t)in1, num);
+    DMA_StreamEnableDoubleBuffer(i2s->tx_dma, (uint32_t)&tx_reg->DR, (uint32_t)out0, (uint32_t)out1, num);
+  }
+  else {
+    DMA_StreamEnable(i2s->rx_dma, (uint32_t)&rx_reg->DR, (uint32_t)in0, num);
+    DMA_StreamEnable(i2s->tx_dma, (uint32_t)&tx_reg->DR, (uint32_t)out0, num);
+  }
+
+  /* TX DMA preloads the first item before the clock starts */
+  rx_reg->CR2 |= SPI_CR2_RXDMAEN;
+  tx_reg->CR2 |= SPI_CR2_TXDMAEN;
+
+  /* I2Sxext slave must be enabled before SPIx starts the frame clock */
+  rx_reg->I2SCFGR |= SPI_I2SCFGR_I2SE;
+  tx_reg->I2SCFGR |= SPI_I2SCFGR_I2SE;
+
+  return ARM_DRIVER_OK;
+}
+#endif  // I2S_TX_DMA && I2S_RX_DMA
+
 /**
  * @fn          uint32_t SAI_GetTxCount(I2S_RESOURCES *i2s)
  * @brief       Get transmitted data count.
@@ -616,6 +934,8 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
   uint32_t mode;
   uint32_t i2scfgr = 0x0800, i2spr = 0x0002;
   uint32_t data_len;
+  uint8_t master = 0U;
+  const I2S_Clock_t *clk = NULL;
 
   if ((i2s->info->flags & I2S_FLAG_POWERED) == 0U) {
     /* SAI not powered */
@@ -628,6 +948,9 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
         /* Disable TX buffer empty interrupt */
         i2s->tx_reg->CR2 &= ~SPI_CR2_TXEIE;
 
+        if (i2s->info->flags & I2S_FLAG_TX_ENABLE)
+          DFS_UNLOCK();
+
         /* Clear flag */
         i2s->info->flags &= ~I2S_FLAG_TX_ENABLE;
 
@@ -639,15 +962,20 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
             DMA_StreamDisable(i2s->tx_dma);
           }
         }
+        i2s->info->tx.stream = 0U;
 #endif  // I2S_TX_DMA
 
         while ((i2s->tx_reg->SR & SPI_SR_TXE) == 0U);
         while ((i2s->tx_reg->SR & SPI_SR_BSY) != 0U);
 
-        /* Disable I2S peripheral */
-        i2s->tx_reg->I2SCFGR &= ~SPI_I2SCFGR_I2SE;
+        /* Disable I2S peripheral, unless it still clocks the receiver */
+        if ((i2s->info->rx.master == 0U) || ((i2s->info->flags & I2S_FLAG_RX_ENABLE) == 0U))
+          i2s->tx_reg->I2SCFGR &= ~SPI_I2SCFGR_I2SE;
       }
       else {
+        /* Transmitter holds performance lock while enabled */
+        if ((i2s->info->flags & I2S_FLAG_TX_ENABLE) == 0U)
+          DFS_LOCK();
         /* Reset counters */
         i2s->info->tx.cnt = 0U;
         i2s->info->tx.num = 0U;
@@ -668,8 +996,18 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
         i2s->rx_reg->CR2 &= ~SPI_CR2_RXNEIE;
         /* Disable I2S ext peripheral */
         i2s->rx_reg->I2SCFGR &= ~SPI_I2SCFGR_I2SE;
+        if (i2s->info->flags & I2S_FLAG_RX_ENABLE)
+          DFS_UNLOCK();
+        /* Clear flag */
+        i2s->info->flags &= ~I2S_FLAG_RX_ENABLE;
+        /* Stop frame clock generated for the receiver only */
+        if (i2s->info->rx.master && ((i2s->info->flags & I2S_FLAG_TX_ENABLE) == 0U))
+          i2s->tx_reg->I2SCFGR &= ~SPI_I2SCFGR_I2SE;
       }
       else {
+        /* Receiver holds performance lock while enabled */
+        if ((i2s->info->flags & I2S_FLAG_RX_ENABLE) == 0U)
+          DFS_LOCK();
         /* Reset counters */
         i2s->info->rx.cnt = 0U;
         i2s->info->rx.num = 0U;
@@ -677,6 +1015,9 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
         i2s->info->status.rx_busy = 0U;
         /* Enable I2S ext peripheral */
         i2s->rx_reg->I2SCFGR |= SPI_I2SCFGR_I2SE;
+        /* Start frame clock on SPIx when receiver is master */
+        if (i2s->info->rx.master)
+          i2s->tx_reg->I2SCFGR |= SPI_I2SCFGR_I2SE;
         /* Set flag */
         i2s->info->flags |= I2S_FLAG_RX_ENABLE;
         /* Enable Receive Interrupt */
@@ -711,6 +1052,8 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
           DMA_StreamDisable(i2s->tx_dma);
         }
       }
+      i2s->info->tx.stream = 0U;
+      i2s->info->duplex    = 0U;
 #endif  // I2S_TX_DMA
 
       /* Reset counters */
@@ -729,7 +1072,7 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
 
     case ARM_SAI_ABORT_RECEIVE:
       /* Disable RX interrupt */
-      i2s->tx_reg->CR2 &= ~SPI_CR2_RXNEIE;
+      i2s->rx_reg->CR2 &= ~SPI_CR2_RXNEIE;
 
 #ifdef I2S_RX_DMA
       if (i2s->rx_dma) {
@@ -738,6 +1081,8 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
           DMA_StreamDisable(i2s->rx_dma);
         }
       }
+      i2s->info->rx.stream = 0U;
+      i2s->info->duplex    = 0U;
 #endif  // I2S_RX_DMA
 
       /* Reset counters */
@@ -750,7 +1095,7 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
       if (i2s->rx_reg->I2SCFGR & SPI_I2SCFGR_I2SE) {
         /* Receiver is enabled */
         /* Enable RX interrupt, to detect RX overflow */
-        i2s->tx_reg->CR2 |= SPI_CR2_RXNEIE;
+        i2s->rx_reg->CR2 |= SPI_CR2_RXNEIE;
       }
       return ARM_DRIVER_OK;
 
@@ -762,53 +1107,37 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
 
   if ((control & ARM_SAI_MODE_Msk) == ARM_SAI_MODE_MASTER) {
 
-    if (mode == ARM_SAI_CONFIGURE_RX)
-      return ARM_DRIVER_ERROR_UNSUPPORTED;
-
-    i2scfgr |= I2S_MODE_MASTER_TX;
+    /* I2Sxext is slave only, master receiver is clocked by SPIx as master transmitter */
+    if (mode == ARM_SAI_CONFIGURE_TX)
+      i2scfgr |= I2S_MODE_MASTER_TX;
 
-    /* Configure I2S PLL */
-    int idx, freq_idx = -1;
-    uint32_t pres_div = 2U, pres_odd = 0U, length = 1U, i2sclk, tmp;
+    master = 1U;
 
-    for (idx = 0; idx < sizeof(i2s_pll_param)/sizeof(i2s_pll_param[0]); ++idx) {
-      if (i2s_pll_param[idx].freq == arg2) {
-        freq_idx = idx;
-        break;
-      }
-    }
-
-    if (freq_idx == -1)
-      return ARM_SAI_ERROR_AUDIO_FREQ;
-
-    i2sclk = RCC_I2SPLL_Config(i2s_pll_param[freq_idx].plln, i2s_pll_param[freq_idx].pllr);
-
-    /* Configure I2S prescaler */
-    if (data_len != 16U)
-      length = 2U;
+    uint32_t ratio;
 
     switch (control & ARM_SAI_MCLK_PIN_Msk) {
       case ARM_SAI_MCLK_PIN_INACTIVE:
-        tmp = (i2sclk / (32U * length) * 10U / arg2 + 5U);
+        /* 16-bit or 32-bit channel length */
+        ratio = (data_len != 16U) ? 64U : 32U;
         break;
 
       case ARM_SAI_MCLK_PIN_OUTPUT:
         i2spr = SPI_I2SPR_MCKOE;
-        tmp = (i2sclk / 256U * 10U / arg2 + 5U);
+        ratio = 256U;
         break;
 
       default:
         return ARM_SAI_ERROR_MCLK_PIN;
     }
 
-    tmp /= 10U;
-    pres_odd = (tmp & 1U);
-    pres_div = (tmp - pres_odd) / 2U;
-
-    if ((pres_div < 2U) || (pres_div > 255U))
+    /* Solve I2S PLL and prescaler */
+    clk = I2S_ClockSolve(arg2, ratio);
+    if (clk == NULL)
       return ARM_SAI_ERROR_AUDIO_FREQ;
 
-    i2spr |= ((pres_div << SPI_I2SPR_I2SDIV_Pos) | (pres_odd << SPI_I2SPR_ODD_Pos));
+    /* Configure I2S prescaler */
+    i2spr |= (((uint32_t)clk->div >> 1U) << SPI_I2SPR_I2SDIV_Pos) |
+             (((uint32_t)clk->div & 1U) << SPI_I2SPR_ODD_Pos);
   }
 
   /* Configure I2S Protocol */
@@ -853,8 +1182,32 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
       return ARM_SAI_ERROR_DATA_SIZE;
   }
 
+  if ((mode == ARM_SAI_CONFIGURE_RX) && master && (i2s->info->tx.data_bits != 0U)) {
+    /* Master receiver is clocked by SPIx, which is already set up as transmitter */
+    if (((i2s->tx_reg->I2SCFGR & ~SPI_I2SCFGR_I2SE) != ((i2scfgr & ~SPI_I2SCFGR_I2SCFG_Msk) | I2S_MODE_MASTER_TX)) ||
+        (i2s->tx_reg->I2SPR != i2spr) || (i2s->info->freq != clk->actual)) {
+      /* Transmitter configuration differs */
+      return ARM_DRIVER_ERROR;
+    }
+  }
+
+  if (clk != NULL) {
+    /* Configure I2S PLL */
+    if (RCC_I2SPLL_Config(clk->plln, clk->pllr) == 0U)
+      return ARM_SAI_ERROR_AUDIO_FREQ;
+
+    i2s->info->freq = clk->actual;
+    i2s->info->ppm  = clk->ppm;
+  }
+  else if (((mode == ARM_SAI_CONFIGURE_TX) ? i2s->info->rx.master : i2s->info->tx.master) == 0U) {
+    /* Slave mode: sample rate is determined by external clock */
+    i2s->info->freq = 0U;
+    i2s->info->ppm  = 0;
+  }
+
   if (mode == ARM_SAI_CONFIGURE_TX) {
     i2s->info->tx.data_bits = data_len;
+    i2s->info->tx.master = master;
     /* Configure I2S configuration register */
     i2s->tx_reg->I2SCFGR = i2scfgr;
     /* Configure I2S prescaler register */
@@ -862,7 +1215,14 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
   }
   else {
     i2s->info->rx.data_bits = data_len;
+    i2s->info->rx.master = master;
     i2s->rx_reg->I2SCFGR = i2scfgr;
+
+    if (master) {
+      /* SPIx generates bit and frame clock for I2Sxext */
+      i2s->tx_reg->I2SCFGR = (i2scfgr & ~SPI_I2SCFGR_I2SCFG_Msk) | I2S_MODE_MASTER_TX;
+      i2s->tx_reg->I2SPR = i2spr;
+    }
   }
 
   i2s->info->flags |= I2S_FLAG_CONFIGURED;
@@ -870,6 +1230,22 @@ int32_t I2S_Control(uint32_t control, uint32_t arg1, uint32_t arg2, I2S_RESOURCE
   return ARM_DRIVER_OK;
 }
 
+/**
+ * @fn          uint32_t I2S_GetAudioFreq(int32_t *ppm, I2S_RESOURCES *i2s)
+ * @brief       Get audio sample rate achieved in master mode.
+ * @param[out]  ppm  Pointer to sample rate error in ppm (optional)
+ * @param[in]   i2s  Pointer to SAI resources
+ * @return      Achieved sample rate in Hz, 0 if not configured as master
+ */
+static
+uint32_t I2S_GetAudioFreq(int32_t *ppm, I2S_RESOURCES *i2s)
+{
+  if (ppm != NULL)
+    *ppm = i2s->info->ppm;
+
+  return i2s->info->freq;
+}
+
 /**
  * @fn          ARM_SAI_STATUS SAI_GetStatus(I2S_RESOURCES *i2s)
  * @brief       Get SAI status.
@@ -955,12 +1331,54 @@ void I2S_IRQHandler(I2S_RESOURCES *i2s)
   }
 }
 
+#if defined(I2S_TX_DMA) || defined(I2S_RX_DMA)
+/**
+ * @fn          void I2S_DMA_SignalEvent(uint32_t event, I2S_RESOURCES *i2s)
+ * @brief       Signal DMA transfer event. In full-duplex mode a single
+ *              I2S_EVENT_TRANSFER_COMPLETE is signaled when both directions
+ *              have transferred the same number of items.
+ * @param[in]   event  SAI event
+ * @param[in]   i2s    Pointer to SAI resources
+ */
+static
+void I2S_DMA_SignalEvent(uint32_t event, I2S_RESOURCES *i2s)
+{
+  I2S_INFO *info = i2s->info;
+
+  if (info->duplex) {
+    if (info->tx.cnt != info->rx.cnt)
+      return;
+
+    event = (event & I2S_EVENT_STREAM_BUFFER1) | I2S_EVENT_TRANSFER_COMPLETE;
+
+    if (info->tx.stream == 0U)
+      info->duplex = 0U;
+  }
+
+  if (info->cb_event != NULL)
+    info->cb_event(event);
+}
+#endif
+
 #ifdef I2S_TX_DMA
 static
 void I2S_TX_DMA_Complete(uint32_t event, I2S_RESOURCES *i2s)
 {
   I2S_INFO *info = i2s->info;
 
+  if (info->tx.stream) {
+    if (event & DMA_EVENT_TRANSFER_COMPLETE) {
+      info->tx.cnt += info->tx.num;
+
+      /* DMA already switched to the other buffer, the finished one is idle */
+      event = ARM_SAI_EVENT_SEND_COMPLETE;
+      if (DMA_StreamGetTarget(i2s->tx_dma) == 0U)
+        event |= I2S_EVENT_STREAM_BUFFER1;
+      I2S_DMA_SignalEvent(event, i2s);
+    }
+    return;
+  }
+
   if (event & (DMA_EVENT_TRANSFER_COMPLETE | DMA_EVENT_TRANSFER_ABORT)) {
     info->tx.cnt = info->tx.num;
     info->status.tx_busy = 0U;
@@ -968,8 +1386,8 @@ void I2S_TX_DMA_Complete(uint32_t event, I2S_RESOURCES *i2s)
     /* Clear TX num and enable TX interrupt to detect TX underflow */
     info->tx.num = 0U;
 
-    if ((info->cb_event != NULL) && (event & DMA_EVENT_TRANSFER_COMPLETE))
-      info->cb_event(ARM_SAI_EVENT_SEND_COMPLETE);
+    if (event & DMA_EVENT_TRANSFER_COMPLETE)
+      I2S_DMA_SignalEvent(ARM_SAI_EVENT_SEND_COMPLETE, i2s);
   }
 }
 #endif  // I2S_TX_DMA
@@ -980,6 +1398,19 @@ void I2S_RX_DMA_Complete(uint32_t event, I2S_RESOURCES *i2s)
 {
   I2S_INFO *info = i2s->info;
 
+  if (info->rx.stream) {
+    if (event & DMA_EVENT_TRANSFER_COMPLETE) {
+      info->rx.cnt += info->rx.num;
+
+      /* DMA already switched to the other buffer, the filled one is idle */
+      event = ARM_SAI_EVENT_RECEIVE_COMPLETE;
+      if (DMA_StreamGetTarget(i2s->rx_dma) == 0U)
+        event |= I2S_EVENT_STREAM_BUFFER1;
+      I2S_DMA_SignalEvent(event, i2s);
+    }
+    return;
+  }
+
   if (event & (DMA_EVENT_TRANSFER_COMPLETE | DMA_EVENT_TRANSFER_ABORT)) {
     info->rx.cnt = info->rx.num;
     info->status.rx_busy = 0U;
@@ -987,8 +1418,8 @@ void I2S_RX_DMA_Complete(uint32_t event, I2S_RESOURCES *i2s)
     /* Clear RX num and enable RX interrupt to detect RX overflow */
     info->rx.num = 0U;
 
-    if ((info->cb_event != NULL) && (event & DMA_EVENT_TRANSFER_COMPLETE))
-      info->cb_event(ARM_SAI_EVENT_RECEIVE_COMPLETE);
+    if (event & DMA_EVENT_TRANSFER_COMPLETE)
+      I2S_DMA_SignalEvent(ARM_SAI_EVENT_RECEIVE_COMPLETE, i2s);
   }
 }
 #endif  // I2S_RX_DMA
@@ -1065,6 +1496,11 @@ void I2S2_TX_DMA_Complete(uint32_t event)
 {
   I2S_TX_DMA_Complete(event, &I2S2_Resources);
 }
+
+int32_t I2S2_StreamSend(const void *buf0, const void *buf1, uint32_t num)
+{
+  return I2S_StreamSend(buf0, buf1, num, &I2S2_Resources);
+}
 #endif // I2S2_TX_DMA_Stream
 
 #ifdef I2S2_RX_DMA_Stream
@@ -1077,8 +1513,30 @@ void I2S2_RX_DMA_Complete(uint32_t event)
 {
   I2S_RX_DMA_Complete(event, &I2S2_Resources);
 }
+
+int32_t I2S2_StreamReceive(void *buf0, void *buf1, uint32_t num)
+{
+  return I2S_StreamReceive(buf0, buf1, num, &I2S2_Resources);
+}
 #endif // I2S2_RX_DMA_Stream
 
+uint32_t I2S2_GetAudioFreq(int32_t *ppm)
+{
+  return I2S_GetAudioFreq(ppm, &I2S2_Resources);
+}
+
+#if defined(I2S2_TX_DMA_Stream) && defined(I2S2_RX_DMA_Stream)
+int32_t I2S2_Transfer(const void *data_out, void *data_in, uint32_t num)
+{
+  return I2S_Transfer(data_out, NULL, data_in, NULL, num, &I2S2_Resources);
+}
+
+int32_t I2S2_StreamTransfer(const void *out0, const void *out1, void *in0, void *in1, uint32_t num)
+{
+  return I2S_Transfer(out0, out1, in0, in1, num, &I2S2_Resources);
+}
+#endif
+
 #endif  /* USE_I2S2 */
 
 #if defined(USE_I2S3)
@@ -1154,6 +1612,11 @@ void I2S3_TX_DMA_Complete(uint32_t event)
 {
   I2S_TX_DMA_Complete(event, &I2S3_Resources);
 }
+
+int32_t I2S3_StreamSend(const void *buf0, const void *buf1, uint32_t num)
+{
+  return I2S_StreamSend(buf0, buf1, num, &I2S3_Resources);
+}
 #endif // I2S3_TX_DMA_Stream
 
 #ifdef I2S3_RX_DMA_Stream
@@ -1166,8 +1629,30 @@ void I2S3_RX_DMA_Complete(uint32_t event)
 {
   I2S_RX_DMA_Complete(event, &I2S3_Resources);
 }
+
+int32_t I2S3_StreamReceive(void *buf0, void *buf1, uint32_t num)
+{
+  return I2S_StreamReceive(buf0, buf1, num, &I2S3_Resources);
+}
 #endif // I2S3_RX_DMA_Stream
 
+uint32_t I2S3_GetAudioFreq(int32_t *ppm)
+{
+  return I2S_GetAudioFreq(ppm, &I2S3_Resources);
+}
+
+#if defined(I2S3_TX_DMA_Stream) && defined(I2S3_RX_DMA_Stream)
+int32_t I2S3_Transfer(const void *data_out, void *data_in, uint32_t num)
+{
+  return I2S_Transfer(data_out, NULL, data_in, NULL, num, &I2S3_Resources);
+}
+
+int32_t I2S3_StreamTransfer(const void *out0, const void *out1, void *in0, void *in1, uint32_t num)
+{
+  return I2S_Transfer(out0, out1, in0, in1, num, &I2S3_Resources);
+}
+#endif
+
 #endif  /* USE_I2S3 */
 
 /*******************************************************************************
@@ -31,6 +31,7 @@
 #include "RCC_STM32F4xx.h"
 #include "GPIO_STM32F4xx.h"
 #include "DMA_STM32F4xx.h"
+#include "DFS_STM32F4xx.h"
 
 #include "Driver_SAI.h"
 
@@ -144,16 +145,28 @@
 #define I2S_FLAG_TX_ENABLE          (1U << 3)
 #define I2S_FLAG_RX_ENABLE          (1U << 4)
 
+/* Number of cached I2S clock settings */
+#define I2S_CLOCK_CACHE_SIZE        4U
+
+/* Driver specific events */
+#define I2S_EVENT_STREAM_BUFFER1    (1UL << 8)  // Stream mode: buffer 1 (else buffer 0) became idle
+#define I2S_EVENT_TRANSFER_COMPLETE (1UL << 9)  // Full-duplex: send and receive completed
+
 /*******************************************************************************
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
 
-/* SAI Frequency parameters */
-typedef struct I2S_FreqParam_s {
-  uint32_t freq;    // Audio sample rate
-  uint32_t plln;    // Multiplication factor for I2S PLL VCO. Must be between 100 and 432
-  uint32_t pllr;    // Division factor for I2S PLL. Must be between 2 and 7
-} I2S_FreqParam_t;
+/* I2S clock setting solved for an audio sample rate */
+typedef struct I2S_Clock_s {
+  uint32_t              freq;               // Requested audio sample rate
+  uint32_t              fin;                // I2S PLL input frequency
+  uint16_t              ratio;              // I2S clock to sample rate ratio per prescaler step
+  uint16_t              plln;               // PLLI2SN multiplication factor
+  uint16_t              pllr;               // PLLI2SR division factor
+  uint16_t              div;                // I2S prescaler (I2SDIV * 2 + ODD)
+  uint32_t              actual;             // Achieved audio sample rate in Hz
+  int32_t               ppm;                // Sample rate error in ppm
+} I2S_Clock_t;
 
 /* SAI Input/Output Configuration */
 typedef const struct _I2S_IO {
@@ -181,6 +194,7 @@ typedef struct _I2S_TRANSFER_INFO {
   uint32_t              cnt;                // Number of data transmited/receive
   uint8_t               data_bits;          // Number of data bits
   uint8_t               master;             // Master flag
+  uint8_t               stream;             // Double buffer stream active
 } I2S_TRANSFER_INFO;
 
 typedef struct _I2S_STATUS {
@@ -198,6 +212,9 @@ typedef struct _I2S_INFO {
   I2S_TRANSFER_INFO     tx;                 // Transmit information
   I2S_TRANSFER_INFO     rx;                 // Receive information
   uint8_t               flags;              // Current state flags
+  uint8_t               duplex;             // Full-duplex transfer active
+  uint32_t              freq;               // Achieved audio sample rate (master mode)
+  int32_t               ppm;                // Audio sample rate error in ppm
 } I2S_INFO;
 
 /* SAI Resource Configuration */
@@ -212,6 +229,44 @@ typedef struct _I2S_RESOURSES {
   I2S_INFO             *info;               // Run-Time information
 } const I2S_RESOURCES;
 
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+#ifdef I2S2_TX_DMA_Stream
+extern int32_t I2S2_StreamSend(const void *buf0, const void *buf1, uint32_t num);
+#endif
+
+#ifdef I2S2_RX_DMA_Stream
+extern int32_t I2S2_StreamReceive(void *buf0, void *buf1, uint32_t num);
+#endif
+
+#if defined(USE_I2S2)
+extern uint32_t I2S2_GetAudioFreq(int32_t *ppm);
+#endif
+
+#if defined(I2S2_TX_DMA_Stream) && defined(I2S2_RX_DMA_Stream)
+extern int32_t I2S2_Transfer(const void *data_out, void *data_in, uint32_t num);
+extern int32_t I2S2_StreamTransfer(const void *out0, const void *out1, void *in0, void *in1, uint32_t num);
+#endif
+
+#ifdef I2S3_TX_DMA_Stream
+extern int32_t I2S3_StreamSend(const void *buf0, const void *buf1, uint32_t num);
+#endif
+
+#ifdef I2S3_RX_DMA_Stream
+extern int32_t I2S3_StreamReceive(void *buf0, void *buf1, uint32_t num);
+#endif
+
+#if defined(USE_I2S3)
+extern uint32_t I2S3_GetAudioFreq(int32_t *ppm);
+#endif
+
+#if defined(I2S3_TX_DMA_Stream) && defined(I2S3_RX_DMA_Stream)
+extern int32_t I2S3_Transfer(const void *data_out, void *data_in, uint32_t num);
+extern int32_t I2S3_StreamTransfer(const void *out0, const void *out1, void *in0, void *in1, uint32_t num);
+#endif
+
 #endif /* I2S_STM32F4XX_H_ */
 
 /* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,448 @@
+/*
+ * Copyright (C) 2019 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Memory to Memory DMA for STMicroelectronics STM32F4xx
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include "MEMDMA_STM32F4xx.h"
+
+#if defined(USE_MEMDMA)
+
+/*******************************************************************************
+ *  external declarations
+ ******************************************************************************/
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+/* Largest number of data items per DMA transfer, multiple of the longest burst */
+#define MEMDMA_MAX_ITEMS          (0xFFF0U)
+
+/*******************************************************************************
+ *  typedefs and structures (scope: module-local)
+ ******************************************************************************/
+
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+static void MEMDMA_DMA_Complete(uint32_t event);
+
+/*******************************************************************************
+ *  global variable definitions  (scope: module-exported)
+ ******************************************************************************/
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static MEMDMA_INFO MEMDMA_Info;
+
+static DMA_Handle_t MEMDMA_DMA_Handle;
+static DMA_Resources_t MEMDMA_DMA = {
+  &MEMDMA_DMA_Handle,
+  MEMDMA_DMA_Stream,
+  DMA_CHANNEL_0,
+  MEMDMA_DMA_Priority,
+  MEMDMA_DMA_Complete,
+  RTE_MEMDMA_DMA_INT_PRIORITY,
+  MEMDMA_DMA_IRQn,
+  DMA_REQUEST_MEM2MEM,
+};
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+/**
+ * @fn          bool MEMDMA_IsReachable(uint32_t addr, uint32_t num)
+ * @brief       Check that a memory block is accessible by DMA2.
+ * @param[in]   addr  Block address
+ * @param[in]   num   Block size in bytes
+ * @return      true when DMA can be used
+ */
+static
+bool MEMDMA_IsReachable(uint32_t addr, uint32_t num)
+{
+#if defined(CCMDATARAM_BASE)
+  /* CCM data RAM is connected to the CPU D-bus only */
+  if ((addr < (CCMDATARAM_END + 1U)) && ((addr + num) > CCMDATARAM_BASE))
+    return false;
+#else
+  (void)addr;
+  (void)num;
+#endif
+
+  return true;
+}
+
+/**
+ * @fn          void MEMDMA_ChunkStart(MEMDMA_REQUEST *req)
+ * @brief       Start DMA transfer of the next part of a request. Data size
+ *              and burst length follow the common alignment of addresses
+ *              and length.
+ * @param[in]   req  Pointer to request
+ */
+static
+void MEMDMA_ChunkStart(MEMDMA_REQUEST *req)
+{
+  DMA_StreamConfig_t *cfg = &MEMDMA_DMA_Handle.config;
+  uint32_t dst = (uint32_t)req->dst + req->done;
+  uint32_t remain = req->num - req->done;
+  uint32_t src, align, shift, items;
+
+  if (req->src != NULL) {
+    src = (uint32_t)req->src + req->done;
+    align = dst | src | remain;
+    cfg->PerInc = DMA_PINC_ENABLE;
+  }
+  else {
+    /* DMA2 can not read a request in CCM RAM, fill from driver memory */
+    MEMDMA_Info.pattern = req->pattern;
+    src = (uint32_t)&MEMDMA_Info.pattern;
+    align = dst | remain;
+    cfg->PerInc = DMA_PINC_DISABLE;
+  }
+
+  if ((align & 3U) == 0U) {
+    shift = 2U;
+    cfg->PerDataAlign = DMA_PDATAALIGN_WORD;
+    cfg->MemDataAlign = DMA_MDATAALIGN_WORD;
+    cfg->MemBurst     = DMA_MBURST_INC4;
+  }
+  else if ((align & 1U) == 0U) {
+    shift = 1U;
+    cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
+    cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
+    cfg->MemBurst     = DMA_MBURST_INC8;
+  }
+  else {
+    shift = 0U;
+    cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+    cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+    cfg->MemBurst     = DMA_MBURST_INC16;
+  }
+
+  /* Bursts fill the whole FIFO, only used on 16 byte aligned blocks */
+  if ((align & 15U) != 0U)
+    cfg->MemBurst = DMA_MBURST_SINGLE;
+
+  cfg->PerBurst = DMA_PBURST_SINGLE;
+  if (req->src != NULL)
+    cfg->PerBurst = (DMA_PerBurst_t)(cfg->MemBurst >> (DMA_SxCR_MBURST_Pos - DMA_SxCR_PBURST_Pos));
+
+  items = remain >> shift;
+  if (items > MEMDMA_MAX_ITEMS)
+    items = MEMDMA_MAX_ITEMS;
+
+  MEMDMA_Info.chunk = items << shift;
+
+  DMA_StreamConfig(&MEMDMA_DMA);
+  DMA_StreamEnable(&MEMDMA_DMA, src, dst, items);
+}
+
+/**
+ * @fn          void MEMDMA_RequestComplete(MEMDMA_REQUEST *req, uint32_t status)
+ * @brief       Remove request from the queue head, start the next one and
+ *              report the completed request.
+ * @param[in]   req     Pointer to request at the queue head
+ * @param[in]   status  MEMDMA_REQUEST_DONE or MEMDMA_REQUEST_ERROR
+ */
+static
+void MEMDMA_RequestComplete(MEMDMA_REQUEST *req, uint32_t status)
+{
+  MEMDMA_Info.head = req->next;
+
+  if (MEMDMA_Info.head != NULL) {
+    MEMDMA_Info.head->status = MEMDMA_REQUEST_ACTIVE;
+    MEMDMA_ChunkStart(MEMDMA_Info.head);
+  }
+  else {
+    MEMDMA_Info.tail = NULL;
+    DFS_UNLOCK();
+  }
+
+  req->status = status;
+
+  if (req->cb_event != NULL)
+    req->cb_event(req);
+}
+
+/**
+ * @fn          void MEMDMA_DMA_Complete(uint32_t event)
+ * @brief       DMA stream event, continues the active request.
+ * @param[in]   event  DMA_EVENT_xxx
+ */
+static
+void MEMDMA_DMA_Complete(uint32_t event)
+{
+  MEMDMA_REQUEST *req = MEMDMA_Info.head;
+
+  // Late abort event or flushed queue
+  if (req == NULL)
+    return;
+
+  if (event & DMA_EVENT_TRANSFER_ERROR) {
+    MEMDMA_RequestComplete(req, MEMDMA_REQUEST_ERROR);
+    return;
+  }
+
+  if (event & DMA_EVENT_TRANSFER_COMPLETE) {
+    req->done += MEMDMA_Info.chunk;
+
+    if (req->done < req->num)
+      MEMDMA_ChunkStart(req);
+    else
+      MEMDMA_RequestComplete(req, MEMDMA_REQUEST_DONE);
+  }
+}
+
+/**
+ * @fn          int32_t MEMDMA_Submit(MEMDMA_REQUEST *req)
+ * @brief       Queue request or run it on the CPU.
+ * @param[in]   req  Pointer to prepared request
+ * @return      \ref execution_status
+ */
+static
+int32_t MEMDMA_Submit(MEMDMA_REQUEST *req)
+{
+  uint32_t primask;
+  bool reachable, start = false, cpu = false;
+
+  if (MEMDMA_Info.initialized == 0U)
+    return ARM_DRIVER_ERROR;
+
+  reachable = MEMDMA_IsReachable((uint32_t)req->dst, req->num);
+  if (req->src != NULL)
+    reachable = reachable && MEMDMA_IsReachable((uint32_t)req->src, req->num);
+
+  req->next   = NULL;
+  req->done   = 0U;
+  req->status = MEMDMA_REQUEST_PENDING;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (MEMDMA_Info.head == NULL) {
+    if ((reachable == false) || (req->num < MEMDMA_CPU_THRESHOLD)) {
+      // DMA setup and completion interrupt cost more than the copy
+      cpu = true;
+    }
+    else {
+      MEMDMA_Info.head = req;
+      MEMDMA_Info.tail = req;
+      start = true;
+      DFS_LOCK();
+    }
+  }
+  else if (reachable == false) {
+    // CPU copy would overtake the queued requests
+    req->status = MEMDMA_REQUEST_IDLE;
+    __set_PRIMASK(primask);
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+  else {
+    MEMDMA_Info.tail->next = req;
+    MEMDMA_Info.tail       = req;
+  }
+
+  __set_PRIMASK(primask);
+
+  if (cpu) {
+    req->status = MEMDMA_REQUEST_ACTIVE;
+
+    if (req->src != NULL)
+      memcpy(req->dst, req->src, req->num);
+    else
+      memset(req->dst, (int)(req->pattern & 0xFFU), req->num);
+
+    req->done   = req->num;
+    req->status = MEMDMA_REQUEST_DONE;
+
+    if (req->cb_event != NULL)
+      req->cb_event(req);
+  }
+  else if (start) {
+    req->status = MEMDMA_REQUEST_ACTIVE;
+    MEMDMA_ChunkStart(req);
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+/**
+ * @fn          int32_t MEMDMA_Initialize(void)
+ * @brief       Initialize memory to memory DMA service.
+ * @return      \ref execution_status
+ */
+int32_t MEMDMA_Initialize(void)
+{
+  DMA_StreamConfig_t *cfg = &MEMDMA_DMA_Handle.config;
+
+  if (MEMDMA_Info.initialized != 0U)
+    return ARM_DRIVER_OK;
+
+  memset(&MEMDMA_Info, 0, sizeof(MEMDMA_INFO));
+
+  cfg->Direction     = DMA_DIR_MEM_TO_MEM;
+  cfg->MemInc        = DMA_MINC_ENABLE;
+  cfg->Mode          = DMA_MODE_NORMAL;
+  cfg->FIFOMode      = DMA_FIFOMODE_ENABLE;
+  cfg->FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+
+  if (DMA_Initialize(&MEMDMA_DMA) != ARM_DRIVER_OK)
+    return ARM_DRIVER_ERROR_BUSY;
+
+  /* Report transfer errors, kept by DMA_StreamConfig */
+  MEMDMA_DMA.stream->CR |= DMA_SxCR_TEIE;
+
+  MEMDMA_Info.initialized = 1U;
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn          int32_t MEMDMA_Uninitialize(void)
+ * @brief       Abort queued requests and release the DMA stream.
+ * @return      \ref execution_status
+ */
+int32_t MEMDMA_Uninitialize(void)
+{
+  if (MEMDMA_Info.initialized == 0U)
+    return ARM_DRIVER_OK;
+
+  MEMDMA_Abort();
+
+  DMA_Uninitialize(&MEMDMA_DMA);
+
+  MEMDMA_Info.initialized = 0U;
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn          int32_t MEMDMA_Copy(MEMDMA_REQUEST *req, void *dst, const void *src, uint32_t num, MEMDMA_RequestEvent_t cb_event)
+ * @brief       Copy memory block. Blocks must not overlap. Short blocks and
+ *              blocks in CCM RAM are copied by the CPU before returning when
+ *              no other request is queued. Blocks in CCM RAM are refused with
+ *              ARM_DRIVER_ERROR_BUSY while other requests are queued.
+ * @param[in]   req       Pointer to request, must stay valid until done
+ * @param[out]  dst       Destination address
+ * @param[in]   src       Source address
+ * @param[in]   num       Number of bytes
+ * @param[in]   cb_event  Completion callback, may be NULL
+ * @return      \ref execution_status
+ */
+int32_t MEMDMA_Copy(MEMDMA_REQUEST *req, void *dst, const void *src, uint32_t num, MEMDMA_RequestEvent_t cb_event)
+{
+  if ((req == NULL) || (dst == NULL) || (src == NULL) || (num == 0U))
+    return ARM_DRIVER_ERROR_PARAMETER;
+
+  req->dst      = dst;
+  req->src      = src;
+  req->num      = num;
+  req->pattern  = 0U;
+  req->cb_event = cb_event;
+
+  return MEMDMA_Submit(req);
+}
+
+/**
+ * @fn          int32_t MEMDMA_Fill(MEMDMA_REQUEST *req, void *dst, uint8_t value, uint32_t num, MEMDMA_RequestEvent_t cb_event)
+ * @brief       Fill memory block with a byte value. Short blocks and blocks
+ *              in CCM RAM are handled like in \ref MEMDMA_Copy. The request
+ *              itself may be in CCM RAM.
+ * @param[in]   req       Pointer to request, must stay valid until done
+ * @param[out]  dst       Destination address
+ * @param[in]   value     Fill value
+ * @param[in]   num       Number of bytes
+ * @param[in]   cb_event  Completion callback, may be NULL
+ * @return      \ref execution_status
+ */
+int32_t MEMDMA_Fill(MEMDMA_REQUEST *req, void *dst, uint8_t value, uint32_t num, MEMDMA_RequestEvent_t cb_event)
+{
+  if ((req == NULL) || (dst == NULL) || (num == 0U))
+    return ARM_DRIVER_ERROR_PARAMETER;
+
+  req->dst      = dst;
+  req->src      = NULL;
+  req->num      = num;
+  req->pattern  = (uint32_t)value * 0x01010101U;
+  req->cb_event = cb_event;
+
+  return MEMDMA_Submit(req);
+}
+
+/**
+ * @fn          int32_t MEMDMA_Abort(void)
+ * @brief       Stop the running transfer and abort all queued requests.
+ * @return      \ref execution_status
+ */
+int32_t MEMDMA_Abort(void)
+{
+  MEMDMA_REQUEST *req;
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  req = MEMDMA_Info.head;
+
+  MEMDMA_Info.head = NULL;
+  MEMDMA_Info.tail = NULL;
+
+  if (req != NULL) {
+    DMA_StreamDisable(&MEMDMA_DMA);
+    DFS_UNLOCK();
+  }
+
+  __set_PRIMASK(primask);
+
+  while (req != NULL) {
+    MEMDMA_REQUEST *next = req->next;
+
+    req->status = MEMDMA_REQUEST_ABORTED;
+
+    if (req->cb_event != NULL)
+      req->cb_event(req);
+
+    req = next;
+  }
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn          void MEMDMA_DMA_Handler(void)
+ * @brief       DMA stream interrupt handler.
+ */
+void MEMDMA_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&MEMDMA_DMA);
+}
+
+#endif  // USE_MEMDMA
+
+/* ----------------------------- End of file ---------------------------------*/
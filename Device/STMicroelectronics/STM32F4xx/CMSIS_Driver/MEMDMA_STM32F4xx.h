@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2019 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Memory to Memory DMA Definitions for STMicroelectronics STM32F4xx
+ */
+
+#ifndef MEMDMA_STM32F4XX_H_
+#define MEMDMA_STM32F4XX_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "stm32f4xx.h"
+#include "DMA_STM32F4xx.h"
+#include "DFS_STM32F4xx.h"
+
+#include "Driver_Common.h"
+
+#include "Config/RTE_Device.h"
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+#if (RTE_MEMDMA == 1)
+  #define USE_MEMDMA
+
+  #if (RTE_MEMDMA_DMA_NUMBER != 2)
+    #error "Only DMA2 supports memory to memory transfers!"
+  #endif
+
+  #define MEMDMA_DMA_Stream         DMAx_STREAMy(RTE_MEMDMA_DMA_NUMBER, RTE_MEMDMA_DMA_STREAM)
+  #define MEMDMA_DMA_IRQn           DMAx_STREAMy_IRQn(RTE_MEMDMA_DMA_NUMBER, RTE_MEMDMA_DMA_STREAM)
+  #define MEMDMA_DMA_Priority       DMA_PRIORITY(RTE_MEMDMA_DMA_PRIORITY)
+  #define MEMDMA_DMA_Handler        DMAx_STREAMy_IRQ(RTE_MEMDMA_DMA_NUMBER, RTE_MEMDMA_DMA_STREAM)
+  #define MEMDMA_CPU_THRESHOLD      RTE_MEMDMA_CPU_THRESHOLD
+#endif
+
+/* Request status definition */
+#define MEMDMA_REQUEST_IDLE       0U                       // Request not submitted
+#define MEMDMA_REQUEST_PENDING    1U                       // Request waiting in queue
+#define MEMDMA_REQUEST_ACTIVE     2U                       // Request in progress
+#define MEMDMA_REQUEST_DONE       3U                       // Request completed
+#define MEMDMA_REQUEST_ABORTED    4U                       // Request aborted
+#define MEMDMA_REQUEST_ERROR      5U                       // DMA transfer error
+
+/*******************************************************************************
+ *  typedefs and structures
+ ******************************************************************************/
+
+typedef struct _MEMDMA_REQUEST MEMDMA_REQUEST;
+
+typedef void (*MEMDMA_RequestEvent_t)(MEMDMA_REQUEST *req);
+
+/* Copy or fill request (queue entry, owned by the service until done or aborted) */
+struct _MEMDMA_REQUEST {
+  void                 *dst;                // Destination address
+  const void           *src;                // Source address, NULL for fill
+  uint32_t              num;                // Number of bytes
+  uint32_t              pattern;            // Fill byte replicated to a word
+  MEMDMA_RequestEvent_t cb_event;           // Completion callback (optional, IRQ or submit context)
+  volatile uint32_t     status;             // Request status
+  uint32_t              done;               // Number of bytes already transferred
+  MEMDMA_REQUEST       *next;               // Next queued request
+};
+
+/* Memory to memory DMA service (Run-Time) */
+typedef struct _MEMDMA_INFO {
+  MEMDMA_REQUEST       *head;               // Active request
+  MEMDMA_REQUEST       *tail;               // Last queued request
+  uint32_t              chunk;              // Bytes in the running DMA transfer
+  uint32_t              pattern;            // Fill word of the active request, DMA source
+  uint8_t               initialized;        // Service initialized
+} MEMDMA_INFO;
+
+/*******************************************************************************
+ *  exported variables
+ ******************************************************************************/
+
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+/**
+ * @fn          int32_t MEMDMA_Initialize(void)
+ * @brief       Initialize memory to memory DMA service.
+ * @return      \ref execution_status
+ */
+int32_t MEMDMA_Initialize(void);
+
+/**
+ * @fn          int32_t MEMDMA_Uninitialize(void)
+ * @brief       Abort queued requests and release the DMA stream.
+ * @return      \ref execution_status
+ */
+int32_t MEMDMA_Uninitialize(void);
+
+/**
+ * @fn          int32_t MEMDMA_Copy(MEMDMA_REQUEST *req, void *dst, const void *src, uint32_t num, MEMDMA_RequestEvent_t cb_event)
+ * @brief       Copy memory block. Blocks must not overlap. Short blocks and
+ *              blocks in CCM RAM are copied by the CPU before returning when
+ *              no other request is queued. Blocks in CCM RAM are refused with
+ *              ARM_DRIVER_ERROR_BUSY while other requests are queued.
+ * @param[in]   req       Pointer to request, must stay valid until done
+ * @param[out]  dst       Destination address
+ * @param[in]   src       Source address
+ * @param[in]   num       Number of bytes
+ * @param[in]   cb_event  Completion callback, may be NULL
+ * @return      \ref execution_status
+ */
+int32_t MEMDMA_Copy(MEMDMA_REQUEST *req, void *dst, const void *src, uint32_t num, MEMDMA_RequestEvent_t cb_event);
+
+/**
+ * @fn          int32_t MEMDMA_Fill(MEMDMA_REQUEST *req, void *dst, uint8_t value, uint32_t num, MEMDMA_RequestEvent_t cb_event)
+ * @brief       Fill memory block with a byte value. Short blocks and blocks
+ *              in CCM RAM are handled like in \ref MEMDMA_Copy. The request
+ *              itself may be in CCM RAM.
+ * @param[in]   req       Pointer to request, must stay valid until done
+ * @param[out]  dst       Destination address
+ * @param[in]   value     Fill value
+ * @param[in]   num       Number of bytes
+ * @param[in]   cb_event  Completion callback, may be NULL
+ * @return      \ref execution_status
+ */
+int32_t MEMDMA_Fill(MEMDMA_REQUEST *req, void *dst, uint8_t value, uint32_t num, MEMDMA_RequestEvent_t cb_event);
+
+/**
+ * @fn          int32_t MEMDMA_Abort(void)
+ * @brief       Stop the running transfer and abort all queued requests.
+ * @return      \ref execution_status
+ */
+int32_t MEMDMA_Abort(void);
+
+#endif /* MEMDMA_STM32F4XX_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
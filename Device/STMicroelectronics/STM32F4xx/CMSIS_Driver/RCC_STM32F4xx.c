@@ -41,6 +41,16 @@ typedef struct {
   uint32_t mask;
 } Reg_Mask_t;
 
+/* Clock tree snapshot */
+typedef struct {
+  uint32_t sysclk;
+  uint32_t hclk;
+  uint32_t pclk1;
+  uint32_t pclk2;
+  uint32_t pll_in;
+  uint32_t i2sclk;
+} Clocks_t;
+
 /*******************************************************************************
  *  global variable definitions  (scope: module-exported)
  ******************************************************************************/
@@ -55,6 +65,20 @@ uint8_t AHBPrescTable[16] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 7, 8, 9};
 static const
 uint8_t APBPrescTable[8] = {0, 0, 0, 0, 1, 2, 3, 4};
 
+/* Clock tree generation, starts at 1 so zeroed driver caches are stale */
+static volatile uint32_t ClockGeneration = 1U;
+
+/* Clock tree snapshot and the generation it was taken for */
+static Clocks_t ClockSnapshot;
+static uint32_t SnapshotGeneration;
+
+/* Clock change subscribers */
+static RCC_ClockSubscriber_t *ClockSubscribers;
+
+/* Clock change bracket nesting and merged change notification */
+static uint32_t ClockChangeNesting;
+static uint8_t  ClockChangePending;
+
 /*******************************************************************************
  *  function prototypes (scope: module-local)
  ******************************************************************************/
@@ -88,6 +112,100 @@ void GetClockEnableReg(RCC_Periph_t periph, Reg_Mask_t *param)
   }
 }
 
+/**
+ * @fn          void ClockSnapshotUpdate(void)
+ * @brief       Decode RCC registers into the clock tree snapshot.
+ */
+static
+void ClockSnapshotUpdate(void)
+{
+  uint32_t sysclk, hclk, pll_in, pllm;
+  uint32_t rcc_cfgr = RCC->CFGR;
+  uint32_t rcc_pllcfgr = RCC->PLLCFGR;
+  uint32_t gen = ClockGeneration;
+
+  /* Main and I2S PLL input frequency ----------------------------------------*/
+  pllm = (rcc_pllcfgr & RCC_PLLCFGR_PLLM);
+
+  if (pllm == 0U)
+    pll_in = 0U;
+  else
+    pll_in = ((rcc_pllcfgr & RCC_PLLCFGR_PLLSRC) ? RTE_HSE : RTE_HSI) / pllm;
+
+  /* Get SYSCLK Frequency ----------------------------------------------------*/
+  switch (rcc_cfgr & RCC_CFGR_SWS) {
+    case RCC_CFGR_SWS_HSI:  /* HSI used as system clock */
+      sysclk = RTE_HSI;
+      break;
+    case RCC_CFGR_SWS_HSE:  /* HSE used as system clock */
+      sysclk = RTE_HSE;
+      break;
+    case RCC_CFGR_SWS_PLL:  /* PLL used as system clock */
+    {
+      /*
+       * PLL_VCO_OUT = (PLL_VCO_IN / PLLM) * PLLN
+       * SYSCLK = PLL_VCO_OUT / PLLP
+       */
+      uint32_t plln, pllp;
+
+      plln = (rcc_pllcfgr & RCC_PLLCFGR_PLLN) >> RCC_PLLCFGR_PLLN_Pos;
+      pllp = (((rcc_pllcfgr & RCC_PLLCFGR_PLLP) >> RCC_PLLCFGR_PLLP_Pos) + 1U) * 2U;
+
+      sysclk = pll_in * plln / pllp;
+      break;
+    }
+    default: /* HSI used as system clock */
+      sysclk = RTE_HSI;
+      break;
+  }
+
+  ClockSnapshot.sysclk = sysclk;
+  ClockSnapshot.pll_in = pll_in;
+
+  /* Compute HCLK clock frequency --------------------------------------------*/
+  hclk = (sysclk >> AHBPrescTable[(rcc_cfgr & RCC_CFGR_HPRE) >> 4U]);
+  ClockSnapshot.hclk = hclk;
+
+  /* Compute PCLK clock frequency --------------------------------------------*/
+  ClockSnapshot.pclk1 = (hclk >> APBPrescTable[(rcc_cfgr & RCC_CFGR_PPRE1) >> 10U]);
+  ClockSnapshot.pclk2 = (hclk >> APBPrescTable[(rcc_cfgr & RCC_CFGR_PPRE2) >> 13U]);
+
+  /* Compute I2S clock frequency, external I2S_CKIN is not known -------------*/
+  ClockSnapshot.i2sclk = 0U;
+
+#if defined(RCC_CFGR_I2SSRC)
+  if ((rcc_cfgr & RCC_CFGR_I2SSRC) == 0U)
+#endif
+  {
+    if (RCC->CR & RCC_CR_PLLI2SRDY) {
+      uint32_t rcc_plli2scfgr = RCC->PLLI2SCFGR;
+
+      uint32_t plli2sn = (rcc_plli2scfgr & RCC_PLLI2SCFGR_PLLI2SN) >> RCC_PLLI2SCFGR_PLLI2SN_Pos;
+      uint32_t plli2sr = (rcc_plli2scfgr & RCC_PLLI2SCFGR_PLLI2SR) >> RCC_PLLI2SCFGR_PLLI2SR_Pos;
+
+      if (plli2sr >= 2U)
+        ClockSnapshot.i2sclk = pll_in * plli2sn / plli2sr;
+    }
+  }
+
+  SnapshotGeneration = gen;
+}
+
+/**
+ * @fn          void ClockNotify(uint32_t event)
+ * @brief       Call all clock change subscribers.
+ * @param[in]   event  RCC_CLOCK_EVENT_xxx
+ */
+static
+void ClockNotify(uint32_t event)
+{
+  RCC_ClockSubscriber_t *sub;
+
+  for (sub = ClockSubscribers; sub != NULL; sub = sub->next) {
+    sub->cb_event(event, sub->arg);
+  }
+}
+
 /*******************************************************************************
  *  function implementations (scope: module-exported)
  ******************************************************************************/
@@ -120,6 +238,8 @@ void RCC_ClkReset(void)
 
   /* Disable all interrupts */
   RCC->CIR = 0x00000000;
+
+  RCC_ClockChanged();
 }
 
 void RCC_OscInit(RCC_OscInit_t *init)
@@ -181,6 +301,8 @@ void RCC_OscInit(RCC_OscInit_t *init)
       while ((RCC->CR & RCC_CR_PLLRDY) != 0U);
     }
   }
+
+  RCC_ClockChanged();
 }
 
 void RCC_ClkInit(RCC_ClkInit_t *init, uint32_t flash_latency)
@@ -203,6 +325,9 @@ void RCC_ClkInit(RCC_ClkInit_t *init, uint32_t flash_latency)
   if (init->type & RCC_CLK_TYPE_SYSCLK) {
     tmp = (RCC->CFGR & ~RCC_CFGR_SW);
     RCC->CFGR = (tmp | init->sys_clk_src);
+
+    /* Wait until the new source drives SYSCLK */
+    while ((RCC->CFGR & RCC_CFGR_SWS) != (init->sys_clk_src << RCC_CFGR_SWS_Pos));
   }
 
   if (flash_latency < (FLASH->ACR & FLASH_ACR_LATENCY)) {
@@ -226,73 +351,146 @@ void RCC_ClkInit(RCC_ClkInit_t *init, uint32_t flash_latency)
   if (chip_id != 0x1000) {
     FLASH->ACR |= (FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN);
   }
+
+  RCC_ClockChanged();
 }
 
 /**
- * @fn        uint32_t RCC_GetFreq(RCC_FREQ_t type)
- * @brief     Get Clock Frequency
- * @param[in] type  @ref RCC_FREQ_t
- * @return    Returns clock frequency in Hz
+ * @fn          void RCC_ClockChanged(void)
+ * @brief       Notify drivers that the clock tree has been changed. Called by
+ *              the RCC configuration functions, must be called by code that
+ *              changes RCC clock settings directly. The clock tree snapshot
+ *              is refreshed before the subscribers are called.
  */
-uint32_t RCC_GetFreq(RCC_FREQ_t type)
+void RCC_ClockChanged(void)
 {
-  if (type == RCC_FREQ_HSI)
-    return RTE_HSI;
+  ClockGeneration++;
 
-  if (type == RCC_FREQ_HSE)
-    return RTE_HSE;
+  /* Skip 0, which marks a driver cache as never filled */
+  if (ClockGeneration == 0U)
+    ClockGeneration = 1U;
 
-  uint32_t sysclk;
-  uint32_t rcc_cfgr = RCC->CFGR;
+  ClockSnapshotUpdate();
 
-  /* Get SYSCLK Frequency ----------------------------------------------------*/
-  switch (rcc_cfgr & RCC_CFGR_SWS) {
-    case RCC_CFGR_SWS_HSI:  /* HSI used as system clock */
-      sysclk = RTE_HSI;
-      break;
-    case RCC_CFGR_SWS_HSE:  /* HSE used as system clock */
-      sysclk = RTE_HSE;
-      break;
-    case RCC_CFGR_SWS_PLL:  /* PLL used as system clock */
-    {
-      /*
-       * PLL_VCO_OUT = (PLL_VCO_IN / PLLM) * PLLN
-       * SYSCLK = PLL_VCO_OUT / PLLP
-       */
-      uint32_t pllm, plln, pllp, vco_in;
-      uint32_t rcc_pllcfgr = RCC->PLLCFGR;
+  if (ClockChangeNesting != 0U) {
+    ClockChangePending = 1U;
+    return;
+  }
 
-      pllm = (rcc_pllcfgr & RCC_PLLCFGR_PLLM);
-      plln = (rcc_pllcfgr & RCC_PLLCFGR_PLLN) >> RCC_PLLCFGR_PLLN_Pos;
-      pllp = (((rcc_pllcfgr & RCC_PLLCFGR_PLLP) >> RCC_PLLCFGR_PLLP_Pos) + 1U) * 2U;
+  ClockNotify(RCC_CLOCK_EVENT_CHANGED);
+}
 
-      if (rcc_pllcfgr & RCC_PLLCFGR_PLLSRC)
-        vco_in = RTE_HSE;
-      else
-        vco_in = RTE_HSI;
+/**
+ * @fn          void RCC_ClockChangeBegin(void)
+ * @brief       Start a multi-step clock tree change. Subscribers get
+ *              RCC_CLOCK_EVENT_CHANGING, the RCC_CLOCK_EVENT_CHANGED events of
+ *              the nested RCC calls are merged into one sent by
+ *              RCC_ClockChangeEnd. Calls may nest.
+ */
+void RCC_ClockChangeBegin(void)
+{
+  if (ClockChangeNesting++ == 0U) {
+    ClockChangePending = 0U;
+    ClockNotify(RCC_CLOCK_EVENT_CHANGING);
+  }
+}
 
-      sysclk = vco_in / pllm * plln /pllp;
-      break;
-    }
-    default: /* HSI used as system clock */
-      sysclk = RTE_HSI;
-      break;
+/**
+ * @fn          void RCC_ClockChangeEnd(void)
+ * @brief       Finish a clock tree change started by RCC_ClockChangeBegin.
+ */
+void RCC_ClockChangeEnd(void)
+{
+  if (ClockChangeNesting == 0U)
+    return;
+
+  if (--ClockChangeNesting == 0U && ClockChangePending != 0U) {
+    ClockChangePending = 0U;
+    ClockNotify(RCC_CLOCK_EVENT_CHANGED);
   }
+}
 
-  if (type == RCC_FREQ_SYSCLK)
-    return sysclk;
+/**
+ * @fn          void RCC_ClockSubscribe(RCC_ClockSubscriber_t *sub)
+ * @brief       Register callback invoked after each clock tree change.
+ * @param[in]   sub  Pointer to subscriber with cb_event and arg set,
+ *                   must stay valid until unsubscribed
+ */
+void RCC_ClockSubscribe(RCC_ClockSubscriber_t *sub)
+{
+  RCC_ClockSubscriber_t *it;
 
-  /* Compute HCLK clock frequency --------------------------------------------*/
-  uint32_t hclk = (sysclk >> AHBPrescTable[(rcc_cfgr & RCC_CFGR_HPRE) >> 4U]);
+  if ((sub == NULL) || (sub->cb_event == NULL))
+    return;
 
-  if (type == RCC_FREQ_AHB)
-    return hclk;
+  for (it = ClockSubscribers; it != NULL; it = it->next) {
+    if (it == sub)
+      return;
+  }
 
-  /* Compute PCLK clock frequency --------------------------------------------*/
-  if (type == RCC_FREQ_APB1)
-    return (hclk >> APBPrescTable[(rcc_cfgr & RCC_CFGR_PPRE1) >> 10U]);
+  sub->next = ClockSubscribers;
+  ClockSubscribers = sub;
+}
+
+/**
+ * @fn          void RCC_ClockUnsubscribe(RCC_ClockSubscriber_t *sub)
+ * @brief       Remove clock change callback.
+ * @param[in]   sub  Pointer to subscriber
+ */
+void RCC_ClockUnsubscribe(RCC_ClockSubscriber_t *sub)
+{
+  RCC_ClockSubscriber_t **it;
+
+  for (it = &ClockSubscribers; *it != NULL; it = &(*it)->next) {
+    if (*it == sub) {
+      *it = sub->next;
+      sub->next = NULL;
+      break;
+    }
+  }
+}
 
-  return (hclk >> APBPrescTable[(rcc_cfgr & RCC_CFGR_PPRE2) >> 13U]);
+/**
+ * @fn          uint32_t RCC_GetClockGeneration(void)
+ * @brief       Get clock tree generation. Drivers keep the generation their
+ *              cached clock dividers were computed for and recompute them
+ *              once when it differs.
+ * @return      Clock tree generation, never 0
+ */
+uint32_t RCC_GetClockGeneration(void)
+{
+  return ClockGeneration;
+}
+
+/**
+ * @fn        uint32_t RCC_GetFreq(RCC_FREQ_t type)
+ * @brief     Get Clock Frequency from the clock tree snapshot
+ * @param[in] type  @ref RCC_FREQ_t
+ * @return    Returns clock frequency in Hz
+ */
+uint32_t RCC_GetFreq(RCC_FREQ_t type)
+{
+  if (SnapshotGeneration != ClockGeneration)
+    ClockSnapshotUpdate();
+
+  switch (type) {
+    case RCC_FREQ_HSI:
+      return RTE_HSI;
+    case RCC_FREQ_HSE:
+      return RTE_HSE;
+    case RCC_FREQ_SYSCLK:
+      return ClockSnapshot.sysclk;
+    case RCC_FREQ_AHB:
+      return ClockSnapshot.hclk;
+    case RCC_FREQ_APB1:
+      return ClockSnapshot.pclk1;
+    case RCC_FREQ_PLL_IN:
+      return ClockSnapshot.pll_in;
+    case RCC_FREQ_I2S:
+      return ClockSnapshot.i2sclk;
+    default:
+      return ClockSnapshot.pclk2;
+  }
 }
 
 /**
@@ -320,15 +518,26 @@ uint32_t RCC_GetPeriphFreq(RCC_Periph_t periph)
 
 /**
  * @fn          uint32_t RCC_I2SPLL_Config(uint32_t plln, uint32_t pllr)
- * @param[in]   plln
- * @param[in]   pllr
- * @return      Returns I2SPLL clock frequency in Hz
+ * @brief       Configure I2S PLL. PLL is not restarted if already running
+ *              with the requested factors.
+ * @param[in]   plln  PLLI2SN multiplication factor (50..432)
+ * @param[in]   pllr  PLLI2SR division factor (2..7)
+ * @return      Returns I2SPLL clock frequency in Hz, 0 on invalid factors
  */
 uint32_t RCC_I2SPLL_Config(uint32_t plln, uint32_t pllr)
 {
-  if ((pllr < 2U) || (pllr > 7U) || (plln < 100U) || (plln > 432U))
+  uint32_t vco = RCC_GetFreq(RCC_FREQ_PLL_IN) * plln;
+  uint32_t cfg = ((pllr << RCC_PLLI2SCFGR_PLLI2SR_Pos) | (plln << RCC_PLLI2SCFGR_PLLI2SN_Pos));
+  uint32_t msk = (RCC_PLLI2SCFGR_PLLI2SR | RCC_PLLI2SCFGR_PLLI2SN);
+
+  if ((pllr < 2U) || (pllr > 7U) || (plln < 50U) || (plln > 432U) ||
+      (vco < 100000000U) || (vco > 432000000U))
     return 0U;
 
+  /* I2S PLL already running with requested factors */
+  if ((RCC->CR & RCC_CR_PLLI2SRDY) && ((RCC->PLLI2SCFGR & msk) == cfg))
+    return (vco / pllr);
+
   /* Disable I2S PLL */
   if (RCC->CR & RCC_CR_PLLI2SRDY) {
     RCC->CR &= ~RCC_CR_PLLI2SON;
@@ -336,13 +545,15 @@ uint32_t RCC_I2SPLL_Config(uint32_t plln, uint32_t pllr)
   }
 
   /* Set PLLI2SCFGR register */
-  RCC->PLLI2SCFGR = ((pllr << RCC_PLLI2SCFGR_PLLI2SR_Pos) | (plln << RCC_PLLI2SCFGR_PLLI2SN_Pos));
+  RCC->PLLI2SCFGR = cfg;
 
   /* Enable I2S PLL */
   RCC->CR |= RCC_CR_PLLI2SON;
   while (!(RCC->CR & RCC_CR_PLLI2SRDY));
 
-  return (plln * 1000000U / pllr);
+  RCC_ClockChanged();
+
+  return (vco / pllr);
 }
 
 /**
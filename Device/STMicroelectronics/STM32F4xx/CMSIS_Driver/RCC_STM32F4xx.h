@@ -24,6 +24,7 @@
  *  includes
  ******************************************************************************/
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "stm32f4xx.h"
@@ -97,6 +98,10 @@
 #define RCC_PERIPH_APB1_MASK            (0x09013600)
 #define RCC_PERIPH_APB2_MASK            (0xFB8880CC)
 
+/* Clock change events */
+#define RCC_CLOCK_EVENT_CHANGED         (1UL << 0)    /* Clock tree has been changed */
+#define RCC_CLOCK_EVENT_CHANGING        (1UL << 1)    /* Clock tree is about to be changed */
+
 /*******************************************************************************
  *  typedefs and structures
  ******************************************************************************/
@@ -108,6 +113,8 @@ typedef enum {
   RCC_FREQ_AHB,
   RCC_FREQ_APB1,
   RCC_FREQ_APB2,
+  RCC_FREQ_PLL_IN,                      /* Main and I2S PLL input (after PLLM) */
+  RCC_FREQ_I2S,                         /* I2S PLL output, 0 when off or I2S_CKIN is used */
   RCC_FREQ_Reserved = 0x7FFFFFFF
 } RCC_FREQ_t;
 
@@ -272,6 +279,15 @@ typedef struct RCC_ClkInit_s {
   uint32_t APB2_clk_div;
 } RCC_ClkInit_t;
 
+typedef void (*RCC_ClockEvent_t)(uint32_t event, void *arg);
+
+/* Clock change subscriber, storage owned by the subscriber */
+typedef struct RCC_ClockSubscriber_s {
+  RCC_ClockEvent_t cb_event;
+  void *arg;
+  struct RCC_ClockSubscriber_s *next;
+} RCC_ClockSubscriber_t;
+
 /*******************************************************************************
  *  exported variables
  ******************************************************************************/
@@ -290,9 +306,57 @@ void RCC_ClkReset(void);
 void RCC_OscInit(RCC_OscInit_t *init);
 void RCC_ClkInit(RCC_ClkInit_t *init, uint32_t flash_latency);
 
+/**
+ * @fn          void RCC_ClockChanged(void)
+ * @brief       Notify drivers that the clock tree has been changed. Called by
+ *              the RCC configuration functions, must be called by code that
+ *              changes RCC clock settings directly. The clock tree snapshot
+ *              is refreshed before the subscribers are called.
+ */
+void RCC_ClockChanged(void);
+
+/**
+ * @fn          void RCC_ClockChangeBegin(void)
+ * @brief       Start a multi-step clock tree change. Subscribers get
+ *              RCC_CLOCK_EVENT_CHANGING, the RCC_CLOCK_EVENT_CHANGED events of
+ *              the nested RCC calls are merged into one sent by
+ *              RCC_ClockChangeEnd. Calls may nest.
+ */
+void RCC_ClockChangeBegin(void);
+
+/**
+ * @fn          void RCC_ClockChangeEnd(void)
+ * @brief       Finish a clock tree change started by RCC_ClockChangeBegin.
+ */
+void RCC_ClockChangeEnd(void);
+
+/**
+ * @fn          void RCC_ClockSubscribe(RCC_ClockSubscriber_t *sub)
+ * @brief       Register callback invoked after each clock tree change.
+ * @param[in]   sub  Pointer to subscriber with cb_event and arg set,
+ *                   must stay valid until unsubscribed
+ */
+void RCC_ClockSubscribe(RCC_ClockSubscriber_t *sub);
+
+/**
+ * @fn          void RCC_ClockUnsubscribe(RCC_ClockSubscriber_t *sub)
+ * @brief       Remove clock change callback.
+ * @param[in]   sub  Pointer to subscriber
+ */
+void RCC_ClockUnsubscribe(RCC_ClockSubscriber_t *sub);
+
+/**
+ * @fn          uint32_t RCC_GetClockGeneration(void)
+ * @brief       Get clock tree generation. Drivers keep the generation their
+ *              cached clock dividers were computed for and recompute them
+ *              once when it differs.
+ * @return      Clock tree generation, never 0
+ */
+uint32_t RCC_GetClockGeneration(void);
+
 /**
  * @fn        uint32_t RCC_GetFreq(RCC_FREQ_t type)
- * @brief     Get Clock Frequency
+ * @brief     Get Clock Frequency from the clock tree snapshot
  * @param[in] type  @ref RCC_FREQ_t
  * @return    Returns clock frequency in Hz
  */
@@ -308,9 +372,11 @@ uint32_t RCC_GetPeriphFreq(RCC_Periph_t periph);
 
 /**
  * @fn          uint32_t RCC_I2SPLL_Config(uint32_t plln, uint32_t pllr)
- * @param[in]   plln
- * @param[in]   pllr
- * @return      Returns I2SPLL clock frequency in Hz
+ * @brief       Configure I2S PLL. PLL is not restarted if already running
+ *              with the requested factors.
+ * @param[in]   plln  PLLI2SN multiplication factor (50..432)
+ * @param[in]   pllr  PLLI2SR division factor (2..7)
+ * @return      Returns I2SPLL clock frequency in Hz, 0 on invalid factors
  */
 uint32_t RCC_I2SPLL_Config(uint32_t plln, uint32_t pllr);
 
@@ -31,7 +31,7 @@
  *  defines and macros (scope: module-local)
  ******************************************************************************/
 
-#define ARM_SPI_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0) /* driver version */
+#define ARM_SPI_DRV_VERSION    ARM_DRIVER_VERSION_MAJOR_MINOR(1, 1) /* driver version */
 
 /*******************************************************************************
  *  typedefs and structures (scope: module-local)
@@ -41,6 +41,10 @@
  *  function prototypes (scope: module-local)
  ******************************************************************************/
 
+#ifdef SPI_DMA
+static void SPI_TransactionFlush(SPI_RESOURCES *spi);
+#endif
+
 #ifdef SPI1_TX_DMA_Stream
 static void SPI1_TX_DMA_Complete(uint32_t event);
 #endif // SPI1_TX_DMA_Stream
@@ -152,6 +156,7 @@ static DMA_Resources_t SPI1_TX_DMA = {
   SPI1_TX_DMA_Complete,
   RTE_SPI_DMA_INT_PRIORITY,
   SPI1_TX_DMA_IRQn,
+  DMA_REQUEST_SPI1_TX,
 };
 
 #endif
@@ -167,6 +172,7 @@ static DMA_Resources_t SPI1_RX_DMA = {
   SPI1_RX_DMA_Complete,
   RTE_SPI_DMA_INT_PRIORITY,
   SPI1_RX_DMA_IRQn,
+  DMA_REQUEST_SPI1_RX,
 };
 
 #endif
@@ -247,6 +253,7 @@ static DMA_Resources_t SPI2_TX_DMA = {
   SPI2_TX_DMA_Complete,
   RTE_SPI_DMA_INT_PRIORITY,
   SPI2_TX_DMA_IRQn,
+  DMA_REQUEST_SPI2_TX,
 };
 
 #endif
@@ -262,6 +269,7 @@ static DMA_Resources_t SPI2_RX_DMA = {
   SPI2_RX_DMA_Complete,
   RTE_SPI_DMA_INT_PRIORITY,
   SPI2_RX_DMA_IRQn,
+  DMA_REQUEST_SPI2_RX,
 };
 
 #endif
@@ -342,6 +350,7 @@ static DMA_Resources_t SPI3_TX_DMA = {
   SPI3_TX_DMA_Complete,
   RTE_SPI_DMA_INT_PRIORITY,
   SPI3_TX_DMA_IRQn,
+  DMA_REQUEST_SPI3_TX,
 };
 
 #endif
@@ -357,6 +366,7 @@ static DMA_Resources_t SPI3_RX_DMA = {
   SPI3_RX_DMA_Complete,
   RTE_SPI_DMA_INT_PRIORITY,
   SPI3_RX_DMA_IRQn,
+  DMA_REQUEST_SPI3_RX,
 };
 
 #endif
@@ -437,6 +447,7 @@ static DMA_Resources_t SPI4_TX_DMA = {
   SPI4_TX_DMA_Complete,
   RTE_SPI_DMA_INT_PRIORITY,
   SPI4_TX_DMA_IRQn,
+  DMA_REQUEST_SPI4_TX,
 };
 
 #endif
@@ -452,6 +463,7 @@ static DMA_Resources_t SPI4_RX_DMA = {
   SPI4_RX_DMA_Complete,
   RTE_SPI_DMA_INT_PRIORITY,
   SPI4_RX_DMA_IRQn,
+  DMA_REQUEST_SPI4_RX,
 };
 
 #endif
@@ -532,6 +544,7 @@ static DMA_Resources_t SPI5_TX_DMA = {
   SPI5_TX_DMA_Complete,
   RTE_SPI_DMA_INT_PRIORITY,
   SPI5_TX_DMA_IRQn,
+  DMA_REQUEST_SPI5_TX,
 };
 
 #endif
@@ -547,6 +560,7 @@ static DMA_Resources_t SPI5_RX_DMA = {
   SPI5_RX_DMA_Complete,
   RTE_SPI_DMA_INT_PRIORITY,
   SPI5_RX_DMA_IRQn,
+  DMA_REQUEST_SPI5_RX,
 };
 
 #endif
@@ -627,6 +641,7 @@ static DMA_Resources_t SPI6_TX_DMA = {
   SPI6_TX_DMA_Complete,
   RTE_SPI_DMA_INT_PRIORITY,
   SPI6_TX_DMA_IRQn,
+  DMA_REQUEST_SPI6_TX,
 };
 
 #endif
@@ -642,6 +657,7 @@ static DMA_Resources_t SPI6_RX_DMA = {
   SPI6_RX_DMA_Complete,
   RTE_SPI_DMA_INT_PRIORITY,
   SPI6_RX_DMA_IRQn,
+  DMA_REQUEST_SPI6_RX,
 };
 
 #endif
@@ -715,25 +731,91 @@ void PinConfig(const SPI_PIN *io, const GPIO_PIN_CFG_t *pin_cfg)
 }
 
 /**
- *
- * @return
+ * @fn          const uint32_t *GetBusSpeedTable(SPI_RESOURCES *spi)
+ * @brief       Get bus speed for each baud rate prescaler value. The table
+ *              is rebuilt only after the RCC clock tree has changed.
+ * @param[in]   spi  Pointer to SPI resources
+ * @return      Pointer to table of 8 bus speeds in Hz
+ */
+static
+const uint32_t *GetBusSpeedTable(SPI_RESOURCES *spi)
+{
+  SPI_INFO *info = spi->info;
+  uint32_t gen = RCC_GetClockGeneration();
+  uint32_t pclk, val;
+
+  if (info->clk_gen != gen) {
+    pclk = RCC_GetPeriphFreq(spi->rcc);
+
+    for (val = 0U; val < 8U; val++)
+      info->br_freq[val] = pclk >> (val + 1U);
+
+    info->clk_gen = gen;
+  }
+
+  return info->br_freq;
+}
+
+/**
+ * @fn          int32_t CalcPrescalerValue(SPI_RESOURCES *spi, uint32_t freq)
+ * @brief       Get baud rate prescaler for the highest bus speed not above
+ *              the requested one.
+ * @param[in]   spi   Pointer to SPI resources
+ * @param[in]   freq  Requested bus speed in Hz
+ * @return      Baud rate prescaler value, -1 if not possible
  */
 int32_t CalcPrescalerValue(SPI_RESOURCES *spi, uint32_t freq)
 {
+  const uint32_t *br_freq = GetBusSpeedTable(spi);
   int32_t val;
 
-  uint32_t pclk = RCC_GetPeriphFreq(spi->rcc);
   for (val = 0; val < 8; val++) {
-    if (freq >= (pclk >> (val + 1)))
-      break;
+    if (freq >= br_freq[val])
+      return (val);
   }
 
-  if ((val == 8) || (freq < (pclk >> (val + 1)))) {
-    // Requested Bus Speed can not be configured
-    val = -1;
-  }
+  // Requested Bus Speed can not be configured
+  return (-1);
+}
+
+/**
+ * @fn          void SPI_ClockEvent(uint32_t event, void *arg)
+ * @brief       Recompute master baud rate prescaler after a clock change.
+ *              Queued devices are prepared again by their own generation
+ *              check, a running transfer holds the performance lock.
+ * @param[in]   event  RCC_CLOCK_EVENT_xxx
+ * @param[in]   arg    Pointer to SPI resources
+ */
+static
+void SPI_ClockEvent(uint32_t event, void *arg)
+{
+  SPI_RESOURCES *spi = (SPI_RESOURCES *)arg;
+  SPI_INFO *info = spi->info;
+  SPI_TypeDef *reg = spi->reg;
+  int32_t br;
+
+  if ((event & RCC_CLOCK_EVENT_CHANGED) == 0U)
+    return;
 
-  return (val);
+  if ((info->state & SPI_CONFIGURED) == 0U)
+    return;
+
+  if ((info->mode & ARM_SPI_CONTROL_Msk) != ARM_SPI_MODE_MASTER)
+    return;
+
+  br = CalcPrescalerValue(spi, info->bus_speed);
+  if (br < 0)
+    br = (int32_t)(SPI_CR1_BR_Msk >> SPI_CR1_BR_Pos);
+
+  if (info->trans_head != NULL) {
+    // Applied when the transaction queue drains
+    info->cr1 = (info->cr1 & ~SPI_CR1_BR_Msk) | ((uint32_t)br << SPI_CR1_BR_Pos);
+  }
+  else if (info->status.busy == 0U) {
+    reg->CR1 &= ~SPI_CR1_SPE;
+    reg->CR1 = (reg->CR1 & ~SPI_CR1_BR_Msk) | ((uint32_t)br << SPI_CR1_BR_Pos);
+    reg->CR1 |= SPI_CR1_SPE;
+  }
 }
 
 /**
@@ -840,6 +922,12 @@ int32_t SPI_PowerControl(ARM_POWER_STATE state, SPI_RESOURCES *spi)
 
   switch (state) {
     case ARM_POWER_OFF:
+#ifdef SPI_DMA
+      /* Release chip select and drop queued transactions */
+      if ((info->state & SPI_POWERED) != 0U)
+        SPI_TransactionFlush(spi);
+#endif
+
       /* SPI peripheral reset */
       RCC_ResetPeriph(spi->rcc);
       /* Disable SPI IRQ */
@@ -857,6 +945,11 @@ int32_t SPI_PowerControl(ARM_POWER_STATE state, SPI_RESOURCES *spi)
       /* Disable peripheral clock */
       RCC_DisablePeriph(spi->rcc);
 
+      RCC_ClockUnsubscribe(&info->clk_sub);
+
+      if (info->status.busy)
+        DFS_UNLOCK();
+
       /* Clear status flags */
       info->status.busy       = 0U;
       info->status.data_lost  = 0U;
@@ -902,7 +995,10 @@ int32_t SPI_PowerControl(ARM_POWER_STATE state, SPI_RESOURCES *spi)
         cfg->MemBurst  = DMA_MBURST_SINGLE;
         cfg->PerBurst  = DMA_PBURST_SINGLE;
 
-        DMA_Initialize(spi->tx_dma);
+        if (DMA_Initialize(spi->tx_dma) != ARM_DRIVER_OK) {
+          SPI_PowerControl(ARM_POWER_OFF, spi);
+          return ARM_DRIVER_ERROR;
+        }
       }
 
       if (spi->rx_dma != NULL) {
@@ -914,12 +1010,20 @@ int32_t SPI_PowerControl(ARM_POWER_STATE state, SPI_RESOURCES *spi)
         cfg->MemBurst  = DMA_MBURST_SINGLE;
         cfg->PerBurst  = DMA_PBURST_SINGLE;
 
-        DMA_Initialize(spi->rx_dma);
+        if (DMA_Initialize(spi->rx_dma) != ARM_DRIVER_OK) {
+          SPI_PowerControl(ARM_POWER_OFF, spi);
+          return ARM_DRIVER_ERROR;
+        }
       }
 #endif
 
       /* Reset the peripheral */
       RCC_ResetPeriph(spi->rcc);
+
+      /* Follow clock tree changes */
+      info->clk_sub.cb_event = SPI_ClockEvent;
+      info->clk_sub.arg      = (void *)((uint32_t)spi);
+      RCC_ClockSubscribe(&info->clk_sub);
       break;
 
     default:
@@ -955,6 +1059,8 @@ int32_t SPI_Send(const void *data, uint32_t num, SPI_RESOURCES *spi)
   if (info->status.busy)
     return ARM_DRIVER_ERROR_BUSY;
 
+  DFS_LOCK();
+
   cr1 = reg->CR1;
   cr2 = reg->CR2;
 
@@ -1079,6 +1185,8 @@ int32_t SPI_Receive(void *data, uint32_t num, SPI_RESOURCES *spi)
   if (info->status.busy)
     return ARM_DRIVER_ERROR_BUSY;
 
+  DFS_LOCK();
+
   cr2 = reg->CR2;
 
   // Update SPI statuses
@@ -1198,6 +1306,8 @@ int32_t SPI_Transfer(const void *data_out, void *data_in, uint32_t num, SPI_RESO
   if (info->status.busy)
     return ARM_DRIVER_ERROR_BUSY;
 
+  DFS_LOCK();
+
   cr1 = reg->CR1;
   cr2 = reg->CR2;
 
@@ -1365,7 +1475,16 @@ int32_t SPI_Control(uint32_t control, uint32_t arg, SPI_RESOURCES *spi)
 
     reg->CR2 = cr2;
 
+#ifdef SPI_DMA
+    // Release chip select and drop queued transactions
+    SPI_TransactionFlush(spi);
+#endif
+
     memset((void *)spi->xfer, 0, sizeof(SPI_TRANSFER_INFO));
+
+    if (info->status.busy)
+      DFS_UNLOCK();
+
     info->status.busy = 0U;
 
     return ARM_DRIVER_OK;
@@ -1401,6 +1520,11 @@ int32_t SPI_Control(uint32_t control, uint32_t arg, SPI_RESOURCES *spi)
       if (br < 0)
         return (ARM_DRIVER_ERROR);
 
+      info->bus_speed = arg;
+
+      if ((uint32_t)br == ((reg->CR1 & SPI_CR1_BR_Msk) >> SPI_CR1_BR_Pos))
+        return (ARM_DRIVER_OK);
+
       /* Disable SPI, update prescaler and enable SPI */
       reg->CR1 &= ~SPI_CR1_SPE;
       reg->CR1 = (reg->CR1 & ~SPI_CR1_BR_Msk) | (br << SPI_CR1_BR_Pos);
@@ -1409,7 +1533,7 @@ int32_t SPI_Control(uint32_t control, uint32_t arg, SPI_RESOURCES *spi)
 
     case ARM_SPI_GET_BUS_SPEED:
       /* Return current bus speed */
-      return (int32_t)(RCC_GetPeriphFreq(spi->rcc) >> (((reg->CR1 & SPI_CR1_BR_Msk) >> SPI_CR1_BR_Pos) + 1U));
+      return (int32_t)GetBusSpeedTable(spi)[(reg->CR1 & SPI_CR1_BR_Msk) >> SPI_CR1_BR_Pos];
 
     case ARM_SPI_SET_DEFAULT_TX_VALUE:
       spi->xfer->def_val = (uint16_t)(arg & 0xFFFFU);
@@ -1596,6 +1720,7 @@ int32_t SPI_Control(uint32_t control, uint32_t arg, SPI_RESOURCES *spi)
       return ARM_DRIVER_ERROR;
     // Save prescaler value
     cr1 |= (br << SPI_CR1_BR_Pos);
+    info->bus_speed = arg;
   }
 
   info->mode = mode;
@@ -1636,6 +1761,354 @@ ARM_SPI_STATUS SPI_GetStatus(SPI_RESOURCES *spi)
   return status;
 }
 
+#ifdef SPI_DMA
+/**
+ * @fn          int32_t SPI_DevicePrepare(SPI_DEVICE *dev, SPI_RESOURCES *spi)
+ * @brief       Prepare CR1 value and chip select pin of a queued device.
+ *              CR1 is prepared again after the RCC clock tree has changed.
+ * @param[in]   dev  Pointer to SPI device
+ * @param[in]   spi  Pointer to SPI resources
+ * @return      \ref execution_status
+ */
+static
+int32_t SPI_DevicePrepare(SPI_DEVICE *dev, SPI_RESOURCES *spi)
+{
+  int32_t br;
+  uint32_t cr1;
+
+  if (dev->cr1 == 0U) {
+    // Chip select inactive
+    if (GPIO_GetPortClockState(dev->cs.port) == false)
+      GPIO_PortClock(dev->cs.port, GPIO_PORT_CLK_ENABLE);
+
+    GPIO_PinWrite(dev->cs.port, dev->cs.pin, GPIO_PIN_OUT_HIGH);
+    PinConfig(&dev->cs, &SPI_pin_cfg_out_pp);
+  }
+
+  // Master with software slave management, chip select driven by GPIO
+  cr1 = SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI;
+
+  switch (dev->mode & ARM_SPI_FRAME_FORMAT_Msk) {
+    case ARM_SPI_CPOL0_CPHA0:
+      break;
+    case ARM_SPI_CPOL0_CPHA1:
+      cr1 |= SPI_CR1_CPHA;
+      break;
+    case ARM_SPI_CPOL1_CPHA0:
+      cr1 |= SPI_CR1_CPOL;
+      break;
+    case ARM_SPI_CPOL1_CPHA1:
+      cr1 |= SPI_CR1_CPHA | SPI_CR1_CPOL;
+      break;
+    default:
+      return ARM_SPI_ERROR_FRAME_FORMAT;
+  }
+
+  switch (dev->mode & ARM_SPI_DATA_BITS_Msk) {
+    case ARM_SPI_DATA_BITS(8U):
+      break;
+    case ARM_SPI_DATA_BITS(16U):
+      cr1 |= SPI_CR1_DFF;
+      break;
+    default:
+      return ARM_SPI_ERROR_DATA_BITS;
+  }
+
+  if ((dev->mode & ARM_SPI_BIT_ORDER_Msk) == ARM_SPI_LSB_MSB)
+    cr1 |= SPI_CR1_LSBFIRST;
+
+  br = CalcPrescalerValue(spi, dev->bus_speed);
+  if (br < 0)
+    return ARM_DRIVER_ERROR;
+
+  cr1 |= (br << SPI_CR1_BR_Pos);
+
+  dev->cr1     = (uint16_t)cr1;
+  dev->clk_gen = RCC_GetClockGeneration();
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+ * @fn          void SPI_SegmentStart(SPI_RESOURCES *spi)
+ * @brief       Start DMA transfer of the current transaction segment.
+ * @param[in]   spi  Pointer to SPI resources
+ */
+static
+void SPI_SegmentStart(SPI_RESOURCES *spi)
+{
+  SPI_INFO *info = spi->info;
+  SPI_TRANSFER_INFO *xfer = spi->xfer;
+  SPI_TypeDef *reg = spi->reg;
+  const SPI_SEGMENT *seg = &info->trans_head->seg[info->seg_idx];
+  DMA_StreamConfig_t *cfg;
+  uint32_t mem_align, per_align;
+
+  if (reg->CR1 & SPI_CR1_DFF) {
+    /* 16 - bit data frame */
+    mem_align = DMA_MDATAALIGN_HALFWORD;
+    per_align = DMA_PDATAALIGN_HALFWORD;
+  }
+  else {
+    /* 8 - bit data frame */
+    mem_align = DMA_MDATAALIGN_BYTE;
+    per_align = DMA_PDATAALIGN_BYTE;
+  }
+
+  xfer->rx_buf = (uint8_t *)seg->rx_buf;
+  xfer->tx_buf = (uint8_t *)((uint32_t)seg->tx_buf);
+  xfer->num    = seg->num;
+  xfer->rx_cnt = 0U;
+  xfer->tx_cnt = 0U;
+
+  /* Receive into buffer or dump */
+  cfg = &spi->rx_dma->handle->config;
+  cfg->MemInc       = (seg->rx_buf != NULL) ? DMA_MINC_ENABLE : DMA_MINC_DISABLE;
+  cfg->PerInc       = DMA_PINC_DISABLE;
+  cfg->MemDataAlign = mem_align;
+  cfg->PerDataAlign = per_align;
+
+  DMA_StreamConfig(spi->rx_dma);
+  DMA_StreamEnable(spi->rx_dma, (uint32_t)&reg->DR,
+                   (seg->rx_buf != NULL) ? (uint32_t)seg->rx_buf : (uint32_t)&xfer->dump_val, seg->num);
+
+  /* Send from buffer or default value */
+  cfg = &spi->tx_dma->handle->config;
+  cfg->MemInc       = (seg->tx_buf != NULL) ? DMA_MINC_ENABLE : DMA_MINC_DISABLE;
+  cfg->PerInc       = DMA_PINC_DISABLE;
+  cfg->MemDataAlign = mem_align;
+  cfg->PerDataAlign = per_align;
+
+  DMA_StreamConfig(spi->tx_dma);
+  DMA_StreamEnable(spi->tx_dma, (uint32_t)&reg->DR,
+                   (seg->tx_buf != NULL) ? (uint32_t)seg->tx_buf : (uint32_t)&xfer->def_val, seg->num);
+
+  reg->CR2 |= (SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+}
+
+/**
+ * @fn          void SPI_TransactionIdle(SPI_RESOURCES *spi)
+ * @brief       Restore settings made by SPI_Control once the transaction
+ *              queue is empty and release the performance lock.
+ * @param[in]   spi  Pointer to SPI resources
+ */
+static
+void SPI_TransactionIdle(SPI_RESOURCES *spi)
+{
+  SPI_INFO *info = spi->info;
+  SPI_TypeDef *reg = spi->reg;
+
+  info->trans_tail = NULL;
+
+  reg->CR1 &= ~SPI_CR1_SPE;
+  reg->CR1  = info->cr1 & ~SPI_CR1_SPE;
+  reg->CR1 |= (info->cr1 & SPI_CR1_SPE);
+
+  info->status.busy = 0U;
+
+  DFS_UNLOCK();
+}
+
+/**
+ * @fn          void SPI_TransactionStart(SPI_RESOURCES *spi)
+ * @brief       Apply device settings, assert chip select and start the first
+ *              segment of the transaction at the queue head. Transactions
+ *              whose device cannot be prepared for the current clock tree
+ *              fail with SPI_TRANSACTION_ERROR.
+ * @param[in]   spi  Pointer to SPI resources
+ */
+static
+void SPI_TransactionStart(SPI_RESOURCES *spi)
+{
+  SPI_INFO *info = spi->info;
+  SPI_TRANSACTION *trans;
+  SPI_DEVICE *dev;
+  SPI_TypeDef *reg = spi->reg;
+
+  while ((trans = info->trans_head) != NULL) {
+    dev = trans->dev;
+
+    // Clock tree changed since the device was queued
+    if ((dev->clk_gen == RCC_GetClockGeneration()) || (SPI_DevicePrepare(dev, spi) == ARM_DRIVER_OK))
+      break;
+
+    info->trans_head = trans->next;
+    trans->status    = SPI_TRANSACTION_ERROR;
+
+    if (trans->cb_event != NULL)
+      trans->cb_event(trans);
+  }
+
+  if (trans == NULL) {
+    SPI_TransactionIdle(spi);
+    return;
+  }
+
+  // Reprogram only when the device settings differ from the current ones
+  if ((reg->CR1 & ~SPI_CR1_SPE) != dev->cr1) {
+    reg->CR1 &= ~SPI_CR1_SPE;
+    reg->CR1  = dev->cr1;
+    reg->CR1 |= SPI_CR1_SPE;
+  }
+
+  trans->status = SPI_TRANSACTION_ACTIVE;
+  info->seg_idx = 0U;
+
+  GPIO_PinWrite(dev->cs.port, dev->cs.pin, GPIO_PIN_OUT_LOW);
+
+  SPI_SegmentStart(spi);
+}
+
+/**
+ * @fn          void SPI_TransactionNext(SPI_RESOURCES *spi)
+ * @brief       Continue with the next segment or transaction. Called from
+ *              the RX DMA complete event while a transaction is active.
+ * @param[in]   spi  Pointer to SPI resources
+ */
+static
+void SPI_TransactionNext(SPI_RESOURCES *spi)
+{
+  SPI_INFO *info = spi->info;
+  SPI_TRANSACTION *trans = info->trans_head;
+
+  // TX stream completion may still be pending when its IRQ has lower priority
+  if (spi->tx_dma->handle->state == DMA_STATE_BUSY)
+    DMA_IRQ_Handle(spi->tx_dma);
+
+  if (++info->seg_idx < trans->seg_num) {
+    SPI_SegmentStart(spi);
+    return;
+  }
+
+  GPIO_PinWrite(trans->dev->cs.port, trans->dev->cs.pin, GPIO_PIN_OUT_HIGH);
+
+  info->trans_head = trans->next;
+
+  if (info->trans_head != NULL)
+    SPI_TransactionStart(spi);
+  else
+    SPI_TransactionIdle(spi);
+
+  trans->status = SPI_TRANSACTION_DONE;
+
+  if (trans->cb_event != NULL)
+    trans->cb_event(trans);
+}
+
+/**
+ * @fn          void SPI_TransactionFlush(SPI_RESOURCES *spi)
+ * @brief       Release chip select and abort all queued transactions.
+ * @param[in]   spi  Pointer to SPI resources
+ */
+static
+void SPI_TransactionFlush(SPI_RESOURCES *spi)
+{
+  SPI_INFO *info = spi->info;
+  SPI_TRANSACTION *trans = info->trans_head;
+  SPI_TypeDef *reg = spi->reg;
+
+  if (trans == NULL)
+    return;
+
+  GPIO_PinWrite(trans->dev->cs.port, trans->dev->cs.pin, GPIO_PIN_OUT_HIGH);
+
+  info->trans_head = NULL;
+  info->trans_tail = NULL;
+
+  reg->CR1 &= ~SPI_CR1_SPE;
+  reg->CR1  = info->cr1 & ~SPI_CR1_SPE;
+  reg->CR1 |= (info->cr1 & SPI_CR1_SPE);
+
+  while (trans != NULL) {
+    SPI_TRANSACTION *next = trans->next;
+
+    trans->status = SPI_TRANSACTION_ABORTED;
+
+    if (trans->cb_event != NULL)
+      trans->cb_event(trans);
+
+    trans = next;
+  }
+}
+
+/**
+ * @fn          int32_t SPI_TransactionSubmit(SPI_TRANSACTION *trans, SPI_RESOURCES *spi)
+ * @brief       Queue a transaction. Each transaction selects its device,
+ *              applies the device settings and runs all segments with chip
+ *              select held active. Queued transactions are chained from the
+ *              DMA complete event without returning to the application.
+ * @param[in]   trans  Pointer to transaction, must stay valid until done
+ * @param[in]   spi    Pointer to SPI resources
+ * @return      \ref execution_status
+ */
+static
+int32_t SPI_TransactionSubmit(SPI_TRANSACTION *trans, SPI_RESOURCES *spi)
+{
+  SPI_INFO *info = spi->info;
+  uint32_t idx, primask;
+  int32_t status;
+  bool start = false;
+
+  if ((trans == NULL) || (trans->dev == NULL) || (trans->seg == NULL) || (trans->seg_num == 0U))
+    return ARM_DRIVER_ERROR_PARAMETER;
+
+  for (idx = 0U; idx < trans->seg_num; idx++) {
+    if ((trans->seg[idx].num == 0U) || (trans->seg[idx].num > 0xFFFFU))
+      return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((info->state & SPI_CONFIGURED) == 0U)
+    return ARM_DRIVER_ERROR;
+
+  if ((info->mode & ARM_SPI_CONTROL_Msk) != ARM_SPI_MODE_MASTER)
+    return ARM_DRIVER_ERROR;
+
+  if ((trans->dev->cr1 == 0U) || (trans->dev->clk_gen != RCC_GetClockGeneration())) {
+    status = SPI_DevicePrepare(trans->dev, spi);
+    if (status != ARM_DRIVER_OK)
+      return status;
+  }
+
+  trans->next   = NULL;
+  trans->status = SPI_TRANSACTION_PENDING;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (info->trans_head == NULL) {
+    if (info->status.busy) {
+      __set_PRIMASK(primask);
+      trans->status = SPI_TRANSACTION_IDLE;
+      return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    info->trans_head = trans;
+    info->trans_tail = trans;
+    info->cr1        = spi->reg->CR1;
+
+    info->status.busy       = 1U;
+    info->status.data_lost  = 0U;
+    info->status.mode_fault = 0U;
+
+    // Taken with busy set, an abort releases it
+    DFS_LOCK();
+
+    start = true;
+  }
+  else {
+    info->trans_tail->next = trans;
+    info->trans_tail       = trans;
+  }
+
+  __set_PRIMASK(primask);
+
+  if (start)
+    SPI_TransactionStart(spi);
+
+  return ARM_DRIVER_OK;
+}
+#endif  // SPI_DMA
+
 /**
  * @fn          void SPI_IRQHandler(SPI_RESOURCES *spi)
  * @brief       SPI Interrupt handler.
@@ -1708,6 +2181,7 @@ void SPI_IRQHandler(SPI_RESOURCES *spi)
         cr2 &= ~SPI_CR2_RXNEIE;
         /* Clear busy flag */
         info->status.busy = 0U;
+        DFS_UNLOCK();
         /* Transfer completed */
         event |= ARM_SPI_EVENT_TRANSFER_COMPLETE;
       }
@@ -1773,11 +2247,21 @@ void SPI_RX_DMA_Complete(uint32_t event, SPI_RESOURCES *spi)
 
   if (event & DMA_EVENT_TRANSFER_COMPLETE) {
     /* RX Buffer DMA disable */
-    spi->reg->CR2 |= SPI_CR2_RXDMAEN;
+    spi->reg->CR2 &= ~SPI_CR2_RXDMAEN;
 
     spi->xfer->rx_cnt = spi->xfer->num;
+
+#ifdef SPI_DMA
+    if (info->trans_head != NULL) {
+      SPI_TransactionNext(spi);
+      return;
+    }
+#endif
+
     info->status.busy = 0U;
 
+    DFS_UNLOCK();
+
     if (info->cb_event != NULL)
       info->cb_event(ARM_SPI_EVENT_TRANSFER_COMPLETE);
   }
@@ -1794,6 +2278,10 @@ void SPI_RX_DMA_Complete(uint32_t event, SPI_RESOURCES *spi)
   #ifdef SPI1_RX_DMA_Stream
     SPIx_RX_DMA_ALLOC(1);
   #endif // SPI1_RX_DMA_Stream
+
+  #if defined(SPI1_TX_DMA_Stream) && defined(SPI1_RX_DMA_Stream)
+    SPIx_TRANSACTION_ALLOC(1);
+  #endif
 #endif  /* USE_SPI1 */
 
 #if defined(USE_SPI2)
@@ -1806,6 +2294,10 @@ void SPI_RX_DMA_Complete(uint32_t event, SPI_RESOURCES *spi)
   #ifdef SPI2_RX_DMA_Stream
     SPIx_RX_DMA_ALLOC(2);
   #endif
+
+  #if defined(SPI2_TX_DMA_Stream) && defined(SPI2_RX_DMA_Stream)
+    SPIx_TRANSACTION_ALLOC(2);
+  #endif
 #endif  /* USE_SPI2 */
 
 #if defined(USE_SPI3)
@@ -1818,6 +2310,10 @@ void SPI_RX_DMA_Complete(uint32_t event, SPI_RESOURCES *spi)
   #ifdef SPI3_RX_DMA_Stream
     SPIx_RX_DMA_ALLOC(3);
   #endif
+
+  #if defined(SPI3_TX_DMA_Stream) && defined(SPI3_RX_DMA_Stream)
+    SPIx_TRANSACTION_ALLOC(3);
+  #endif
 #endif  /* USE_SPI3 */
 
 #if defined(USE_SPI4)
@@ -1830,6 +2326,10 @@ void SPI_RX_DMA_Complete(uint32_t event, SPI_RESOURCES *spi)
   #ifdef SPI4_RX_DMA_Stream
     SPIx_RX_DMA_ALLOC(4);
   #endif
+
+  #if defined(SPI4_TX_DMA_Stream) && defined(SPI4_RX_DMA_Stream)
+    SPIx_TRANSACTION_ALLOC(4);
+  #endif
 #endif  /* USE_SPI4 */
 
 #if defined(USE_SPI5)
@@ -1842,6 +2342,10 @@ void SPI_RX_DMA_Complete(uint32_t event, SPI_RESOURCES *spi)
   #ifdef SPI5_RX_DMA_Stream
     SPIx_RX_DMA_ALLOC(5);
   #endif
+
+  #if defined(SPI5_TX_DMA_Stream) && defined(SPI5_RX_DMA_Stream)
+    SPIx_TRANSACTION_ALLOC(5);
+  #endif
 #endif  /* USE_SPI5 */
 
 #if defined(USE_SPI6)
@@ -1854,6 +2358,10 @@ void SPI_RX_DMA_Complete(uint32_t event, SPI_RESOURCES *spi)
   #ifdef SPI6_RX_DMA_Stream
     SPIx_RX_DMA_ALLOC(6);
   #endif
+
+  #if defined(SPI6_TX_DMA_Stream) && defined(SPI6_RX_DMA_Stream)
+    SPIx_TRANSACTION_ALLOC(6);
+  #endif
 #endif  /* USE_SPI6 */
 
 /* ----------------------------- End of file ---------------------------------*/
@@ -31,6 +31,7 @@
 #include "RCC_STM32F4xx.h"
 #include "GPIO_STM32F4xx.h"
 #include "DMA_STM32F4xx.h"
+#include "DFS_STM32F4xx.h"
 
 #include "Driver_SPI.h"
 
@@ -82,6 +83,9 @@ ARM_DRIVER_SPI Driver_SPI##x = {        \
 }                                       \
 
 
+#define SPIx_TRANSACTION_ALLOC(x)                                                                                            \
+int32_t SPI##x##_TransactionSubmit (SPI_TRANSACTION *trans) { return SPI_TransactionSubmit(trans, &SPI##x##_Resources); }   \
+
 #define SPIx_TX_DMA_ALLOC(x)                                                                         \
 void SPI##x##_TX_DMA_Handler  (void)           { DMA_IRQ_Handle(&SPI##x##_TX_DMA); }                 \
 void SPI##x##_TX_DMA_Complete (uint32_t event) { SPI_TX_DMA_Complete(event, &SPI##x##_Resources); }  \
@@ -718,6 +722,14 @@ void SPI##x##_RX_DMA_Complete (uint32_t event) { SPI_RX_DMA_Complete(event, &SPI
 #define SPI_DATA_LOST             ((uint8_t)(1U << 3))     // SPI data lost occurred
 #define SPI_MODE_FAULT            ((uint8_t)(1U << 4))     // SPI mode fault occurred
 
+/* Transaction status definition */
+#define SPI_TRANSACTION_IDLE      0U                       // Transaction not submitted
+#define SPI_TRANSACTION_PENDING   1U                       // Transaction waiting in queue
+#define SPI_TRANSACTION_ACTIVE    2U                       // Transaction in progress
+#define SPI_TRANSACTION_DONE      3U                       // Transaction completed
+#define SPI_TRANSACTION_ABORTED   4U                       // Transaction aborted
+#define SPI_TRANSACTION_ERROR     5U                       // Device settings not applicable, not started
+
 /*******************************************************************************
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
@@ -743,12 +755,50 @@ typedef struct _SPI_STATUS {
   uint8_t               mode_fault;         // Mode fault detected; optional (cleared on start of transfer operation)
 } SPI_STATUS;
 
+/* SPI Device (queued transactions) */
+typedef struct _SPI_DEVICE {
+  uint32_t              mode;               // Frame format, data bits and bit order (ARM_SPI_xxx)
+  uint32_t              bus_speed;          // Bus speed in bps
+  SPI_PIN               cs;                 // Chip select pin, active low
+  uint16_t              cr1;                // Prepared CR1 value, set on first submit
+  uint32_t              clk_gen;            // Clock generation of prepared CR1 value
+} SPI_DEVICE;
+
+/* SPI Transaction segment */
+typedef struct _SPI_SEGMENT {
+  const void           *tx_buf;             // Data to send, NULL sends default value
+  void                 *rx_buf;             // Buffer for received data, NULL discards
+  uint32_t              num;                // Number of data items (1..65535)
+} SPI_SEGMENT;
+
+typedef struct _SPI_TRANSACTION SPI_TRANSACTION;
+
+typedef void (*SPI_TransactionEvent_t)(SPI_TRANSACTION *trans);
+
+/* SPI Transaction (queue entry, owned by the driver until done or aborted) */
+struct _SPI_TRANSACTION {
+  SPI_DEVICE           *dev;                // Target device
+  const SPI_SEGMENT    *seg;                // Segments sent with chip select held active
+  uint32_t              seg_num;            // Number of segments
+  SPI_TransactionEvent_t cb_event;          // Completion callback (optional, called from IRQ)
+  volatile uint32_t     status;             // Transaction status
+  SPI_TRANSACTION      *next;               // Next queued transaction
+};
+
 /* SPI Information (Run-Time) */
 typedef struct _SPI_INFO {
   ARM_SPI_SignalEvent_t cb_event;           // Event Callback
   SPI_STATUS            status;             // Status flags
   uint8_t               state;              // Current SPI state
   uint32_t              mode;               // Current SPI mode
+  SPI_TRANSACTION      *trans_head;         // Active transaction
+  SPI_TRANSACTION      *trans_tail;         // Last queued transaction
+  uint32_t              seg_idx;            // Active segment index
+  uint32_t              cr1;                // CR1 value restored when queue drains
+  uint32_t              clk_gen;            // Clock generation of bus speed table
+  uint32_t              br_freq[8];         // Bus speed for each baud rate prescaler
+  uint32_t              bus_speed;          // Requested master bus speed
+  RCC_ClockSubscriber_t clk_sub;            // Clock change subscriber
 } SPI_INFO;
 
 /* SPI Transfer Information (Run-Time) */
@@ -776,6 +826,34 @@ typedef struct _SPI_RESOURSES {
   uint8_t               reserved[3];        // Reserved
 } const SPI_RESOURCES;
 
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+#if defined(SPI1_TX_DMA_Stream) && defined(SPI1_RX_DMA_Stream)
+extern int32_t SPI1_TransactionSubmit(SPI_TRANSACTION *trans);
+#endif
+
+#if defined(SPI2_TX_DMA_Stream) && defined(SPI2_RX_DMA_Stream)
+extern int32_t SPI2_TransactionSubmit(SPI_TRANSACTION *trans);
+#endif
+
+#if defined(SPI3_TX_DMA_Stream) && defined(SPI3_RX_DMA_Stream)
+extern int32_t SPI3_TransactionSubmit(SPI_TRANSACTION *trans);
+#endif
+
+#if defined(SPI4_TX_DMA_Stream) && defined(SPI4_RX_DMA_Stream)
+extern int32_t SPI4_TransactionSubmit(SPI_TRANSACTION *trans);
+#endif
+
+#if defined(SPI5_TX_DMA_Stream) && defined(SPI5_RX_DMA_Stream)
+extern int32_t SPI5_TransactionSubmit(SPI_TRANSACTION *trans);
+#endif
+
+#if defined(SPI6_TX_DMA_Stream) && defined(SPI6_RX_DMA_Stream)
+extern int32_t SPI6_TransactionSubmit(SPI_TRANSACTION *trans);
+#endif
+
 #endif /* SPI_STM32F4XX_H_ */
 
 /* ----------------------------- End of file ---------------------------------*/
@@ -37,6 +37,90 @@
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
 
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+#ifdef USART1_TX_DMA_Stream
+static void USART1_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART1_RX_DMA_Stream
+static void USART1_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART2_TX_DMA_Stream
+static void USART2_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART2_RX_DMA_Stream
+static void USART2_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART3_TX_DMA_Stream
+static void USART3_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART3_RX_DMA_Stream
+static void USART3_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART4_TX_DMA_Stream
+static void UART4_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART4_RX_DMA_Stream
+static void UART4_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART5_TX_DMA_Stream
+static void UART5_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART5_RX_DMA_Stream
+static void UART5_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART6_TX_DMA_Stream
+static void USART6_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef USART6_RX_DMA_Stream
+static void USART6_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART7_TX_DMA_Stream
+static void UART7_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART7_RX_DMA_Stream
+static void UART7_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART8_TX_DMA_Stream
+static void UART8_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART8_RX_DMA_Stream
+static void UART8_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART9_TX_DMA_Stream
+static void UART9_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART9_RX_DMA_Stream
+static void UART9_RX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART10_TX_DMA_Stream
+static void UART10_TX_DMA_Complete(uint32_t event);
+#endif
+
+#ifdef UART10_RX_DMA_Stream
+static void UART10_RX_DMA_Complete(uint32_t event);
+#endif
+
 /*******************************************************************************
  *  global variable definitions (scope: module-local)
  ******************************************************************************/
@@ -106,6 +190,41 @@ static const USART_PIN USART1_cts = {
 };
 #endif
 
+#ifdef USART1_TX_DMA_Stream
+static DMA_Handle_t USART1_TX_DMA_Handle;
+static DMA_Resources_t USART1_TX_DMA = {
+  &USART1_TX_DMA_Handle,
+  USART1_TX_DMA_Stream,
+  USART1_TX_DMA_Channel,
+  USART1_TX_DMA_Priority,
+  USART1_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART1_TX_DMA_IRQn,
+  DMA_REQUEST_USART1_TX,
+};
+#endif
+
+#ifdef USART1_RX_DMA_Stream
+static DMA_Handle_t USART1_RX_DMA_Handle;
+static DMA_Resources_t USART1_RX_DMA = {
+  &USART1_RX_DMA_Handle,
+  USART1_RX_DMA_Stream,
+  USART1_RX_DMA_Channel,
+  USART1_RX_DMA_Priority,
+  USART1_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART1_RX_DMA_IRQn,
+  DMA_REQUEST_USART1_RX,
+};
+#endif
+
+#ifdef USART1_RX_FIFO_SIZE
+static uint8_t    USART1_RxFifoBuf[USART1_RX_FIFO_SIZE];
+static uint8_t    USART1_TxFifoBuf[USART1_TX_FIFO_SIZE];
+static USART_FIFO USART1_RxFifo = { USART1_RxFifoBuf, USART1_RX_FIFO_SIZE, 0U, 0U };
+static USART_FIFO USART1_TxFifo = { USART1_TxFifoBuf, USART1_TX_FIFO_SIZE, 0U, 0U };
+#endif
+
 // USART1 Resources
 static const USART_RESOURCES USART1_Resources = {
   {     // Capabilities
@@ -189,6 +308,23 @@ static const USART_RESOURCES USART1_Resources = {
 
   USART1_IRQn,
   RCC_PERIPH_USART1,
+#ifdef USART1_TX_DMA_Stream
+  &USART1_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef USART1_RX_DMA_Stream
+  &USART1_RX_DMA,
+#else
+  NULL,
+#endif
+#ifdef USART1_RX_FIFO_SIZE
+  &USART1_RxFifo,
+  &USART1_TxFifo,
+#else
+  NULL,
+  NULL,
+#endif
   &USART1_Info,
   &USART1_TransferInfo,
 };
@@ -241,6 +377,41 @@ static const USART_PIN USART2_cts = {
 };
 #endif
 
+#ifdef USART2_TX_DMA_Stream
+static DMA_Handle_t USART2_TX_DMA_Handle;
+static DMA_Resources_t USART2_TX_DMA = {
+  &USART2_TX_DMA_Handle,
+  USART2_TX_DMA_Stream,
+  USART2_TX_DMA_Channel,
+  USART2_TX_DMA_Priority,
+  USART2_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART2_TX_DMA_IRQn,
+  DMA_REQUEST_USART2_TX,
+};
+#endif
+
+#ifdef USART2_RX_DMA_Stream
+static DMA_Handle_t USART2_RX_DMA_Handle;
+static DMA_Resources_t USART2_RX_DMA = {
+  &USART2_RX_DMA_Handle,
+  USART2_RX_DMA_Stream,
+  USART2_RX_DMA_Channel,
+  USART2_RX_DMA_Priority,
+  USART2_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART2_RX_DMA_IRQn,
+  DMA_REQUEST_USART2_RX,
+};
+#endif
+
+#ifdef USART2_RX_FIFO_SIZE
+static uint8_t    USART2_RxFifoBuf[USART2_RX_FIFO_SIZE];
+static uint8_t    USART2_TxFifoBuf[USART2_TX_FIFO_SIZE];
+static USART_FIFO USART2_RxFifo = { USART2_RxFifoBuf, USART2_RX_FIFO_SIZE, 0U, 0U };
+static USART_FIFO USART2_TxFifo = { USART2_TxFifoBuf, USART2_TX_FIFO_SIZE, 0U, 0U };
+#endif
+
 // USART2 Resources
 static const USART_RESOURCES USART2_Resources = {
   {     // Capabilities
@@ -324,6 +495,23 @@ static const USART_RESOURCES USART2_Resources = {
 
   USART2_IRQn,
   RCC_PERIPH_USART2,
+#ifdef USART2_TX_DMA_Stream
+  &USART2_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef USART2_RX_DMA_Stream
+  &USART2_RX_DMA,
+#else
+  NULL,
+#endif
+#ifdef USART2_RX_FIFO_SIZE
+  &USART2_RxFifo,
+  &USART2_TxFifo,
+#else
+  NULL,
+  NULL,
+#endif
   &USART2_Info,
   &USART2_TransferInfo,
 };
@@ -376,6 +564,41 @@ static const USART_PIN USART3_cts = {
 };
 #endif
 
+#ifdef USART3_TX_DMA_Stream
+static DMA_Handle_t USART3_TX_DMA_Handle;
+static DMA_Resources_t USART3_TX_DMA = {
+  &USART3_TX_DMA_Handle,
+  USART3_TX_DMA_Stream,
+  USART3_TX_DMA_Channel,
+  USART3_TX_DMA_Priority,
+  USART3_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART3_TX_DMA_IRQn,
+  DMA_REQUEST_USART3_TX,
+};
+#endif
+
+#ifdef USART3_RX_DMA_Stream
+static DMA_Handle_t USART3_RX_DMA_Handle;
+static DMA_Resources_t USART3_RX_DMA = {
+  &USART3_RX_DMA_Handle,
+  USART3_RX_DMA_Stream,
+  USART3_RX_DMA_Channel,
+  USART3_RX_DMA_Priority,
+  USART3_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART3_RX_DMA_IRQn,
+  DMA_REQUEST_USART3_RX,
+};
+#endif
+
+#ifdef USART3_RX_FIFO_SIZE
+static uint8_t    USART3_RxFifoBuf[USART3_RX_FIFO_SIZE];
+static uint8_t    USART3_TxFifoBuf[USART3_TX_FIFO_SIZE];
+static USART_FIFO USART3_RxFifo = { USART3_RxFifoBuf, USART3_RX_FIFO_SIZE, 0U, 0U };
+static USART_FIFO USART3_TxFifo = { USART3_TxFifoBuf, USART3_TX_FIFO_SIZE, 0U, 0U };
+#endif
+
 // USART3 Resources
 static const USART_RESOURCES USART3_Resources = {
   {     // Capabilities
@@ -459,6 +682,23 @@ static const USART_RESOURCES USART3_Resources = {
 
   USART3_IRQn,
   RCC_PERIPH_USART3,
+#ifdef USART3_TX_DMA_Stream
+  &USART3_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef USART3_RX_DMA_Stream
+  &USART3_RX_DMA,
+#else
+  NULL,
+#endif
+#ifdef USART3_RX_FIFO_SIZE
+  &USART3_RxFifo,
+  &USART3_TxFifo,
+#else
+  NULL,
+  NULL,
+#endif
   &USART3_Info,
   &USART3_TransferInfo,
 };
@@ -487,6 +727,41 @@ static const USART_PIN UART4_rx = {
 };
 #endif
 
+#ifdef UART4_TX_DMA_Stream
+static DMA_Handle_t UART4_TX_DMA_Handle;
+static DMA_Resources_t UART4_TX_DMA = {
+  &UART4_TX_DMA_Handle,
+  UART4_TX_DMA_Stream,
+  UART4_TX_DMA_Channel,
+  UART4_TX_DMA_Priority,
+  UART4_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART4_TX_DMA_IRQn,
+  DMA_REQUEST_UART4_TX,
+};
+#endif
+
+#ifdef UART4_RX_DMA_Stream
+static DMA_Handle_t UART4_RX_DMA_Handle;
+static DMA_Resources_t UART4_RX_DMA = {
+  &UART4_RX_DMA_Handle,
+  UART4_RX_DMA_Stream,
+  UART4_RX_DMA_Channel,
+  UART4_RX_DMA_Priority,
+  UART4_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART4_RX_DMA_IRQn,
+  DMA_REQUEST_UART4_RX,
+};
+#endif
+
+#ifdef UART4_RX_FIFO_SIZE
+static uint8_t    UART4_RxFifoBuf[UART4_RX_FIFO_SIZE];
+static uint8_t    UART4_TxFifoBuf[UART4_TX_FIFO_SIZE];
+static USART_FIFO UART4_RxFifo = { UART4_RxFifoBuf, UART4_RX_FIFO_SIZE, 0U, 0U };
+static USART_FIFO UART4_TxFifo = { UART4_TxFifoBuf, UART4_TX_FIFO_SIZE, 0U, 0U };
+#endif
+
 // UART4 Resources
 static const USART_RESOURCES USART4_Resources = {
   {     // Capabilities
@@ -534,6 +809,23 @@ static const USART_RESOURCES USART4_Resources = {
 
   UART4_IRQn,
   RCC_PERIPH_UART4,
+#ifdef UART4_TX_DMA_Stream
+  &UART4_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART4_RX_DMA_Stream
+  &UART4_RX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART4_RX_FIFO_SIZE
+  &UART4_RxFifo,
+  &UART4_TxFifo,
+#else
+  NULL,
+  NULL,
+#endif
   &UART4_Info,
   &UART4_TransferInfo
 };
@@ -562,6 +854,41 @@ static const USART_PIN UART5_rx = {
 };
 #endif
 
+#ifdef UART5_TX_DMA_Stream
+static DMA_Handle_t UART5_TX_DMA_Handle;
+static DMA_Resources_t UART5_TX_DMA = {
+  &UART5_TX_DMA_Handle,
+  UART5_TX_DMA_Stream,
+  UART5_TX_DMA_Channel,
+  UART5_TX_DMA_Priority,
+  UART5_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART5_TX_DMA_IRQn,
+  DMA_REQUEST_UART5_TX,
+};
+#endif
+
+#ifdef UART5_RX_DMA_Stream
+static DMA_Handle_t UART5_RX_DMA_Handle;
+static DMA_Resources_t UART5_RX_DMA = {
+  &UART5_RX_DMA_Handle,
+  UART5_RX_DMA_Stream,
+  UART5_RX_DMA_Channel,
+  UART5_RX_DMA_Priority,
+  UART5_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART5_RX_DMA_IRQn,
+  DMA_REQUEST_UART5_RX,
+};
+#endif
+
+#ifdef UART5_RX_FIFO_SIZE
+static uint8_t    UART5_RxFifoBuf[UART5_RX_FIFO_SIZE];
+static uint8_t    UART5_TxFifoBuf[UART5_TX_FIFO_SIZE];
+static USART_FIFO UART5_RxFifo = { UART5_RxFifoBuf, UART5_RX_FIFO_SIZE, 0U, 0U };
+static USART_FIFO UART5_TxFifo = { UART5_TxFifoBuf, UART5_TX_FIFO_SIZE, 0U, 0U };
+#endif
+
 // UART5 Resources
 static const USART_RESOURCES USART5_Resources = {
   {     // Capabilities
@@ -609,6 +936,23 @@ static const USART_RESOURCES USART5_Resources = {
 
   UART5_IRQn,
   RCC_PERIPH_UART5,
+#ifdef UART5_TX_DMA_Stream
+  &UART5_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART5_RX_DMA_Stream
+  &UART5_RX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART5_RX_FIFO_SIZE
+  &UART5_RxFifo,
+  &UART5_TxFifo,
+#else
+  NULL,
+  NULL,
+#endif
   &UART5_Info,
   &UART5_TransferInfo
 };
@@ -661,6 +1005,41 @@ static const USART_PIN USART6_cts = {
 };
 #endif
 
+#ifdef USART6_TX_DMA_Stream
+static DMA_Handle_t USART6_TX_DMA_Handle;
+static DMA_Resources_t USART6_TX_DMA = {
+  &USART6_TX_DMA_Handle,
+  USART6_TX_DMA_Stream,
+  USART6_TX_DMA_Channel,
+  USART6_TX_DMA_Priority,
+  USART6_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART6_TX_DMA_IRQn,
+  DMA_REQUEST_USART6_TX,
+};
+#endif
+
+#ifdef USART6_RX_DMA_Stream
+static DMA_Handle_t USART6_RX_DMA_Handle;
+static DMA_Resources_t USART6_RX_DMA = {
+  &USART6_RX_DMA_Handle,
+  USART6_RX_DMA_Stream,
+  USART6_RX_DMA_Channel,
+  USART6_RX_DMA_Priority,
+  USART6_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  USART6_RX_DMA_IRQn,
+  DMA_REQUEST_USART6_RX,
+};
+#endif
+
+#ifdef USART6_RX_FIFO_SIZE
+static uint8_t    USART6_RxFifoBuf[USART6_RX_FIFO_SIZE];
+static uint8_t    USART6_TxFifoBuf[USART6_TX_FIFO_SIZE];
+static USART_FIFO USART6_RxFifo = { USART6_RxFifoBuf, USART6_RX_FIFO_SIZE, 0U, 0U };
+static USART_FIFO USART6_TxFifo = { USART6_TxFifoBuf, USART6_TX_FIFO_SIZE, 0U, 0U };
+#endif
+
 // USART6 Resources
 static const USART_RESOURCES USART6_Resources = {
   {     // Capabilities
@@ -744,6 +1123,23 @@ static const USART_RESOURCES USART6_Resources = {
 
   USART6_IRQn,
   RCC_PERIPH_USART6,
+#ifdef USART6_TX_DMA_Stream
+  &USART6_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef USART6_RX_DMA_Stream
+  &USART6_RX_DMA,
+#else
+  NULL,
+#endif
+#ifdef USART6_RX_FIFO_SIZE
+  &USART6_RxFifo,
+  &USART6_TxFifo,
+#else
+  NULL,
+  NULL,
+#endif
   &USART6_Info,
   &USART6_TransferInfo
 };
@@ -772,6 +1168,41 @@ static const USART_PIN UART7_rx = {
 };
 #endif
 
+#ifdef UART7_TX_DMA_Stream
+static DMA_Handle_t UART7_TX_DMA_Handle;
+static DMA_Resources_t UART7_TX_DMA = {
+  &UART7_TX_DMA_Handle,
+  UART7_TX_DMA_Stream,
+  UART7_TX_DMA_Channel,
+  UART7_TX_DMA_Priority,
+  UART7_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART7_TX_DMA_IRQn,
+  DMA_REQUEST_UART7_TX,
+};
+#endif
+
+#ifdef UART7_RX_DMA_Stream
+static DMA_Handle_t UART7_RX_DMA_Handle;
+static DMA_Resources_t UART7_RX_DMA = {
+  &UART7_RX_DMA_Handle,
+  UART7_RX_DMA_Stream,
+  UART7_RX_DMA_Channel,
+  UART7_RX_DMA_Priority,
+  UART7_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART7_RX_DMA_IRQn,
+  DMA_REQUEST_UART7_RX,
+};
+#endif
+
+#ifdef UART7_RX_FIFO_SIZE
+static uint8_t    UART7_RxFifoBuf[UART7_RX_FIFO_SIZE];
+static uint8_t    UART7_TxFifoBuf[UART7_TX_FIFO_SIZE];
+static USART_FIFO UART7_RxFifo = { UART7_RxFifoBuf, UART7_RX_FIFO_SIZE, 0U, 0U };
+static USART_FIFO UART7_TxFifo = { UART7_TxFifoBuf, UART7_TX_FIFO_SIZE, 0U, 0U };
+#endif
+
 // UART7 Resources
 static const USART_RESOURCES USART7_Resources = {
   {     // Capabilities
@@ -819,6 +1250,23 @@ static const USART_RESOURCES USART7_Resources = {
 
   UART7_IRQn,
   RCC_PERIPH_UART7,
+#ifdef UART7_TX_DMA_Stream
+  &UART7_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART7_RX_DMA_Stream
+  &UART7_RX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART7_RX_FIFO_SIZE
+  &UART7_RxFifo,
+  &UART7_TxFifo,
+#else
+  NULL,
+  NULL,
+#endif
   &UART7_Info,
   &UART7_TransferInfo,
 };
@@ -847,6 +1295,41 @@ static const USART_PIN UART8_rx = {
 };
 #endif
 
+#ifdef UART8_TX_DMA_Stream
+static DMA_Handle_t UART8_TX_DMA_Handle;
+static DMA_Resources_t UART8_TX_DMA = {
+  &UART8_TX_DMA_Handle,
+  UART8_TX_DMA_Stream,
+  UART8_TX_DMA_Channel,
+  UART8_TX_DMA_Priority,
+  UART8_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART8_TX_DMA_IRQn,
+  DMA_REQUEST_UART8_TX,
+};
+#endif
+
+#ifdef UART8_RX_DMA_Stream
+static DMA_Handle_t UART8_RX_DMA_Handle;
+static DMA_Resources_t UART8_RX_DMA = {
+  &UART8_RX_DMA_Handle,
+  UART8_RX_DMA_Stream,
+  UART8_RX_DMA_Channel,
+  UART8_RX_DMA_Priority,
+  UART8_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART8_RX_DMA_IRQn,
+  DMA_REQUEST_UART8_RX,
+};
+#endif
+
+#ifdef UART8_RX_FIFO_SIZE
+static uint8_t    UART8_RxFifoBuf[UART8_RX_FIFO_SIZE];
+static uint8_t    UART8_TxFifoBuf[UART8_TX_FIFO_SIZE];
+static USART_FIFO UART8_RxFifo = { UART8_RxFifoBuf, UART8_RX_FIFO_SIZE, 0U, 0U };
+static USART_FIFO UART8_TxFifo = { UART8_TxFifoBuf, UART8_TX_FIFO_SIZE, 0U, 0U };
+#endif
+
 // UART8 Resources
 static const USART_RESOURCES USART8_Resources = {
   {     // Capabilities
@@ -894,6 +1377,23 @@ static const USART_RESOURCES USART8_Resources = {
 
   UART8_IRQn,
   RCC_PERIPH_UART8,
+#ifdef UART8_TX_DMA_Stream
+  &UART8_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART8_RX_DMA_Stream
+  &UART8_RX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART8_RX_FIFO_SIZE
+  &UART8_RxFifo,
+  &UART8_TxFifo,
+#else
+  NULL,
+  NULL,
+#endif
   &UART8_Info,
   &UART8_TransferInfo,
 };
@@ -922,6 +1422,41 @@ static const USART_PIN UART9_rx = {
 };
 #endif
 
+#ifdef UART9_TX_DMA_Stream
+static DMA_Handle_t UART9_TX_DMA_Handle;
+static DMA_Resources_t UART9_TX_DMA = {
+  &UART9_TX_DMA_Handle,
+  UART9_TX_DMA_Stream,
+  UART9_TX_DMA_Channel,
+  UART9_TX_DMA_Priority,
+  UART9_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART9_TX_DMA_IRQn,
+  DMA_REQUEST_NONE,
+};
+#endif
+
+#ifdef UART9_RX_DMA_Stream
+static DMA_Handle_t UART9_RX_DMA_Handle;
+static DMA_Resources_t UART9_RX_DMA = {
+  &UART9_RX_DMA_Handle,
+  UART9_RX_DMA_Stream,
+  UART9_RX_DMA_Channel,
+  UART9_RX_DMA_Priority,
+  UART9_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART9_RX_DMA_IRQn,
+  DMA_REQUEST_NONE,
+};
+#endif
+
+#ifdef UART9_RX_FIFO_SIZE
+static uint8_t    UART9_RxFifoBuf[UART9_RX_FIFO_SIZE];
+static uint8_t    UART9_TxFifoBuf[UART9_TX_FIFO_SIZE];
+static USART_FIFO UART9_RxFifo = { UART9_RxFifoBuf, UART9_RX_FIFO_SIZE, 0U, 0U };
+static USART_FIFO UART9_TxFifo = { UART9_TxFifoBuf, UART9_TX_FIFO_SIZE, 0U, 0U };
+#endif
+
 // UART9 Resources
 static const USART_RESOURCES USART9_Resources = {
   {     // Capabilities
@@ -969,6 +1504,23 @@ static const USART_RESOURCES USART9_Resources = {
 
   UART9_IRQn,
   RCC_PERIPH_UART9,
+#ifdef UART9_TX_DMA_Stream
+  &UART9_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART9_RX_DMA_Stream
+  &UART9_RX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART9_RX_FIFO_SIZE
+  &UART9_RxFifo,
+  &UART9_TxFifo,
+#else
+  NULL,
+  NULL,
+#endif
   &UART9_Info,
   &UART9_TransferInfo
 };
@@ -997,6 +1549,41 @@ static const USART_PIN UART10_rx = {
 };
 #endif
 
+#ifdef UART10_TX_DMA_Stream
+static DMA_Handle_t UART10_TX_DMA_Handle;
+static DMA_Resources_t UART10_TX_DMA = {
+  &UART10_TX_DMA_Handle,
+  UART10_TX_DMA_Stream,
+  UART10_TX_DMA_Channel,
+  UART10_TX_DMA_Priority,
+  UART10_TX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART10_TX_DMA_IRQn,
+  DMA_REQUEST_NONE,
+};
+#endif
+
+#ifdef UART10_RX_DMA_Stream
+static DMA_Handle_t UART10_RX_DMA_Handle;
+static DMA_Resources_t UART10_RX_DMA = {
+  &UART10_RX_DMA_Handle,
+  UART10_RX_DMA_Stream,
+  UART10_RX_DMA_Channel,
+  UART10_RX_DMA_Priority,
+  UART10_RX_DMA_Complete,
+  RTE_USART_DMA_INT_PRIORITY,
+  UART10_RX_DMA_IRQn,
+  DMA_REQUEST_NONE,
+};
+#endif
+
+#ifdef UART10_RX_FIFO_SIZE
+static uint8_t    UART10_RxFifoBuf[UART10_RX_FIFO_SIZE];
+static uint8_t    UART10_TxFifoBuf[UART10_TX_FIFO_SIZE];
+static USART_FIFO UART10_RxFifo = { UART10_RxFifoBuf, UART10_RX_FIFO_SIZE, 0U, 0U };
+static USART_FIFO UART10_TxFifo = { UART10_TxFifoBuf, UART10_TX_FIFO_SIZE, 0U, 0U };
+#endif
+
 // UART10 Resources
 static const USART_RESOURCES USART10_Resources = {
   {     // Capabilities
@@ -1044,6 +1631,23 @@ static const USART_RESOURCES USART10_Resources = {
 
   UART10_IRQn,
   RCC_PERIPH_UART10,
+#ifdef UART10_TX_DMA_Stream
+  &UART10_TX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART10_RX_DMA_Stream
+  &UART10_RX_DMA,
+#else
+  NULL,
+#endif
+#ifdef UART10_RX_FIFO_SIZE
+  &UART10_RxFifo,
+  &UART10_TxFifo,
+#else
+  NULL,
+  NULL,
+#endif
   &UART10_Info,
   &UART10_TransferInfo
 };
@@ -1056,10 +1660,100 @@ static const USART_RESOURCES USART10_Resources = {
 static
 int32_t USART_Receive(void *data, uint32_t num, USART_RESOURCES *usart);
 
+#ifdef USART_DMA_TX
+static
+void USART_TX_DMA_Complete(uint32_t event, USART_RESOURCES *usart);
+#endif
+
+#ifdef USART_DMA_RX
+static
+void USART_RX_DMA_Complete(uint32_t event, USART_RESOURCES *usart);
+#endif
+
 /*******************************************************************************
  *  function implementations (scope: module-local)
  ******************************************************************************/
 
+#ifdef USART_BUFFERED
+/**
+  \fn          uint32_t USART_FifoCount(USART_FIFO *fifo)
+  \brief       Get number of bytes stored in FIFO.
+  \param[in]   fifo  Pointer to FIFO
+  \return      number of bytes stored
+*/
+__STATIC_INLINE
+uint32_t USART_FifoCount(USART_FIFO *fifo)
+{
+  return (fifo->head - fifo->tail);
+}
+
+/**
+  \fn          uint32_t USART_FifoPut(USART_FIFO *fifo, const uint8_t *data, uint32_t num)
+  \brief       Copy data into FIFO. Called by the producer only.
+  \param[in]   fifo  Pointer to FIFO
+  \param[in]   data  Pointer to data to store
+  \param[in]   num   Number of bytes to store
+  \return      number of bytes stored
+*/
+static
+uint32_t USART_FifoPut(USART_FIFO *fifo, const uint8_t *data, uint32_t num)
+{
+  uint32_t head = fifo->head;
+  uint32_t idx, n;
+
+  n = fifo->size - (head - fifo->tail);
+  if (num > n)
+    num = n;
+
+  idx = head & (fifo->size - 1U);
+  n = fifo->size - idx;
+  if (n > num)
+    n = num;
+
+  memcpy(&fifo->buf[idx], data, n);
+  memcpy(&fifo->buf[0], &data[n], num - n);
+
+  // Data must be visible before the write index moves
+  __DMB();
+  fifo->head = head + num;
+
+  return num;
+}
+
+/**
+  \fn          uint32_t USART_FifoGet(USART_FIFO *fifo, uint8_t *data, uint32_t num)
+  \brief       Copy data out of FIFO. Called by the consumer only.
+  \param[out]  data  Pointer to buffer for data
+  \param[in]   fifo  Pointer to FIFO
+  \param[in]   num   Number of bytes to fetch
+  \return      number of bytes fetched
+*/
+static
+uint32_t USART_FifoGet(USART_FIFO *fifo, uint8_t *data, uint32_t num)
+{
+  uint32_t tail = fifo->tail;
+  uint32_t idx, n;
+
+  n = fifo->head - tail;
+  if (num > n)
+    num = n;
+
+  idx = tail & (fifo->size - 1U);
+  n = fifo->size - idx;
+  if (n > num)
+    n = num;
+
+  memcpy(data, &fifo->buf[idx], n);
+  memcpy(&data[n], &fifo->buf[0], num - n);
+
+  // Data must be copied out before the slots are released
+  __DMB();
+  fifo->tail = tail + num;
+
+  return num;
+}
+#endif
+
 /**
   \fn          ARM_DRIVER_VERSION USARTx_GetVersion (void)
   \brief       Get driver version.
@@ -1176,6 +1870,25 @@ int32_t USART_Uninitialize(USART_RESOURCES *usart)
   return ARM_DRIVER_OK;
 }
 
+/**
+  \fn          void USART_ClockEvent(uint32_t event, void *arg)
+  \brief       Recompute baud rate divider after a clock tree change.
+  \param[in]   event  \ref RCC_CLOCK_EVENT_CHANGED
+  \param[in]   arg    Pointer to USART resources
+*/
+static
+void USART_ClockEvent(uint32_t event, void *arg)
+{
+  USART_RESOURCES *usart = (USART_RESOURCES *)arg;
+  USART_INFO *info = usart->info;
+
+  if ((event & RCC_CLOCK_EVENT_CHANGED) == 0U)
+    return;
+
+  if (((info->flags & USART_FLAG_CONFIGURED) != 0U) && (info->baudrate != 0U))
+    usart->reg->BRR = USART_BAUDRATE_DIVIDER(RCC_GetPeriphFreq(usart->rcc), info->baudrate);
+}
+
 /**
   \fn          int32_t USART_PowerControl(ARM_POWER_STATE state, USART_RESOURCES *usart)
   \brief       Control USART Interface Power.
@@ -1197,9 +1910,28 @@ int32_t USART_PowerControl(ARM_POWER_STATE state, USART_RESOURCES *usart)
       /* Disable IRQ */
       NVIC_DisableIRQ(usart->irq_num);
 
+      // Uninitialize DMA
+#ifdef USART_DMA_TX
+      if (usart->tx_dma != NULL)
+        DMA_Uninitialize(usart->tx_dma);
+#endif
+#ifdef USART_DMA_RX
+      if (usart->rx_dma != NULL)
+        DMA_Uninitialize(usart->rx_dma);
+#endif
+
       // Disable USART clock
       RCC_DisablePeriph(usart->rcc);
 
+      // Stop following clock changes
+      RCC_ClockUnsubscribe(&info->clk_sub);
+
+      // Release performance locks of active transfers
+      if (xfer->send_active)
+        DFS_UNLOCK();
+      if (info->status.rx_busy)
+        DFS_UNLOCK();
+
       // Clear Status flags
       info->status.tx_busy          = 0U;
       info->status.rx_busy          = 0U;
@@ -1210,6 +1942,14 @@ int32_t USART_PowerControl(ARM_POWER_STATE state, USART_RESOURCES *usart)
       info->status.rx_parity_error  = 0U;
       xfer->send_active             = 0U;
 
+#ifdef USART_BUFFERED
+      // Flush software FIFOs
+      if (usart->rx_fifo != NULL) {
+        usart->rx_fifo->head = usart->rx_fifo->tail = 0U;
+        usart->tx_fifo->head = usart->tx_fifo->tail = 0U;
+      }
+#endif
+
       info->flags &= ~USART_FLAG_POWERED;
       break;
 
@@ -1238,19 +1978,70 @@ int32_t USART_PowerControl(ARM_POWER_STATE state, USART_RESOURCES *usart)
       xfer->def_val                 = 0U;
       xfer->sync_mode               = 0U;
       xfer->break_flag              = 0U;
+      xfer->rx_circular             = 0U;
       info->mode                    = 0U;
       info->flow_control            = 0U;
+      info->baudrate                = 0U;
+
+#ifdef USART_BUFFERED
+      // Flush software FIFOs
+      if (usart->rx_fifo != NULL) {
+        usart->rx_fifo->head = usart->rx_fifo->tail = 0U;
+        usart->tx_fifo->head = usart->tx_fifo->tail = 0U;
+      }
+#endif
 
       info->flags = USART_FLAG_POWERED | USART_FLAG_INITIALIZED;
 
       // Enable USART clock
       RCC_EnablePeriph(usart->rcc);
 
+      // Keep baud rate across clock changes
+      info->clk_sub.cb_event = USART_ClockEvent;
+      info->clk_sub.arg      = (void *)((uint32_t)usart);
+      RCC_ClockSubscribe(&info->clk_sub);
+
       // Clear and Enable USART IRQ
       NVIC_ClearPendingIRQ(usart->irq_num);
       NVIC_SetPriority(usart->irq_num, RTE_USART_INT_PRIORITY);
       NVIC_EnableIRQ(usart->irq_num);
 
+      // Initialize DMA
+#ifdef USART_DMA_TX
+      if (usart->tx_dma != NULL) {
+        DMA_StreamConfig_t *cfg = &usart->tx_dma->handle->config;
+
+        cfg->Direction = DMA_DIR_MEM_TO_PER;
+        cfg->PerInc    = DMA_PINC_DISABLE;
+        cfg->Mode      = DMA_MODE_NORMAL;
+        cfg->FIFOMode  = DMA_FIFOMODE_DISABLE;
+        cfg->MemBurst  = DMA_MBURST_SINGLE;
+        cfg->PerBurst  = DMA_PBURST_SINGLE;
+
+        if (DMA_Initialize(usart->tx_dma) != ARM_DRIVER_OK) {
+          USART_PowerControl(ARM_POWER_OFF, usart);
+          return ARM_DRIVER_ERROR;
+        }
+      }
+#endif
+#ifdef USART_DMA_RX
+      if (usart->rx_dma != NULL) {
+        DMA_StreamConfig_t *cfg = &usart->rx_dma->handle->config;
+
+        cfg->Direction = DMA_DIR_PER_TO_MEM;
+        cfg->PerInc    = DMA_PINC_DISABLE;
+        cfg->Mode      = DMA_MODE_NORMAL;
+        cfg->FIFOMode  = DMA_FIFOMODE_DISABLE;
+        cfg->MemBurst  = DMA_MBURST_SINGLE;
+        cfg->PerBurst  = DMA_PBURST_SINGLE;
+
+        if (DMA_Initialize(usart->rx_dma) != ARM_DRIVER_OK) {
+          USART_PowerControl(ARM_POWER_OFF, usart);
+          return ARM_DRIVER_ERROR;
+        }
+      }
+#endif
+
       // USART peripheral reset
       RCC_ResetPeriph(usart->rcc);
 
@@ -1290,6 +2081,16 @@ int32_t USART_Send(const void *data, uint32_t num, USART_RESOURCES *usart)
     return ARM_DRIVER_ERROR_BUSY;
   }
 
+#ifdef USART_BUFFERED
+  if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U)) {
+    // Data queued by Write is not transmitted yet
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+#endif
+
+  // Hold performance lock until the data is sent
+  DFS_LOCK();
+
   // Set Send active flag
   xfer->send_active = 1U;
 
@@ -1303,13 +2104,52 @@ int32_t USART_Send(const void *data, uint32_t num, USART_RESOURCES *usart)
     if (xfer->sync_mode == 0U) {
       xfer->sync_mode = USART_SYNC_MODE_TX;
       // Start dummy reads
-      if (USART_Receive(&xfer->dump_val, num, usart) == ARM_DRIVER_ERROR_BUSY)
+      if (USART_Receive(&xfer->dump_val, num, usart) == ARM_DRIVER_ERROR_BUSY) {
+        // Receiver is busy, nothing started yet
+        xfer->sync_mode   = 0U;
+        xfer->send_active = 0U;
+        DFS_UNLOCK();
         return ARM_DRIVER_ERROR_BUSY;
+      }
     }
   }
 
-  // TXE interrupt enable
-  usart->reg->CR1 |= USART_CR1_TXEIE;
+#ifdef USART_DMA_TX
+  // DMA mode
+  if (usart->tx_dma != NULL) {
+    DMA_StreamConfig_t *cfg = &usart->tx_dma->handle->config;
+
+    // Dummy writes in synchronous receive only mode
+    if (data == &xfer->def_val)
+      cfg->MemInc = DMA_MINC_DISABLE;
+    else
+      cfg->MemInc = DMA_MINC_ENABLE;
+
+    if (((usart->reg->CR1 & USART_CR1_PCE) == 0U) && ((usart->reg->CR1 & USART_CR1_M) != 0U)) {
+      // 9-bit data frame
+      cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
+      cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
+    }
+    else {
+      // 8-bit data frame
+      cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+      cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+    }
+
+    // Initialize and start DMA Stream
+    DMA_StreamConfig(usart->tx_dma);
+    DMA_StreamEnable(usart->tx_dma, (uint32_t)&usart->reg->DR, (uint32_t)data, num);
+
+    // Clear TC flag and enable DMA transmitter
+    usart->reg->SR = ~USART_SR_TC;
+    usart->reg->CR3 |= USART_CR3_DMAT;
+  }
+  else
+#endif
+  {
+    // TXE interrupt enable
+    usart->reg->CR1 |= USART_CR1_TXEIE;
+  }
 
   return ARM_DRIVER_OK;
 }
@@ -1359,19 +2199,99 @@ int32_t USART_Receive(void *data, uint32_t num, USART_RESOURCES *usart)
   xfer->rx_buf = (uint8_t *)data;
   xfer->rx_cnt =  0U;
 
+#ifdef USART_BUFFERED
+  // Hand over data already collected in the receive FIFO
+  if ((usart->rx_fifo != NULL) && (xfer->rx_circular == 0U) &&
+      (info->mode != ARM_USART_MODE_SYNCHRONOUS_MASTER)) {
+    uint32_t val = usart->reg->CR1;
+    uint32_t sz  = (((val & USART_CR1_PCE) == 0U) && ((val & USART_CR1_M) != 0U)) ? 2U : 1U;
+    uint32_t cnt = USART_FifoCount(usart->rx_fifo) / sz;
+
+    if (cnt > num)
+      cnt = num;
+
+    USART_FifoGet(usart->rx_fifo, xfer->rx_buf, cnt * sz);
+    xfer->rx_buf += cnt * sz;
+    xfer->rx_cnt  = cnt;
+
+    if (cnt == num) {
+      // Request completely served from FIFO
+      usart->reg->CR1 |= USART_CR1_RXNEIE;
+      if (info->cb_event != NULL)
+        info->cb_event(ARM_USART_EVENT_RECEIVE_COMPLETE);
+      return ARM_DRIVER_OK;
+    }
+  }
+#endif
+
+  // Hold performance lock until the data is received
+  DFS_LOCK();
+
   // Set RX busy flag
   info->status.rx_busy = 1U;
 
-  // Enable RXNE and IDLE interrupt
-  usart->reg->CR1 |= (USART_CR1_IDLEIE | USART_CR1_RXNEIE);
+#ifdef USART_DMA_RX
+  // DMA mode
+  if (usart->rx_dma != NULL) {
+    DMA_StreamConfig_t *cfg = &usart->rx_dma->handle->config;
+
+    // Dummy reads in synchronous transmit only mode
+    if (data == &xfer->dump_val)
+      cfg->MemInc = DMA_MINC_DISABLE;
+    else
+      cfg->MemInc = DMA_MINC_ENABLE;
+
+    // Continuous reception into ring buffer
+    if (xfer->rx_circular != 0U)
+      cfg->Mode = DMA_MODE_CIRCULAR;
+    else
+      cfg->Mode = DMA_MODE_NORMAL;
+
+    if (((usart->reg->CR1 & USART_CR1_PCE) == 0U) && ((usart->reg->CR1 & USART_CR1_M) != 0U)) {
+      // 9-bit data frame
+      cfg->MemDataAlign = DMA_MDATAALIGN_HALFWORD;
+      cfg->PerDataAlign = DMA_PDATAALIGN_HALFWORD;
+    }
+    else {
+      // 8-bit data frame
+      cfg->MemDataAlign = DMA_MDATAALIGN_BYTE;
+      cfg->PerDataAlign = DMA_PDATAALIGN_BYTE;
+    }
+
+    // Initialize and start DMA Stream
+    DMA_StreamConfig(usart->rx_dma);
+    DMA_StreamEnable(usart->rx_dma, (uint32_t)&usart->reg->DR, (uint32_t)xfer->rx_buf, num - xfer->rx_cnt);
+
+    // Enable IDLE interrupt and DMA receiver
+    usart->reg->CR1 |= USART_CR1_IDLEIE;
+    usart->reg->CR3 |= USART_CR3_DMAR;
+  }
+  else
+#endif
+  {
+    // Enable RXNE and IDLE interrupt
+    usart->reg->CR1 |= (USART_CR1_IDLEIE | USART_CR1_RXNEIE);
+  }
 
   // Synchronous mode
   if (info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) {
     if (xfer->sync_mode == 0U) {
       xfer->sync_mode = USART_SYNC_MODE_RX;
       // Send dummy data
-      if (USART_Send(&xfer->def_val, num, usart) == ARM_DRIVER_ERROR_BUSY)
+      if (USART_Send(&xfer->def_val, num, usart) == ARM_DRIVER_ERROR_BUSY) {
+        // Transmitter is busy, stop the receiver armed above
+        usart->reg->CR1 &= ~(USART_CR1_IDLEIE | USART_CR1_RXNEIE);
+#ifdef USART_DMA_RX
+        if (usart->reg->CR3 & USART_CR3_DMAR) {
+          usart->reg->CR3 &= ~USART_CR3_DMAR;
+          DMA_StreamDisable(usart->rx_dma);
+        }
+#endif
+        xfer->sync_mode      = 0U;
+        info->status.rx_busy = 0U;
+        DFS_UNLOCK();
         return ARM_DRIVER_ERROR_BUSY;
+      }
     }
   }
 
@@ -1431,6 +2351,11 @@ int32_t USART_Transfer(const void *data_out, void *data_in, uint32_t num, USART_
 static
 uint32_t USART_GetTxCount(USART_RESOURCES *usart)
 {
+#ifdef USART_DMA_TX
+  if ((usart->tx_dma != NULL) && (usart->reg->CR3 & USART_CR3_DMAT))
+    return (usart->xfer->tx_num - DMA_StreamGetCount(usart->tx_dma));
+#endif
+
   return usart->xfer->tx_cnt;
 }
 
@@ -1438,11 +2363,17 @@ uint32_t USART_GetTxCount(USART_RESOURCES *usart)
   \fn          uint32_t USART_GetRxCount(USART_RESOURCES *usart)
   \brief       Get received data count.
   \param[in]   usart     Pointer to USART resources
-  \return      number of data items received
+  \return      number of data items received, or the ring write index
+               when circular DMA receive is active
 */
 static
 uint32_t USART_GetRxCount(USART_RESOURCES *usart)
 {
+#ifdef USART_DMA_RX
+  if ((usart->rx_dma != NULL) && (usart->reg->CR3 & USART_CR3_DMAR))
+    return (usart->xfer->rx_num - DMA_StreamGetCount(usart->rx_dma));
+#endif
+
   return usart->xfer->rx_cnt;
 }
 
@@ -1478,6 +2409,8 @@ int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES *usart)
         if (xfer->send_active != 0U)
           return ARM_DRIVER_ERROR_BUSY;
 
+        DFS_LOCK();
+
         // Set Send active and Break flag
         xfer->send_active = 1U;
         xfer->break_flag  = 1U;
@@ -1491,17 +2424,49 @@ int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES *usart)
           // Clear break and Send Active flag
           xfer->break_flag  = 0U;
           xfer->send_active = 0U;
+          DFS_UNLOCK();
+#ifdef USART_BUFFERED
+          // Resume transmission of data queued by Write
+          if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U))
+            usart->reg->CR1 |= USART_CR1_TXEIE;
+#endif
         }
       }
       return ARM_DRIVER_OK;
 
+    // Circular DMA receive
+    case USART_CONTROL_RX_CIRCULAR:
+      if (usart->rx_dma == NULL)
+        return ARM_DRIVER_ERROR_UNSUPPORTED;
+
+      if (info->status.rx_busy != 0U)
+        return ARM_DRIVER_ERROR_BUSY;
+
+      xfer->rx_circular = (arg != 0U) ? 1U : 0U;
+      return ARM_DRIVER_OK;
+
     // Abort Send
     case ARM_USART_ABORT_SEND:
       // Disable TX and TC interrupt
       usart->reg->CR1 &= ~(USART_CR1_TXEIE | USART_CR1_TCIE);
+#ifdef USART_DMA_TX
+      if (usart->reg->CR3 & USART_CR3_DMAT) {
+        // Stop DMA transmitter
+        usart->reg->CR3 &= ~USART_CR3_DMAT;
+        xfer->tx_cnt = xfer->tx_num - DMA_StreamGetCount(usart->tx_dma);
+        DMA_StreamDisable(usart->tx_dma);
+      }
+#endif
+#ifdef USART_BUFFERED
+      // Discard data queued by Write
+      if (usart->tx_fifo != NULL)
+        usart->tx_fifo->tail = usart->tx_fifo->head;
+#endif
       // Clear break flag
       xfer->break_flag = 0U;
       // Clear Send active flag
+      if (xfer->send_active)
+        DFS_UNLOCK();
       xfer->send_active = 0U;
       return ARM_DRIVER_OK;
 
@@ -1509,17 +2474,62 @@ int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES *usart)
     case ARM_USART_ABORT_RECEIVE:
       // Disable RX interrupt
       usart->reg->CR1 &= ~USART_CR1_RXNEIE;
+#ifdef USART_DMA_RX
+      if (usart->reg->CR3 & USART_CR3_DMAR) {
+        // Stop DMA receiver
+        usart->reg->CR3 &= ~USART_CR3_DMAR;
+        xfer->rx_cnt = xfer->rx_num - DMA_StreamGetCount(usart->rx_dma);
+        DMA_StreamDisable(usart->rx_dma);
+      }
+#endif
       // Clear RX busy status
+      if (info->status.rx_busy)
+        DFS_UNLOCK();
       info->status.rx_busy = 0U;
+#ifdef USART_BUFFERED
+      // Keep collecting received data into receive FIFO
+      if ((usart->rx_fifo != NULL) && (info->flags & USART_FLAG_RX_ENABLED))
+        usart->reg->CR1 |= USART_CR1_RXNEIE;
+#endif
       return ARM_DRIVER_OK;
 
     // Abort transfer
     case ARM_USART_ABORT_TRANSFER:
       // Disable TX, TC and RX interrupt
       usart->reg->CR1 &= ~(USART_CR1_TXEIE | USART_CR1_TCIE | USART_CR1_RXNEIE);
+#ifdef USART_DMA_TX
+      if (usart->reg->CR3 & USART_CR3_DMAT) {
+        // Stop DMA transmitter
+        usart->reg->CR3 &= ~USART_CR3_DMAT;
+        xfer->tx_cnt = xfer->tx_num - DMA_StreamGetCount(usart->tx_dma);
+        DMA_StreamDisable(usart->tx_dma);
+      }
+#endif
+#ifdef USART_DMA_RX
+      if (usart->reg->CR3 & USART_CR3_DMAR) {
+        // Stop DMA receiver
+        usart->reg->CR3 &= ~USART_CR3_DMAR;
+        xfer->rx_cnt = xfer->rx_num - DMA_StreamGetCount(usart->rx_dma);
+        DMA_StreamDisable(usart->rx_dma);
+      }
+#endif
+#ifdef USART_BUFFERED
+      // Discard data queued by Write
+      if (usart->tx_fifo != NULL)
+        usart->tx_fifo->tail = usart->tx_fifo->head;
+#endif
       // Clear busy statuses
+      if (info->status.rx_busy)
+        DFS_UNLOCK();
+      if (xfer->send_active)
+        DFS_UNLOCK();
       info->status.rx_busy = 0U;
       xfer->send_active    = 0U;
+#ifdef USART_BUFFERED
+      // Keep collecting received data into receive FIFO
+      if ((usart->rx_fifo != NULL) && (info->flags & USART_FLAG_RX_ENABLED))
+        usart->reg->CR1 |= USART_CR1_RXNEIE;
+#endif
       return ARM_DRIVER_OK;
 
     // Control TX
@@ -1885,6 +2895,7 @@ int32_t USART_Control(uint32_t control, uint32_t arg, USART_RESOURCES *usart)
 
   // Configure Baud rate register
   usart->reg->BRR = val;
+  info->baudrate  = arg;
 
   // Configuration is OK - Mode is valid
   info->mode = mode;
@@ -2003,6 +3014,10 @@ ARM_USART_STATUS USART_GetStatus(USART_RESOURCES *usart)
 
   if (usart->xfer->send_active != 0U)
     status.tx_busy        = 1U;
+#ifdef USART_BUFFERED
+  else if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U))
+    status.tx_busy        = 1U;
+#endif
   else
     status.tx_busy        = ((usart->reg->SR & USART_SR_TC) ? (0U) : (1U));
 
@@ -2087,6 +3102,86 @@ ARM_USART_MODEM_STATUS USART_GetModemStatus(USART_RESOURCES *usart)
 }
 
 
+#ifdef USART_BUFFERED
+/**
+  \fn          int32_t USART_Read(void *data, uint32_t num, USART_RESOURCES *usart)
+  \brief       Read data collected in the receive FIFO without blocking.
+  \param[out]  data  Pointer to buffer for data read from FIFO
+  \param[in]   num   Maximum number of data items to read
+  \param[in]   usart Pointer to USART resources
+  \return      number of data items read (0 when FIFO is empty) or \ref execution_status on error
+*/
+static
+int32_t USART_Read(void *data, uint32_t num, USART_RESOURCES *usart)
+{
+  uint32_t val, sz, cnt;
+
+  if ((data == NULL) || (num == 0U)) {
+    // Invalid parameters
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((usart->info->flags & USART_FLAG_CONFIGURED) == 0U) {
+    // USART is not configured (mode not selected)
+    return ARM_DRIVER_ERROR;
+  }
+
+  // Nine bit data without parity occupies two bytes per item
+  val = usart->reg->CR1;
+  sz  = (((val & USART_CR1_PCE) == 0U) && ((val & USART_CR1_M) != 0U)) ? 2U : 1U;
+
+  cnt = USART_FifoCount(usart->rx_fifo) / sz;
+  if (num > cnt)
+    num = cnt;
+
+  USART_FifoGet(usart->rx_fifo, (uint8_t *)data, num * sz);
+
+  return ((int32_t)num);
+}
+
+/**
+  \fn          int32_t USART_Write(const void *data, uint32_t num, USART_RESOURCES *usart)
+  \brief       Queue data into the transmit FIFO without blocking.
+  \param[in]   data  Pointer to buffer with data to write into FIFO
+  \param[in]   num   Maximum number of data items to write
+  \param[in]   usart Pointer to USART resources
+  \return      number of data items queued (0 when FIFO is full) or \ref execution_status on error
+*/
+static
+int32_t USART_Write(const void *data, uint32_t num, USART_RESOURCES *usart)
+{
+  uint32_t val, sz, cnt;
+
+  if ((data == NULL) || (num == 0U)) {
+    // Invalid parameters
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if ((usart->info->flags & USART_FLAG_CONFIGURED) == 0U) {
+    // USART is not configured (mode not selected)
+    return ARM_DRIVER_ERROR;
+  }
+
+  // Nine bit data without parity occupies two bytes per item
+  val = usart->reg->CR1;
+  sz  = (((val & USART_CR1_PCE) == 0U) && ((val & USART_CR1_M) != 0U)) ? 2U : 1U;
+
+  cnt = (usart->tx_fifo->size - USART_FifoCount(usart->tx_fifo)) / sz;
+  if (num > cnt)
+    num = cnt;
+
+  if (num != 0U) {
+    USART_FifoPut(usart->tx_fifo, (const uint8_t *)data, num * sz);
+
+    // Start transmitter unless Send owns it, it picks up the FIFO when done
+    if (usart->xfer->send_active == 0U)
+      usart->reg->CR1 |= USART_CR1_TXEIE;
+  }
+
+  return ((int32_t)num);
+}
+#endif
+
 /**
   \fn          void USART_IRQHandler(USART_RESOURCES *usart)
   \brief       USART Interrupt handler.
@@ -2109,11 +3204,33 @@ void USART_IRQHandler(USART_RESOURCES *usart)
   if (sr & USART_SR_RXNE & usart->reg->CR1) {
     // Check for RX overflow
     if (usart->info->status.rx_busy == 0U) {
-      // New receive has not been started
-      // Dump RX data
-      usart->reg->DR;
-      usart->info->status.rx_overflow = 1;
-      event |= ARM_USART_EVENT_RX_OVERFLOW;
+#ifdef USART_BUFFERED
+      if (usart->rx_fifo != NULL) {
+        // Store RX data into receive FIFO
+        data = (uint16_t) usart->reg->DR;
+
+        // If nine bit data, no parity
+        val = usart->reg->CR1;
+        val = (((val & USART_CR1_PCE) == 0U) && ((val & USART_CR1_M) != 0U)) ? 2U : 1U;
+
+        if ((usart->rx_fifo->size - USART_FifoCount(usart->rx_fifo)) >= val) {
+          USART_FifoPut(usart->rx_fifo, (uint8_t *)&data, val);
+        }
+        else {
+          // FIFO full, data is lost
+          usart->info->status.rx_overflow = 1;
+          event |= ARM_USART_EVENT_RX_OVERFLOW;
+        }
+      }
+      else
+#endif
+      {
+        // New receive has not been started
+        // Dump RX data
+        usart->reg->DR;
+        usart->info->status.rx_overflow = 1;
+        event |= ARM_USART_EVENT_RX_OVERFLOW;
+      }
     }
     else {
       if ((usart->info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER)
@@ -2137,11 +3254,13 @@ void USART_IRQHandler(USART_RESOURCES *usart)
 
       // Check if requested amount of data is received
       if (usart->xfer->rx_cnt == usart->xfer->rx_num) {
-        // Disable IDLE interrupt
-        usart->reg->CR1 &= ~USART_CR1_IDLEIE;
+        // Disable IDLE interrupt, kept as RX timeout notification in buffered mode
+        if (usart->rx_fifo == NULL)
+          usart->reg->CR1 &= ~USART_CR1_IDLEIE;
 
         // Clear RX busy flag and set receive transfer complete event
         usart->info->status.rx_busy = 0U;
+        DFS_UNLOCK();
         if (usart->info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) {
           val = usart->xfer->sync_mode;
           usart->xfer->sync_mode = 0U;
@@ -2180,6 +3299,23 @@ void USART_IRQHandler(USART_RESOURCES *usart)
       // Send break
       usart->reg->CR1 |= USART_CR1_SBK;
     }
+#ifdef USART_BUFFERED
+    else if (usart->xfer->send_active == 0U) {
+      // Buffered mode: drain transmit FIFO
+      val = usart->reg->CR1;
+      val = (((val & USART_CR1_PCE) == 0U) && ((val & USART_CR1_M) != 0U)) ? 2U : 1U;
+
+      if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) >= val)) {
+        USART_FifoGet(usart->tx_fifo, (uint8_t *)&data, val);
+        usart->reg->DR = data;
+      }
+      else {
+        // FIFO empty, disable TXE and wait for transmission complete
+        usart->reg->CR1 &= ~USART_CR1_TXEIE;
+        usart->reg->CR1 |= USART_CR1_TCIE;
+      }
+    }
+#endif
     else {
       if (usart->xfer->tx_num != usart->xfer->tx_cnt) {
         if ((usart->info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER)
@@ -2212,6 +3348,13 @@ void USART_IRQHandler(USART_RESOURCES *usart)
         usart->reg->CR1 |= USART_CR1_TCIE;
 
         usart->xfer->send_active = 0U;
+        DFS_UNLOCK();
+
+#ifdef USART_BUFFERED
+        // Continue with data queued by Write
+        if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U))
+          usart->reg->CR1 |= USART_CR1_TXEIE;
+#endif
 
         // Set send complete event
         if (usart->info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) {
@@ -2237,24 +3380,27 @@ void USART_IRQHandler(USART_RESOURCES *usart)
   // RX Overrun
   if ((sr & USART_SR_ORE) != 0U) {
     // Shift register has been overwritten
-    // Dummy data read to clear the ORE flag
-    usart->reg->DR;
+    // Dummy data read to clear the ORE flag, RX DMA reads it when enabled
+    if ((usart->reg->CR3 & USART_CR3_DMAR) == 0U)
+      usart->reg->DR;
     usart->info->status.rx_overflow = 1U;
     event |= ARM_USART_EVENT_RX_OVERFLOW;
   }
 
   // Framing error
   if ((sr & USART_SR_FE) != 0U) {
-    // Dummy data read to clear the FE flag
-    usart->reg->DR;
+    // Dummy data read to clear the FE flag, RX DMA reads it when enabled
+    if ((usart->reg->CR3 & USART_CR3_DMAR) == 0U)
+      usart->reg->DR;
     usart->info->status.rx_framing_error = 1U;
     event |= ARM_USART_EVENT_RX_FRAMING_ERROR;
   }
 
   // Parity error
   if ((sr & USART_SR_PE) != 0U) {
-    // Dummy data read to clear the PE flag
-    usart->reg->DR;
+    // Dummy data read to clear the PE flag, RX DMA reads it when enabled
+    if ((usart->reg->CR3 & USART_CR3_DMAR) == 0U)
+      usart->reg->DR;
     usart->info->status.rx_parity_error = 1U;
     event |= ARM_USART_EVENT_RX_PARITY_ERROR;
   }
@@ -2282,6 +3428,119 @@ void USART_IRQHandler(USART_RESOURCES *usart)
   }
 }
 
+#ifdef USART_DMA_TX
+/**
+  \fn          void USART_TX_DMA_Complete(uint32_t event, USART_RESOURCES *usart)
+  \brief       USART transmit DMA stream event handler.
+  \param[in]   event     DMA stream event
+  \param[in]   usart     Pointer to USART resources
+*/
+static
+void USART_TX_DMA_Complete(uint32_t event, USART_RESOURCES *usart)
+{
+  USART_TRANSFER_INFO *xfer = usart->xfer;
+
+  if ((event & DMA_EVENT_TRANSFER_COMPLETE) == 0U)
+    return;
+
+  // TX DMA disable
+  usart->reg->CR3 &= ~USART_CR3_DMAT;
+
+  xfer->tx_cnt = xfer->tx_num;
+  xfer->send_active = 0U;
+  DFS_UNLOCK();
+
+  // Enable TC interrupt
+  usart->reg->CR1 |= USART_CR1_TCIE;
+
+#ifdef USART_BUFFERED
+  // Continue with data queued by Write
+  if ((usart->tx_fifo != NULL) && (USART_FifoCount(usart->tx_fifo) != 0U))
+    usart->reg->CR1 |= USART_CR1_TXEIE;
+#endif
+
+  // Set send complete event
+  if (usart->info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) {
+    if ((xfer->sync_mode == USART_SYNC_MODE_TX) &&
+        ((usart->info->flags & USART_FLAG_RX_ENABLED) == 0U)) {
+      if (usart->info->cb_event != NULL)
+        usart->info->cb_event(ARM_USART_EVENT_SEND_COMPLETE);
+    }
+  }
+  else {
+    if (usart->info->cb_event != NULL)
+      usart->info->cb_event(ARM_USART_EVENT_SEND_COMPLETE);
+  }
+}
+#endif
+
+#ifdef USART_DMA_RX
+/**
+  \fn          void USART_RX_DMA_Complete(uint32_t event, USART_RESOURCES *usart)
+  \brief       USART receive DMA stream event handler.
+  \param[in]   event     DMA stream event
+  \param[in]   usart     Pointer to USART resources
+*/
+static
+void USART_RX_DMA_Complete(uint32_t event, USART_RESOURCES *usart)
+{
+  USART_TRANSFER_INFO *xfer = usart->xfer;
+  uint32_t sync_mode, usart_event;
+
+  if (xfer->rx_circular != 0U) {
+    // Ring keeps running, only report which half has been filled
+    usart_event = 0U;
+    if (event & DMA_EVENT_HALF_TRANSFER_COMPLETE)
+      usart_event |= USART_EVENT_RX_HALF_FULL;
+    if (event & DMA_EVENT_TRANSFER_COMPLETE)
+      usart_event |= USART_EVENT_RX_FULL;
+
+    if ((usart_event != 0U) && (usart->info->cb_event != NULL))
+      usart->info->cb_event(usart_event);
+    return;
+  }
+
+  if ((event & DMA_EVENT_TRANSFER_COMPLETE) == 0U)
+    return;
+
+  // RX DMA disable and IDLE interrupt disable
+  usart->reg->CR3 &= ~USART_CR3_DMAR;
+  if (usart->rx_fifo == NULL)
+    usart->reg->CR1 &= ~USART_CR1_IDLEIE;
+
+  xfer->rx_cnt = xfer->rx_num;
+  usart->info->status.rx_busy = 0U;
+  DFS_UNLOCK();
+
+  // Restore RXNE interrupt for overflow detection
+  usart->reg->CR1 |= USART_CR1_RXNEIE;
+
+  if (usart->info->cb_event == NULL)
+    return;
+
+  if (usart->info->mode == ARM_USART_MODE_SYNCHRONOUS_MASTER) {
+    sync_mode = xfer->sync_mode;
+    xfer->sync_mode = 0U;
+    switch (sync_mode) {
+      case USART_SYNC_MODE_TX:
+        usart->info->cb_event(ARM_USART_EVENT_SEND_COMPLETE);
+        break;
+      case USART_SYNC_MODE_RX:
+        usart->info->cb_event(ARM_USART_EVENT_RECEIVE_COMPLETE);
+        break;
+      case USART_SYNC_MODE_TX_RX:
+        usart->info->cb_event(ARM_USART_EVENT_TRANSFER_COMPLETE);
+        break;
+      default:
+        break;
+    }
+  }
+  else {
+    usart->info->cb_event(ARM_USART_EVENT_RECEIVE_COMPLETE);
+  }
+}
+#endif
+
 #ifdef USE_USART1
 // USART1 Driver Wrapper functions
 
@@ -2368,6 +3627,44 @@ void USART1_IRQHandler(void)
   USART_IRQHandler(&USART1_Resources);
 }
 
+#ifdef USART1_TX_DMA_Stream
+void USART1_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART1_TX_DMA);
+}
+
+static
+void USART1_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART1_Resources);
+}
+#endif
+
+#ifdef USART1_RX_DMA_Stream
+void USART1_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART1_RX_DMA);
+}
+
+static
+void USART1_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART1_Resources);
+}
+#endif
+
+#ifdef USART1_RX_FIFO_SIZE
+int32_t USART1_Read(void *data, uint32_t num)
+{
+  return USART_Read(data, num, &USART1_Resources);
+}
+
+int32_t USART1_Write(const void *data, uint32_t num)
+{
+  return USART_Write(data, num, &USART1_Resources);
+}
+#endif
+
 // USART1 Driver Control Block
 ARM_DRIVER_USART Driver_USART1 = {
     USARTx_GetVersion,
@@ -2473,6 +3770,44 @@ void USART2_IRQHandler(void)
   USART_IRQHandler(&USART2_Resources);
 }
 
+#ifdef USART2_TX_DMA_Stream
+void USART2_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART2_TX_DMA);
+}
+
+static
+void USART2_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART2_Resources);
+}
+#endif
+
+#ifdef USART2_RX_DMA_Stream
+void USART2_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART2_RX_DMA);
+}
+
+static
+void USART2_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART2_Resources);
+}
+#endif
+
+#ifdef USART2_RX_FIFO_SIZE
+int32_t USART2_Read(void *data, uint32_t num)
+{
+  return USART_Read(data, num, &USART2_Resources);
+}
+
+int32_t USART2_Write(const void *data, uint32_t num)
+{
+  return USART_Write(data, num, &USART2_Resources);
+}
+#endif
+
 // USART2 Driver Control Block
 ARM_DRIVER_USART Driver_USART2 = {
     USARTx_GetVersion,
@@ -2578,6 +3913,44 @@ void USART3_IRQHandler(void)
   USART_IRQHandler(&USART3_Resources);
 }
 
+#ifdef USART3_TX_DMA_Stream
+void USART3_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART3_TX_DMA);
+}
+
+static
+void USART3_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART3_Resources);
+}
+#endif
+
+#ifdef USART3_RX_DMA_Stream
+void USART3_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART3_RX_DMA);
+}
+
+static
+void USART3_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART3_Resources);
+}
+#endif
+
+#ifdef USART3_RX_FIFO_SIZE
+int32_t USART3_Read(void *data, uint32_t num)
+{
+  return USART_Read(data, num, &USART3_Resources);
+}
+
+int32_t USART3_Write(const void *data, uint32_t num)
+{
+  return USART_Write(data, num, &USART3_Resources);
+}
+#endif
+
 // USART3 Driver Control Block
 ARM_DRIVER_USART Driver_USART3 = {
     USARTx_GetVersion,
@@ -2682,6 +4055,44 @@ void UART4_IRQHandler(void)
   USART_IRQHandler(&USART4_Resources);
 }
 
+#ifdef UART4_TX_DMA_Stream
+void UART4_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART4_TX_DMA);
+}
+
+static
+void UART4_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART4_Resources);
+}
+#endif
+
+#ifdef UART4_RX_DMA_Stream
+void UART4_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART4_RX_DMA);
+}
+
+static
+void UART4_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART4_Resources);
+}
+#endif
+
+#ifdef UART4_RX_FIFO_SIZE
+int32_t USART4_Read(void *data, uint32_t num)
+{
+  return USART_Read(data, num, &USART4_Resources);
+}
+
+int32_t USART4_Write(const void *data, uint32_t num)
+{
+  return USART_Write(data, num, &USART4_Resources);
+}
+#endif
+
 // USART4 Driver Control Block
 ARM_DRIVER_USART Driver_USART4 = {
     USARTx_GetVersion,
@@ -2787,6 +4198,44 @@ void UART5_IRQHandler(void)
   USART_IRQHandler(&USART5_Resources);
 }
 
+#ifdef UART5_TX_DMA_Stream
+void UART5_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART5_TX_DMA);
+}
+
+static
+void UART5_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART5_Resources);
+}
+#endif
+
+#ifdef UART5_RX_DMA_Stream
+void UART5_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART5_RX_DMA);
+}
+
+static
+void UART5_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART5_Resources);
+}
+#endif
+
+#ifdef UART5_RX_FIFO_SIZE
+int32_t USART5_Read(void *data, uint32_t num)
+{
+  return USART_Read(data, num, &USART5_Resources);
+}
+
+int32_t USART5_Write(const void *data, uint32_t num)
+{
+  return USART_Write(data, num, &USART5_Resources);
+}
+#endif
+
 // USART5 Driver Control Block
 ARM_DRIVER_USART Driver_USART5 = {
     USARTx_GetVersion,
@@ -2892,6 +4341,44 @@ void USART6_IRQHandler(void)
   USART_IRQHandler(&USART6_Resources);
 }
 
+#ifdef USART6_TX_DMA_Stream
+void USART6_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART6_TX_DMA);
+}
+
+static
+void USART6_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART6_Resources);
+}
+#endif
+
+#ifdef USART6_RX_DMA_Stream
+void USART6_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&USART6_RX_DMA);
+}
+
+static
+void USART6_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART6_Resources);
+}
+#endif
+
+#ifdef USART6_RX_FIFO_SIZE
+int32_t USART6_Read(void *data, uint32_t num)
+{
+  return USART_Read(data, num, &USART6_Resources);
+}
+
+int32_t USART6_Write(const void *data, uint32_t num)
+{
+  return USART_Write(data, num, &USART6_Resources);
+}
+#endif
+
 // USART6 Driver Control Block
 ARM_DRIVER_USART Driver_USART6 = {
     USARTx_GetVersion,
@@ -2997,6 +4484,44 @@ void UART7_IRQHandler(void)
   USART_IRQHandler(&USART7_Resources);
 }
 
+#ifdef UART7_TX_DMA_Stream
+void UART7_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART7_TX_DMA);
+}
+
+static
+void UART7_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART7_Resources);
+}
+#endif
+
+#ifdef UART7_RX_DMA_Stream
+void UART7_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART7_RX_DMA);
+}
+
+static
+void UART7_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART7_Resources);
+}
+#endif
+
+#ifdef UART7_RX_FIFO_SIZE
+int32_t USART7_Read(void *data, uint32_t num)
+{
+  return USART_Read(data, num, &USART7_Resources);
+}
+
+int32_t USART7_Write(const void *data, uint32_t num)
+{
+  return USART_Write(data, num, &USART7_Resources);
+}
+#endif
+
 // USART7 Driver Control Block
 ARM_DRIVER_USART Driver_USART7 = {
     USARTx_GetVersion,
@@ -3102,6 +4627,44 @@ void UART8_IRQHandler(void)
   USART_IRQHandler(&USART8_Resources);
 }
 
+#ifdef UART8_TX_DMA_Stream
+void UART8_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART8_TX_DMA);
+}
+
+static
+void UART8_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART8_Resources);
+}
+#endif
+
+#ifdef UART8_RX_DMA_Stream
+void UART8_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART8_RX_DMA);
+}
+
+static
+void UART8_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART8_Resources);
+}
+#endif
+
+#ifdef UART8_RX_FIFO_SIZE
+int32_t USART8_Read(void *data, uint32_t num)
+{
+  return USART_Read(data, num, &USART8_Resources);
+}
+
+int32_t USART8_Write(const void *data, uint32_t num)
+{
+  return USART_Write(data, num, &USART8_Resources);
+}
+#endif
+
 // USART8 Driver Control Block
 ARM_DRIVER_USART Driver_USART8 = {
     USARTx_GetVersion,
@@ -3207,6 +4770,44 @@ void UART9_IRQHandler(void)
   USART_IRQHandler(&USART9_Resources);
 }
 
+#ifdef UART9_TX_DMA_Stream
+void UART9_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART9_TX_DMA);
+}
+
+static
+void UART9_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART9_Resources);
+}
+#endif
+
+#ifdef UART9_RX_DMA_Stream
+void UART9_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART9_RX_DMA);
+}
+
+static
+void UART9_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART9_Resources);
+}
+#endif
+
+#ifdef UART9_RX_FIFO_SIZE
+int32_t USART9_Read(void *data, uint32_t num)
+{
+  return USART_Read(data, num, &USART9_Resources);
+}
+
+int32_t USART9_Write(const void *data, uint32_t num)
+{
+  return USART_Write(data, num, &USART9_Resources);
+}
+#endif
+
 // USART9 Driver Control Block
 ARM_DRIVER_USART Driver_USART9 = {
     USARTx_GetVersion,
@@ -3312,6 +4913,44 @@ void UART10_IRQHandler(void)
   USART_IRQHandler(&USART10_Resources);
 }
 
+#ifdef UART10_TX_DMA_Stream
+void UART10_TX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART10_TX_DMA);
+}
+
+static
+void UART10_TX_DMA_Complete(uint32_t event)
+{
+  USART_TX_DMA_Complete(event, &USART10_Resources);
+}
+#endif
+
+#ifdef UART10_RX_DMA_Stream
+void UART10_RX_DMA_Handler(void)
+{
+  DMA_IRQ_Handle(&UART10_RX_DMA);
+}
+
+static
+void UART10_RX_DMA_Complete(uint32_t event)
+{
+  USART_RX_DMA_Complete(event, &USART10_Resources);
+}
+#endif
+
+#ifdef UART10_RX_FIFO_SIZE
+int32_t USART10_Read(void *data, uint32_t num)
+{
+  return USART_Read(data, num, &USART10_Resources);
+}
+
+int32_t USART10_Write(const void *data, uint32_t num)
+{
+  return USART_Write(data, num, &USART10_Resources);
+}
+#endif
+
 // USART10 Driver Control Block
 ARM_DRIVER_USART Driver_USART10 = {
     USARTx_GetVersion,
@@ -30,6 +30,8 @@
 #include "stm32f4xx.h"
 #include "RCC_STM32F4xx.h"
 #include "GPIO_STM32F4xx.h"
+#include "DMA_STM32F4xx.h"
+#include "DFS_STM32F4xx.h"
 
 #include "Driver_USART.h"
 
@@ -43,6 +45,30 @@
 #if (RTE_USART1 == 1)
   #define USE_USART1
 
+  #if (RTE_USART1_RX_DMA == 1)
+    #define USART1_RX_DMA_Stream      DMAx_STREAMy(RTE_USART1_RX_DMA_NUMBER, RTE_USART1_RX_DMA_STREAM)
+    #define USART1_RX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_USART1_RX_DMA_NUMBER, RTE_USART1_RX_DMA_STREAM)
+    #define USART1_RX_DMA_Channel     DMA_CHANNEL_x(RTE_USART1_RX_DMA_CHANNEL)
+    #define USART1_RX_DMA_Priority    DMA_PRIORITY(RTE_USART1_RX_DMA_PRIORITY)
+    #define USART1_RX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_USART1_RX_DMA_NUMBER, RTE_USART1_RX_DMA_STREAM)
+  #endif
+  #if (RTE_USART1_TX_DMA == 1)
+    #define USART1_TX_DMA_Stream      DMAx_STREAMy(RTE_USART1_TX_DMA_NUMBER, RTE_USART1_TX_DMA_STREAM)
+    #define USART1_TX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_USART1_TX_DMA_NUMBER, RTE_USART1_TX_DMA_STREAM)
+    #define USART1_TX_DMA_Channel     DMA_CHANNEL_x(RTE_USART1_TX_DMA_CHANNEL)
+    #define USART1_TX_DMA_Priority    DMA_PRIORITY(RTE_USART1_TX_DMA_PRIORITY)
+    #define USART1_TX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_USART1_TX_DMA_NUMBER, RTE_USART1_TX_DMA_STREAM)
+  #endif
+
+  #if (RTE_USART1_FIFO == 1)
+    #if (((RTE_USART1_RX_FIFO_SIZE & (RTE_USART1_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_USART1_TX_FIFO_SIZE & (RTE_USART1_TX_FIFO_SIZE - 1)) != 0))
+      #error "USART1 FIFO size must be a power of two!"
+    #endif
+    #define USART1_RX_FIFO_SIZE       RTE_USART1_RX_FIFO_SIZE
+    #define USART1_TX_FIFO_SIZE       RTE_USART1_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_USART1_TX == 1)
     #if defined (STM32F410Tx)
       // USART1 TX available on pins: PA15, PB6
@@ -113,6 +139,30 @@
 #if (RTE_USART2 == 1)
   #define USE_USART2
 
+  #if (RTE_USART2_RX_DMA == 1)
+    #define USART2_RX_DMA_Stream      DMAx_STREAMy(RTE_USART2_RX_DMA_NUMBER, RTE_USART2_RX_DMA_STREAM)
+    #define USART2_RX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_USART2_RX_DMA_NUMBER, RTE_USART2_RX_DMA_STREAM)
+    #define USART2_RX_DMA_Channel     DMA_CHANNEL_x(RTE_USART2_RX_DMA_CHANNEL)
+    #define USART2_RX_DMA_Priority    DMA_PRIORITY(RTE_USART2_RX_DMA_PRIORITY)
+    #define USART2_RX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_USART2_RX_DMA_NUMBER, RTE_USART2_RX_DMA_STREAM)
+  #endif
+  #if (RTE_USART2_TX_DMA == 1)
+    #define USART2_TX_DMA_Stream      DMAx_STREAMy(RTE_USART2_TX_DMA_NUMBER, RTE_USART2_TX_DMA_STREAM)
+    #define USART2_TX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_USART2_TX_DMA_NUMBER, RTE_USART2_TX_DMA_STREAM)
+    #define USART2_TX_DMA_Channel     DMA_CHANNEL_x(RTE_USART2_TX_DMA_CHANNEL)
+    #define USART2_TX_DMA_Priority    DMA_PRIORITY(RTE_USART2_TX_DMA_PRIORITY)
+    #define USART2_TX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_USART2_TX_DMA_NUMBER, RTE_USART2_TX_DMA_STREAM)
+  #endif
+
+  #if (RTE_USART2_FIFO == 1)
+    #if (((RTE_USART2_RX_FIFO_SIZE & (RTE_USART2_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_USART2_TX_FIFO_SIZE & (RTE_USART2_TX_FIFO_SIZE - 1)) != 0))
+      #error "USART2 FIFO size must be a power of two!"
+    #endif
+    #define USART2_RX_FIFO_SIZE       RTE_USART2_RX_FIFO_SIZE
+    #define USART2_TX_FIFO_SIZE       RTE_USART2_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_USART2_TX == 1)
     #if defined(STM32F410Tx) || defined(STM32F410Cx) || defined(STM32F410Rx)
       // USART2 TX available on pin: PA2
@@ -200,6 +250,30 @@
 
   #define USE_USART3
 
+  #if (RTE_USART3_RX_DMA == 1)
+    #define USART3_RX_DMA_Stream      DMAx_STREAMy(RTE_USART3_RX_DMA_NUMBER, RTE_USART3_RX_DMA_STREAM)
+    #define USART3_RX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_USART3_RX_DMA_NUMBER, RTE_USART3_RX_DMA_STREAM)
+    #define USART3_RX_DMA_Channel     DMA_CHANNEL_x(RTE_USART3_RX_DMA_CHANNEL)
+    #define USART3_RX_DMA_Priority    DMA_PRIORITY(RTE_USART3_RX_DMA_PRIORITY)
+    #define USART3_RX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_USART3_RX_DMA_NUMBER, RTE_USART3_RX_DMA_STREAM)
+  #endif
+  #if (RTE_USART3_TX_DMA == 1)
+    #define USART3_TX_DMA_Stream      DMAx_STREAMy(RTE_USART3_TX_DMA_NUMBER, RTE_USART3_TX_DMA_STREAM)
+    #define USART3_TX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_USART3_TX_DMA_NUMBER, RTE_USART3_TX_DMA_STREAM)
+    #define USART3_TX_DMA_Channel     DMA_CHANNEL_x(RTE_USART3_TX_DMA_CHANNEL)
+    #define USART3_TX_DMA_Priority    DMA_PRIORITY(RTE_USART3_TX_DMA_PRIORITY)
+    #define USART3_TX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_USART3_TX_DMA_NUMBER, RTE_USART3_TX_DMA_STREAM)
+  #endif
+
+  #if (RTE_USART3_FIFO == 1)
+    #if (((RTE_USART3_RX_FIFO_SIZE & (RTE_USART3_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_USART3_TX_FIFO_SIZE & (RTE_USART3_TX_FIFO_SIZE - 1)) != 0))
+      #error "USART3 FIFO size must be a power of two!"
+    #endif
+    #define USART3_RX_FIFO_SIZE       RTE_USART3_RX_FIFO_SIZE
+    #define USART3_TX_FIFO_SIZE       RTE_USART3_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_USART3_TX == 1)
     #define USE_USART3_TX_Pin       1
     #define USART3_TX_GPIO_PORT     RTE_USART3_TX_PORT
@@ -245,6 +319,30 @@
 
   #define USE_UART4
 
+  #if (RTE_UART4_RX_DMA == 1)
+    #define UART4_RX_DMA_Stream       DMAx_STREAMy(RTE_UART4_RX_DMA_NUMBER, RTE_UART4_RX_DMA_STREAM)
+    #define UART4_RX_DMA_IRQn         DMAx_STREAMy_IRQn(RTE_UART4_RX_DMA_NUMBER, RTE_UART4_RX_DMA_STREAM)
+    #define UART4_RX_DMA_Channel      DMA_CHANNEL_x(RTE_UART4_RX_DMA_CHANNEL)
+    #define UART4_RX_DMA_Priority     DMA_PRIORITY(RTE_UART4_RX_DMA_PRIORITY)
+    #define UART4_RX_DMA_Handler      DMAx_STREAMy_IRQ(RTE_UART4_RX_DMA_NUMBER, RTE_UART4_RX_DMA_STREAM)
+  #endif
+  #if (RTE_UART4_TX_DMA == 1)
+    #define UART4_TX_DMA_Stream       DMAx_STREAMy(RTE_UART4_TX_DMA_NUMBER, RTE_UART4_TX_DMA_STREAM)
+    #define UART4_TX_DMA_IRQn         DMAx_STREAMy_IRQn(RTE_UART4_TX_DMA_NUMBER, RTE_UART4_TX_DMA_STREAM)
+    #define UART4_TX_DMA_Channel      DMA_CHANNEL_x(RTE_UART4_TX_DMA_CHANNEL)
+    #define UART4_TX_DMA_Priority     DMA_PRIORITY(RTE_UART4_TX_DMA_PRIORITY)
+    #define UART4_TX_DMA_Handler      DMAx_STREAMy_IRQ(RTE_UART4_TX_DMA_NUMBER, RTE_UART4_TX_DMA_STREAM)
+  #endif
+
+  #if (RTE_UART4_FIFO == 1)
+    #if (((RTE_UART4_RX_FIFO_SIZE & (RTE_UART4_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_UART4_TX_FIFO_SIZE & (RTE_UART4_TX_FIFO_SIZE - 1)) != 0))
+      #error "UART4 FIFO size must be a power of two!"
+    #endif
+    #define UART4_RX_FIFO_SIZE        RTE_UART4_RX_FIFO_SIZE
+    #define UART4_TX_FIFO_SIZE        RTE_UART4_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_UART4_TX == 1)
     #if defined (STM32F413xx) || defined (STM32F423xx)
       // UART4 TX available on pins: PA0, PD10, PA12, PD1
@@ -288,6 +386,30 @@
 
   #define USE_UART5
 
+  #if (RTE_UART5_RX_DMA == 1)
+    #define UART5_RX_DMA_Stream       DMAx_STREAMy(RTE_UART5_RX_DMA_NUMBER, RTE_UART5_RX_DMA_STREAM)
+    #define UART5_RX_DMA_IRQn         DMAx_STREAMy_IRQn(RTE_UART5_RX_DMA_NUMBER, RTE_UART5_RX_DMA_STREAM)
+    #define UART5_RX_DMA_Channel      DMA_CHANNEL_x(RTE_UART5_RX_DMA_CHANNEL)
+    #define UART5_RX_DMA_Priority     DMA_PRIORITY(RTE_UART5_RX_DMA_PRIORITY)
+    #define UART5_RX_DMA_Handler      DMAx_STREAMy_IRQ(RTE_UART5_RX_DMA_NUMBER, RTE_UART5_RX_DMA_STREAM)
+  #endif
+  #if (RTE_UART5_TX_DMA == 1)
+    #define UART5_TX_DMA_Stream       DMAx_STREAMy(RTE_UART5_TX_DMA_NUMBER, RTE_UART5_TX_DMA_STREAM)
+    #define UART5_TX_DMA_IRQn         DMAx_STREAMy_IRQn(RTE_UART5_TX_DMA_NUMBER, RTE_UART5_TX_DMA_STREAM)
+    #define UART5_TX_DMA_Channel      DMA_CHANNEL_x(RTE_UART5_TX_DMA_CHANNEL)
+    #define UART5_TX_DMA_Priority     DMA_PRIORITY(RTE_UART5_TX_DMA_PRIORITY)
+    #define UART5_TX_DMA_Handler      DMAx_STREAMy_IRQ(RTE_UART5_TX_DMA_NUMBER, RTE_UART5_TX_DMA_STREAM)
+  #endif
+
+  #if (RTE_UART5_FIFO == 1)
+    #if (((RTE_UART5_RX_FIFO_SIZE & (RTE_UART5_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_UART5_TX_FIFO_SIZE & (RTE_UART5_TX_FIFO_SIZE - 1)) != 0))
+      #error "UART5 FIFO size must be a power of two!"
+    #endif
+    #define UART5_RX_FIFO_SIZE        RTE_UART5_RX_FIFO_SIZE
+    #define UART5_TX_FIFO_SIZE        RTE_UART5_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_UART5_TX == 1)
     #if !defined (STM32F413xx) && !defined (STM32F423xx)
       // UART5 TX available on pins: PC12
@@ -326,10 +448,34 @@
 #if (RTE_USART6 == 1)
   #define USE_USART6
 
+  #if (RTE_USART6_RX_DMA == 1)
+    #define USART6_RX_DMA_Stream      DMAx_STREAMy(RTE_USART6_RX_DMA_NUMBER, RTE_USART6_RX_DMA_STREAM)
+    #define USART6_RX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_USART6_RX_DMA_NUMBER, RTE_USART6_RX_DMA_STREAM)
+    #define USART6_RX_DMA_Channel     DMA_CHANNEL_x(RTE_USART6_RX_DMA_CHANNEL)
+    #define USART6_RX_DMA_Priority    DMA_PRIORITY(RTE_USART6_RX_DMA_PRIORITY)
+    #define USART6_RX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_USART6_RX_DMA_NUMBER, RTE_USART6_RX_DMA_STREAM)
+  #endif
+  #if (RTE_USART6_TX_DMA == 1)
+    #define USART6_TX_DMA_Stream      DMAx_STREAMy(RTE_USART6_TX_DMA_NUMBER, RTE_USART6_TX_DMA_STREAM)
+    #define USART6_TX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_USART6_TX_DMA_NUMBER, RTE_USART6_TX_DMA_STREAM)
+    #define USART6_TX_DMA_Channel     DMA_CHANNEL_x(RTE_USART6_TX_DMA_CHANNEL)
+    #define USART6_TX_DMA_Priority    DMA_PRIORITY(RTE_USART6_TX_DMA_PRIORITY)
+    #define USART6_TX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_USART6_TX_DMA_NUMBER, RTE_USART6_TX_DMA_STREAM)
+  #endif
+
   #ifndef USART6
     #error "USART6 not available for selected device!"
   #endif
 
+  #if (RTE_USART6_FIFO == 1)
+    #if (((RTE_USART6_RX_FIFO_SIZE & (RTE_USART6_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_USART6_TX_FIFO_SIZE & (RTE_USART6_TX_FIFO_SIZE - 1)) != 0))
+      #error "USART6 FIFO size must be a power of two!"
+    #endif
+    #define USART6_RX_FIFO_SIZE       RTE_USART6_RX_FIFO_SIZE
+    #define USART6_TX_FIFO_SIZE       RTE_USART6_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_USART6_TX == 1)
     #if defined (STM32F410Cx)
       // USART6 TX available on pin: PA11
@@ -448,6 +594,30 @@
 
   #define USE_UART7
 
+  #if (RTE_UART7_RX_DMA == 1)
+    #define UART7_RX_DMA_Stream       DMAx_STREAMy(RTE_UART7_RX_DMA_NUMBER, RTE_UART7_RX_DMA_STREAM)
+    #define UART7_RX_DMA_IRQn         DMAx_STREAMy_IRQn(RTE_UART7_RX_DMA_NUMBER, RTE_UART7_RX_DMA_STREAM)
+    #define UART7_RX_DMA_Channel      DMA_CHANNEL_x(RTE_UART7_RX_DMA_CHANNEL)
+    #define UART7_RX_DMA_Priority     DMA_PRIORITY(RTE_UART7_RX_DMA_PRIORITY)
+    #define UART7_RX_DMA_Handler      DMAx_STREAMy_IRQ(RTE_UART7_RX_DMA_NUMBER, RTE_UART7_RX_DMA_STREAM)
+  #endif
+  #if (RTE_UART7_TX_DMA == 1)
+    #define UART7_TX_DMA_Stream       DMAx_STREAMy(RTE_UART7_TX_DMA_NUMBER, RTE_UART7_TX_DMA_STREAM)
+    #define UART7_TX_DMA_IRQn         DMAx_STREAMy_IRQn(RTE_UART7_TX_DMA_NUMBER, RTE_UART7_TX_DMA_STREAM)
+    #define UART7_TX_DMA_Channel      DMA_CHANNEL_x(RTE_UART7_TX_DMA_CHANNEL)
+    #define UART7_TX_DMA_Priority     DMA_PRIORITY(RTE_UART7_TX_DMA_PRIORITY)
+    #define UART7_TX_DMA_Handler      DMAx_STREAMy_IRQ(RTE_UART7_TX_DMA_NUMBER, RTE_UART7_TX_DMA_STREAM)
+  #endif
+
+  #if (RTE_UART7_FIFO == 1)
+    #if (((RTE_UART7_RX_FIFO_SIZE & (RTE_UART7_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_UART7_TX_FIFO_SIZE & (RTE_UART7_TX_FIFO_SIZE - 1)) != 0))
+      #error "UART7 FIFO size must be a power of two!"
+    #endif
+    #define UART7_RX_FIFO_SIZE        RTE_UART7_RX_FIFO_SIZE
+    #define UART7_TX_FIFO_SIZE        RTE_UART7_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_UART7_TX == 1)
     #if !defined (STM32F413xx) && !defined (STM32F423xx)
       // UART7 TX available on pins: PF7, PE8
@@ -486,6 +656,30 @@
 
   #define USE_UART8
 
+  #if (RTE_UART8_RX_DMA == 1)
+    #define UART8_RX_DMA_Stream       DMAx_STREAMy(RTE_UART8_RX_DMA_NUMBER, RTE_UART8_RX_DMA_STREAM)
+    #define UART8_RX_DMA_IRQn         DMAx_STREAMy_IRQn(RTE_UART8_RX_DMA_NUMBER, RTE_UART8_RX_DMA_STREAM)
+    #define UART8_RX_DMA_Channel      DMA_CHANNEL_x(RTE_UART8_RX_DMA_CHANNEL)
+    #define UART8_RX_DMA_Priority     DMA_PRIORITY(RTE_UART8_RX_DMA_PRIORITY)
+    #define UART8_RX_DMA_Handler      DMAx_STREAMy_IRQ(RTE_UART8_RX_DMA_NUMBER, RTE_UART8_RX_DMA_STREAM)
+  #endif
+  #if (RTE_UART8_TX_DMA == 1)
+    #define UART8_TX_DMA_Stream       DMAx_STREAMy(RTE_UART8_TX_DMA_NUMBER, RTE_UART8_TX_DMA_STREAM)
+    #define UART8_TX_DMA_IRQn         DMAx_STREAMy_IRQn(RTE_UART8_TX_DMA_NUMBER, RTE_UART8_TX_DMA_STREAM)
+    #define UART8_TX_DMA_Channel      DMA_CHANNEL_x(RTE_UART8_TX_DMA_CHANNEL)
+    #define UART8_TX_DMA_Priority     DMA_PRIORITY(RTE_UART8_TX_DMA_PRIORITY)
+    #define UART8_TX_DMA_Handler      DMAx_STREAMy_IRQ(RTE_UART8_TX_DMA_NUMBER, RTE_UART8_TX_DMA_STREAM)
+  #endif
+
+  #if (RTE_UART8_FIFO == 1)
+    #if (((RTE_UART8_RX_FIFO_SIZE & (RTE_UART8_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_UART8_TX_FIFO_SIZE & (RTE_UART8_TX_FIFO_SIZE - 1)) != 0))
+      #error "UART8 FIFO size must be a power of two!"
+    #endif
+    #define UART8_RX_FIFO_SIZE        RTE_UART8_RX_FIFO_SIZE
+    #define UART8_TX_FIFO_SIZE        RTE_UART8_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_UART8_TX == 1)
     #if !defined (STM32F413xx) && !defined (STM32F423xx)
       // UART8 TX available on pins: PE1
@@ -529,6 +723,30 @@
 
   #define USE_UART9
 
+  #if (RTE_UART9_RX_DMA == 1)
+    #define UART9_RX_DMA_Stream       DMAx_STREAMy(RTE_UART9_RX_DMA_NUMBER, RTE_UART9_RX_DMA_STREAM)
+    #define UART9_RX_DMA_IRQn         DMAx_STREAMy_IRQn(RTE_UART9_RX_DMA_NUMBER, RTE_UART9_RX_DMA_STREAM)
+    #define UART9_RX_DMA_Channel      DMA_CHANNEL_x(RTE_UART9_RX_DMA_CHANNEL)
+    #define UART9_RX_DMA_Priority     DMA_PRIORITY(RTE_UART9_RX_DMA_PRIORITY)
+    #define UART9_RX_DMA_Handler      DMAx_STREAMy_IRQ(RTE_UART9_RX_DMA_NUMBER, RTE_UART9_RX_DMA_STREAM)
+  #endif
+  #if (RTE_UART9_TX_DMA == 1)
+    #define UART9_TX_DMA_Stream       DMAx_STREAMy(RTE_UART9_TX_DMA_NUMBER, RTE_UART9_TX_DMA_STREAM)
+    #define UART9_TX_DMA_IRQn         DMAx_STREAMy_IRQn(RTE_UART9_TX_DMA_NUMBER, RTE_UART9_TX_DMA_STREAM)
+    #define UART9_TX_DMA_Channel      DMA_CHANNEL_x(RTE_UART9_TX_DMA_CHANNEL)
+    #define UART9_TX_DMA_Priority     DMA_PRIORITY(RTE_UART9_TX_DMA_PRIORITY)
+    #define UART9_TX_DMA_Handler      DMAx_STREAMy_IRQ(RTE_UART9_TX_DMA_NUMBER, RTE_UART9_TX_DMA_STREAM)
+  #endif
+
+  #if (RTE_UART9_FIFO == 1)
+    #if (((RTE_UART9_RX_FIFO_SIZE & (RTE_UART9_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_UART9_TX_FIFO_SIZE & (RTE_UART9_TX_FIFO_SIZE - 1)) != 0))
+      #error "UART9 FIFO size must be a power of two!"
+    #endif
+    #define UART9_RX_FIFO_SIZE        RTE_UART9_RX_FIFO_SIZE
+    #define UART9_TX_FIFO_SIZE        RTE_UART9_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_UART9_TX == 1)
     #define USE_UART9_TX_Pin        1
     #define UART9_TX_GPIO_PORT      RTE_UART9_TX_PORT
@@ -558,6 +776,30 @@
 
   #define USE_UART10
 
+  #if (RTE_UART10_RX_DMA == 1)
+    #define UART10_RX_DMA_Stream      DMAx_STREAMy(RTE_UART10_RX_DMA_NUMBER, RTE_UART10_RX_DMA_STREAM)
+    #define UART10_RX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_UART10_RX_DMA_NUMBER, RTE_UART10_RX_DMA_STREAM)
+    #define UART10_RX_DMA_Channel     DMA_CHANNEL_x(RTE_UART10_RX_DMA_CHANNEL)
+    #define UART10_RX_DMA_Priority    DMA_PRIORITY(RTE_UART10_RX_DMA_PRIORITY)
+    #define UART10_RX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_UART10_RX_DMA_NUMBER, RTE_UART10_RX_DMA_STREAM)
+  #endif
+  #if (RTE_UART10_TX_DMA == 1)
+    #define UART10_TX_DMA_Stream      DMAx_STREAMy(RTE_UART10_TX_DMA_NUMBER, RTE_UART10_TX_DMA_STREAM)
+    #define UART10_TX_DMA_IRQn        DMAx_STREAMy_IRQn(RTE_UART10_TX_DMA_NUMBER, RTE_UART10_TX_DMA_STREAM)
+    #define UART10_TX_DMA_Channel     DMA_CHANNEL_x(RTE_UART10_TX_DMA_CHANNEL)
+    #define UART10_TX_DMA_Priority    DMA_PRIORITY(RTE_UART10_TX_DMA_PRIORITY)
+    #define UART10_TX_DMA_Handler     DMAx_STREAMy_IRQ(RTE_UART10_TX_DMA_NUMBER, RTE_UART10_TX_DMA_STREAM)
+  #endif
+
+  #if (RTE_UART10_FIFO == 1)
+    #if (((RTE_UART10_RX_FIFO_SIZE & (RTE_UART10_RX_FIFO_SIZE - 1)) != 0) || \
+         ((RTE_UART10_TX_FIFO_SIZE & (RTE_UART10_TX_FIFO_SIZE - 1)) != 0))
+      #error "UART10 FIFO size must be a power of two!"
+    #endif
+    #define UART10_RX_FIFO_SIZE       RTE_UART10_RX_FIFO_SIZE
+    #define UART10_TX_FIFO_SIZE       RTE_UART10_TX_FIFO_SIZE
+  #endif
+
   #if (RTE_UART10_TX == 1)
     #define USE_UART10_TX_Pin       1
     #define UART10_TX_GPIO_PORT     RTE_UART10_TX_PORT
@@ -573,6 +815,45 @@
   #endif
 #endif
 
+#if ((defined(USE_USART1) && defined(USART1_RX_DMA_Handler)) || \
+     (defined(USE_USART2) && defined(USART2_RX_DMA_Handler)) || \
+     (defined(USE_USART3) && defined(USART3_RX_DMA_Handler)) || \
+     (defined(USE_UART4) && defined(UART4_RX_DMA_Handler)) || \
+     (defined(USE_UART5) && defined(UART5_RX_DMA_Handler)) || \
+     (defined(USE_USART6) && defined(USART6_RX_DMA_Handler)) || \
+     (defined(USE_UART7) && defined(UART7_RX_DMA_Handler)) || \
+     (defined(USE_UART8) && defined(UART8_RX_DMA_Handler)) || \
+     (defined(USE_UART9) && defined(UART9_RX_DMA_Handler)) || \
+     (defined(USE_UART10) && defined(UART10_RX_DMA_Handler)))
+  #define USART_DMA_RX
+#endif
+
+#if ((defined(USE_USART1) && defined(USART1_TX_DMA_Handler)) || \
+     (defined(USE_USART2) && defined(USART2_TX_DMA_Handler)) || \
+     (defined(USE_USART3) && defined(USART3_TX_DMA_Handler)) || \
+     (defined(USE_UART4) && defined(UART4_TX_DMA_Handler)) || \
+     (defined(USE_UART5) && defined(UART5_TX_DMA_Handler)) || \
+     (defined(USE_USART6) && defined(USART6_TX_DMA_Handler)) || \
+     (defined(USE_UART7) && defined(UART7_TX_DMA_Handler)) || \
+     (defined(USE_UART8) && defined(UART8_TX_DMA_Handler)) || \
+     (defined(USE_UART9) && defined(UART9_TX_DMA_Handler)) || \
+     (defined(USE_UART10) && defined(UART10_TX_DMA_Handler)))
+  #define USART_DMA_TX
+#endif
+
+#if (defined(USART1_RX_FIFO_SIZE) || \
+     defined(USART2_RX_FIFO_SIZE) || \
+     defined(USART3_RX_FIFO_SIZE) || \
+     defined(UART4_RX_FIFO_SIZE) || \
+     defined(UART5_RX_FIFO_SIZE) || \
+     defined(USART6_RX_FIFO_SIZE) || \
+     defined(UART7_RX_FIFO_SIZE) || \
+     defined(UART8_RX_FIFO_SIZE) || \
+     defined(UART9_RX_FIFO_SIZE) || \
+     defined(UART10_RX_FIFO_SIZE))
+  #define USART_BUFFERED
+#endif
+
 // USART BRR macro
 #define USART_DIVIDER(_PCLK_, _BAUD_)           (((_PCLK_)*25)/(4*(_BAUD_)))
 #define USART_DIVIDER_MANTISA(_PCLK_, _BAUD_)     (USART_DIVIDER((_PCLK_), (_BAUD_))/100)
@@ -591,6 +872,13 @@
 #define USART_SYNC_MODE_RX           ( 2UL )
 #define USART_SYNC_MODE_TX_RX        (USART_SYNC_MODE_TX | USART_SYNC_MODE_RX)
 
+// USART driver specific control codes
+#define USART_CONTROL_RX_CIRCULAR    (0x80UL << ARM_USART_CONTROL_Pos)  ///< Circular DMA receive into ring passed to Receive; arg: 0=disabled, 1=enabled
+
+// USART driver specific events
+#define USART_EVENT_RX_HALF_FULL     (1UL << 16)  ///< Circular receive: first half of the ring filled
+#define USART_EVENT_RX_FULL          (1UL << 17)  ///< Circular receive: second half of the ring filled, write index wrapped
+
 /*******************************************************************************
  *  typedefs and structures (scope: module-local)
  ******************************************************************************/
@@ -624,8 +912,17 @@ typedef struct _USART_TRANSFER_INFO {
   uint32_t              sync_mode;      // Synchronous mode flag
   uint8_t               break_flag;     // Transmit break flag
   uint8_t               send_active;    // Send active flag
+  uint8_t               rx_circular;    // Circular DMA receive flag
 } USART_TRANSFER_INFO;
 
+// USART software FIFO (single producer, single consumer)
+typedef struct _USART_FIFO {
+  uint8_t              *buf;            // FIFO storage
+  uint32_t              size;           // FIFO size in bytes (power of two)
+  volatile uint32_t     head;           // Write index, advanced by producer only
+  volatile uint32_t     tail;           // Read index, advanced by consumer only
+} USART_FIFO;
+
 typedef struct _USART_STATUS {
   uint8_t tx_busy;                      // Transmitter busy flag
   uint8_t rx_busy;                      // Receiver busy flag
@@ -643,6 +940,8 @@ typedef struct _USART_INFO {
   uint8_t                 flags;               // Current USART flags
   uint32_t                mode;                // Current USART mode
   uint32_t                flow_control;        // Flow control
+  uint32_t                baudrate;            // Configured baudrate
+  RCC_ClockSubscriber_t   clk_sub;             // Clock change subscription
 } USART_INFO;
 
 // USART Resources definition
@@ -652,10 +951,68 @@ typedef struct USART_RESOURCES_s {
   USART_IO                io;                  // USART Input/Output pins
   IRQn_Type               irq_num;             // USART IRQ Number
   RCC_Periph_t            rcc;                 // RCC Clock/Reset registers
+  DMA_Resources_t        *tx_dma;              // Transmit stream register interface
+  DMA_Resources_t        *rx_dma;              // Receive stream register interface
+  USART_FIFO             *rx_fifo;             // Receive FIFO (buffered mode)
+  USART_FIFO             *tx_fifo;             // Transmit FIFO (buffered mode)
   USART_INFO             *info;                // Run-Time Information
   USART_TRANSFER_INFO    *xfer;                // USART transfer information
 } const USART_RESOURCES;
 
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+#ifdef USART1_RX_FIFO_SIZE
+extern int32_t USART1_Read(void *data, uint32_t num);
+extern int32_t USART1_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef USART2_RX_FIFO_SIZE
+extern int32_t USART2_Read(void *data, uint32_t num);
+extern int32_t USART2_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef USART3_RX_FIFO_SIZE
+extern int32_t USART3_Read(void *data, uint32_t num);
+extern int32_t USART3_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef UART4_RX_FIFO_SIZE
+extern int32_t USART4_Read(void *data, uint32_t num);
+extern int32_t USART4_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef UART5_RX_FIFO_SIZE
+extern int32_t USART5_Read(void *data, uint32_t num);
+extern int32_t USART5_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef USART6_RX_FIFO_SIZE
+extern int32_t USART6_Read(void *data, uint32_t num);
+extern int32_t USART6_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef UART7_RX_FIFO_SIZE
+extern int32_t USART7_Read(void *data, uint32_t num);
+extern int32_t USART7_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef UART8_RX_FIFO_SIZE
+extern int32_t USART8_Read(void *data, uint32_t num);
+extern int32_t USART8_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef UART9_RX_FIFO_SIZE
+extern int32_t USART9_Read(void *data, uint32_t num);
+extern int32_t USART9_Write(const void *data, uint32_t num);
+#endif
+
+#ifdef UART10_RX_FIFO_SIZE
+extern int32_t USART10_Read(void *data, uint32_t num);
+extern int32_t USART10_Write(const void *data, uint32_t num);
+#endif
+
 #endif /* USART_STM32F4XX_H */
 
 /* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2018 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Host test of software CRC32 for STMicroelectronics STM32F1xx
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "CRC32_STM32F10x.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define BUF_SIZE                  1536U
+#define MAC_NUM                   4096U
+#define BENCH_LOOPS               2000U
+
+#define CHECK(cond, ...)          do { if (!(cond)) { printf(__VA_ARGS__); printf("\n"); errors++; } } while (0)
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static uint8_t buf[BUF_SIZE + 4U];
+static uint8_t mac[MAC_NUM][6];
+
+static volatile uint32_t sink;
+static uint32_t errors;
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+/* Host replacement of the Cortex-M3 RBIT instruction */
+static uint32_t __RBIT(uint32_t value)
+{
+  value = ((value >> 1) & 0x55555555U) | ((value & 0x55555555U) << 1);
+  value = ((value >> 2) & 0x33333333U) | ((value & 0x33333333U) << 2);
+  value = ((value >> 4) & 0x0F0F0F0FU) | ((value & 0x0F0F0F0FU) << 4);
+  value = ((value >> 8) & 0x00FF00FFU) | ((value & 0x00FF00FFU) << 8);
+
+  return ((value >> 16) | (value << 16));
+}
+
+/* Hash filter CRC of EMAC_STM32F10x.c before the CRC32 module, verbatim */
+
+/**
+  \fn          uint32_t crc32_8bit_rev (uint32_t crc32, uint8_t val)
+  \brief       Calculate 32-bit CRC (Polynomial: 0x04C11DB7, data bit-reversed).
+  \param[in]   crc32  CRC initial value
+  \param[in]   val    Input value
+  \return      Calculated CRC value
+*/
+static uint32_t crc32_8bit_rev (uint32_t crc32, uint8_t val) {
+  uint32_t n;
+
+  crc32 ^= __RBIT (val);
+  for (n = 8; n; n--) {
+    if (crc32 & 0x80000000U) {
+      crc32 <<= 1;
+      crc32  ^= 0x04C11DB7U;
+    } else {
+      crc32 <<= 1;
+    }
+  }
+  return (crc32);
+}
+
+/**
+  \fn          uint32_t crc32_data (const uint8_t *data, uint32_t len)
+  \brief       Calculate standard 32-bit Ethernet CRC.
+  \param[in]   data  Pointer to buffer containing the data
+  \param[in]   len   Data length in bytes
+  \return      Calculated CRC value
+*/
+static uint32_t crc32_data (const uint8_t *data, uint32_t len) {
+  uint32_t cnt, crc;
+
+  crc = 0xFFFFFFFFU;
+  for (cnt = len; cnt; cnt--) {
+    crc = crc32_8bit_rev (crc, *data++);
+  }
+  return (crc ^ 0xFFFFFFFFU);
+}
+
+static double Now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/* All lengths at every word misalignment against the old routine */
+static void TestData(void)
+{
+  uint32_t crc, ref;
+
+  /* Standard check value */
+  crc = CRC32_Calculate("123456789", 9U);
+  CHECK(crc == 0xCBF43926U, "check value: 0x%08X, expected 0xCBF43926", crc);
+
+  for (uint32_t ofs = 0U; ofs < 4U; ofs++) {
+    for (uint32_t len = 0U; len <= BUF_SIZE; len++) {
+      ref = __RBIT(crc32_data(&buf[ofs], len));
+
+      crc = CRC32_Calculate(&buf[ofs], len);
+      CHECK(crc == ref, "offset %u length %u: 0x%08X, expected 0x%08X", ofs, len, crc, ref);
+
+      /* Same result when split into two updates */
+      crc = CRC32_Update(CRC32_INIT, &buf[ofs], len / 3U);
+      crc = CRC32_Update(crc, &buf[ofs + len / 3U], len - len / 3U) ^ CRC32_XOROUT;
+      CHECK(crc == ref, "offset %u length %u split: 0x%08X, expected 0x%08X", ofs, len, crc, ref);
+    }
+  }
+}
+
+/* Hash filter index of SetAddressFilter, old and new expression */
+static void TestHashIndex(void)
+{
+  uint32_t hits[64] = { 0U };
+
+  for (uint32_t i = 0U; i < MAC_NUM; i++) {
+    uint32_t idx = __RBIT(CRC32_Calculate(&mac[i][0], 6U)) >> 26;
+    uint32_t ref = crc32_data(&mac[i][0], 6U) >> 26;
+
+    CHECK(idx == ref, "%02X:%02X:%02X:%02X:%02X:%02X: hash index %u, expected %u",
+          mac[i][0], mac[i][1], mac[i][2], mac[i][3], mac[i][4], mac[i][5], idx, ref);
+    hits[idx]++;
+  }
+
+  /* Sanity of the address set: every hash bit used */
+  for (uint32_t i = 0U; i < 64U; i++)
+    CHECK(hits[i] != 0U, "hash index %u never hit", i);
+}
+
+/* Frame and MAC address CRC, this build's method and the old routine */
+static void Benchmark(void)
+{
+  double t_new, t_old;
+  uint32_t acc = 0U;
+
+  t_new = Now();
+  for (uint32_t i = 0U; i < BENCH_LOOPS; i++)
+    acc += CRC32_Calculate(buf, BUF_SIZE);
+  t_new = (Now() - t_new) / BENCH_LOOPS;
+
+  t_old = Now();
+  for (uint32_t i = 0U; i < BENCH_LOOPS; i++)
+    acc += crc32_data(buf, BUF_SIZE);
+  t_old = (Now() - t_old) / BENCH_LOOPS;
+
+  printf("%u byte frame: %.2f ns/byte, old routine %.2f ns/byte\n",
+         BUF_SIZE, t_new / BUF_SIZE, t_old / BUF_SIZE);
+
+  t_new = Now();
+  for (uint32_t i = 0U; i < MAC_NUM; i++)
+    acc += __RBIT(CRC32_Calculate(&mac[i][0], 6U)) >> 26;
+  t_new = (Now() - t_new) / MAC_NUM;
+
+  t_old = Now();
+  for (uint32_t i = 0U; i < MAC_NUM; i++)
+    acc += crc32_data(&mac[i][0], 6U) >> 26;
+  t_old = (Now() - t_old) / MAC_NUM;
+
+  printf("MAC hash index: %.1f ns, old routine %.1f ns\n", t_new, t_old);
+
+  sink = acc;
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+int main(void)
+{
+  static const char *const method_name[] = { "nibble", "byte", "slice-by-4" };
+
+  srand(1U);
+  for (uint32_t i = 0U; i < sizeof(buf); i++)
+    buf[i] = (uint8_t)rand();
+
+  /* IPv4 and IPv6 multicast groups and random group addresses */
+  for (uint32_t i = 0U; i < MAC_NUM; i++) {
+    uint32_t r = (uint32_t)rand();
+
+    switch (i % 3U) {
+      case 0U:
+        mac[i][0] = 0x01U; mac[i][1] = 0x00U; mac[i][2] = 0x5EU;
+        mac[i][3] = (uint8_t)(r & 0x7FU);
+        break;
+      case 1U:
+        mac[i][0] = 0x33U; mac[i][1] = 0x33U; mac[i][2] = (uint8_t)(r >> 16);
+        mac[i][3] = (uint8_t)(r >> 24);
+        break;
+      default:
+        mac[i][0] = (uint8_t)(r | 0x01U); mac[i][1] = (uint8_t)(r >> 8);
+        mac[i][2] = (uint8_t)(r >> 16);   mac[i][3] = (uint8_t)(r >> 24);
+        break;
+    }
+    mac[i][4] = (uint8_t)rand();
+    mac[i][5] = (uint8_t)rand();
+  }
+
+  TestData();
+  TestHashIndex();
+
+  printf("CRC32 method %u (%s)\n", (unsigned)CRC32_METHOD, method_name[CRC32_METHOD]);
+  Benchmark();
+
+  printf("CRC32 method %u: %s\n", (unsigned)CRC32_METHOD, (errors != 0U) ? "FAILED" : "passed");
+
+  return (errors != 0U) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* ----------------------------- End of file ---------------------------------*/
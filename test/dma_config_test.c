@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2019 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Host test of DMA stream reconfiguration for STMicroelectronics STM32F4xx
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "stm32f4_mock.h"
+#include "DMA_STM32F4xx.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define BUF_SIZE                  4096U
+#define BENCH_LOOPS               100000U
+
+/* CR bits owned by the driver at run time */
+#define CR_RUNTIME_Msk            (DMA_SxCR_EN | DMA_SxCR_TCIE | DMA_SxCR_HTIE)
+
+#define CHECK(cond, ...)          do { if (!(cond)) { printf(__VA_ARGS__); printf("\n"); errors++; } } while (0)
+
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+static void StreamEvent(uint32_t event);
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static DMA_Handle_t Stream_Handle;
+static DMA_Resources_t Stream = {
+  &Stream_Handle,
+  DMA2_Stream0,
+  DMA_CHANNEL_0,
+  DMA_PRIORITY_HIGH,
+  StreamEvent,
+  0U,
+  DMA2_Stream0_IRQn,
+  DMA_REQUEST_MEM2MEM,
+};
+
+static uint8_t *src_buf;
+static uint8_t *dst_buf;
+static uint32_t events;
+static uint32_t errors;
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static void StreamEvent(uint32_t event)
+{
+  events |= event;
+}
+
+static void StreamHandler(void)
+{
+  DMA_IRQ_Handle(&Stream);
+}
+
+static double Now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static void SetConfig(DMA_MemDataAlign_t msize, DMA_PerDataAlign_t psize, DMA_FIFOMode_t fifo)
+{
+  DMA_StreamConfig_t *cfg = &Stream_Handle.config;
+
+  cfg->Direction     = DMA_DIR_MEM_TO_MEM;
+  cfg->PerInc        = DMA_PINC_ENABLE;
+  cfg->MemInc        = DMA_MINC_ENABLE;
+  cfg->PerDataAlign  = psize;
+  cfg->MemDataAlign  = msize;
+  cfg->Mode          = DMA_MODE_NORMAL;
+  cfg->FIFOMode      = fifo;
+  cfg->FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+  cfg->MemBurst      = DMA_MBURST_SINGLE;
+  cfg->PerBurst      = DMA_PBURST_SINGLE;
+}
+
+/* Configure, start and complete one transfer, return CR as started */
+static uint32_t Transfer(uint32_t num)
+{
+  uint32_t cr;
+
+  for (uint32_t i = 0U; i < num; i++)
+    src_buf[i] = (uint8_t)rand();
+  memset(dst_buf, 0, num);
+
+  events = 0U;
+
+  DMA_StreamConfig(&Stream);
+  DMA_StreamEnable(&Stream, (uint32_t)(uintptr_t)src_buf, (uint32_t)(uintptr_t)dst_buf, num);
+
+  cr = Stream.stream->CR;
+
+  CHECK(Stream.stream->NDTR == num, "NDTR %u, expected %u", Stream.stream->NDTR, num);
+  CHECK(Stream.stream->PAR  == (uint32_t)(uintptr_t)src_buf, "PAR not written");
+  CHECK(Stream.stream->M0AR == (uint32_t)(uintptr_t)dst_buf, "M0AR not written");
+
+  MOCK_DMARun();
+
+  CHECK(events == DMA_EVENT_TRANSFER_COMPLETE, "events 0x%X", events);
+  CHECK(Stream_Handle.state == DMA_STATE_READY, "state %u after transfer", Stream_Handle.state);
+
+  return cr;
+}
+
+/* Fast path leaves the registers as the full configuration writes them */
+static void TestRearm(void)
+{
+  uint32_t cr_full, cr_fast, fcr_full;
+
+  SetConfig(DMA_MDATAALIGN_WORD, DMA_PDATAALIGN_WORD, DMA_FIFOMODE_ENABLE);
+
+  cr_full  = Transfer(256U);
+  fcr_full = Stream.stream->FCR;
+  CHECK(memcmp(dst_buf, src_buf, 1024U) == 0, "rearm: first transfer data mismatch");
+
+  /* Interrupt enable set by the user is kept on both paths */
+  Stream.stream->CR |= DMA_SxCR_TEIE;
+
+  cr_fast = Transfer(64U);
+  CHECK(memcmp(dst_buf, src_buf, 256U) == 0, "rearm: second transfer data mismatch");
+  CHECK((cr_fast & ~(CR_RUNTIME_Msk | DMA_SxCR_TEIE)) == (cr_full & ~CR_RUNTIME_Msk),
+        "rearm: CR 0x%08X, full configuration 0x%08X", cr_fast, cr_full);
+  CHECK(cr_fast & DMA_SxCR_TEIE, "rearm: TEIE lost");
+  CHECK(Stream.stream->FCR == fcr_full, "rearm: FCR 0x%08X, full configuration 0x%08X", Stream.stream->FCR, fcr_full);
+
+  /* Changed data size takes the full path */
+  SetConfig(DMA_MDATAALIGN_BYTE, DMA_PDATAALIGN_BYTE, DMA_FIFOMODE_DISABLE);
+
+  cr_fast = Transfer(100U);
+  CHECK(memcmp(dst_buf, src_buf, 100U) == 0, "rearm: byte transfer data mismatch");
+  CHECK((cr_fast & (DMA_SxCR_MSIZE | DMA_SxCR_PSIZE)) == 0U, "rearm: data size not updated, CR 0x%08X", cr_fast);
+  CHECK((Stream.stream->FCR & DMA_SxFCR_DMDIS) == 0U, "rearm: FIFO mode not updated, FCR 0x%08X", Stream.stream->FCR);
+  CHECK(cr_fast & DMA_SxCR_TEIE, "rearm: TEIE lost on full path");
+}
+
+/* Double buffer mode is not carried into the next single buffer transfer */
+static void TestDoubleBuffer(void)
+{
+  uint32_t cr;
+
+  SetConfig(DMA_MDATAALIGN_WORD, DMA_PDATAALIGN_WORD, DMA_FIFOMODE_DISABLE);
+  Stream_Handle.config.Direction = DMA_DIR_PER_TO_MEM;
+  Stream_Handle.config.PerInc    = DMA_PINC_DISABLE;
+
+  DMA_StreamConfig(&Stream);
+  DMA_StreamEnableDoubleBuffer(&Stream, (uint32_t)(uintptr_t)src_buf, (uint32_t)(uintptr_t)dst_buf,
+                               (uint32_t)(uintptr_t)&dst_buf[BUF_SIZE / 2U], 16U);
+  CHECK(Stream.stream->CR & DMA_SxCR_DBM, "double buffer: DBM not set");
+
+  /* Disabled stream reports transfer complete */
+  DMA_StreamDisable(&Stream);
+  MOCK_DMATransfer();
+  DMA2->LISR |= DMA_LISR_TCIF0;
+  MOCK_IRQService();
+  CHECK(Stream_Handle.state == DMA_STATE_READY, "double buffer: state %u after abort", Stream_Handle.state);
+
+  SetConfig(DMA_MDATAALIGN_WORD, DMA_PDATAALIGN_WORD, DMA_FIFOMODE_DISABLE);
+  cr = Transfer(32U);
+  CHECK((cr & (DMA_SxCR_DBM | DMA_SxCR_CIRC)) == 0U, "double buffer: CR 0x%08X after single buffer setup", cr);
+  CHECK(memcmp(dst_buf, src_buf, 128U) == 0, "double buffer: data mismatch");
+}
+
+/*
+ * Setup latency of DMA_StreamConfig and DMA_StreamEnable for an unchanged
+ * configuration. The full path is forced by invalidating the recorded
+ * configuration, as every call did before. Host timing gives the ratio
+ * only, register accesses are much slower on the target.
+ */
+static void Benchmark(void)
+{
+  double t_full, t_fast;
+
+  SetConfig(DMA_MDATAALIGN_WORD, DMA_PDATAALIGN_WORD, DMA_FIFOMODE_ENABLE);
+  Transfer(16U);
+
+  /* Transfers are completed by hand, only the stream setup is repeated */
+  t_full = Now();
+  for (uint32_t i = 0U; i < BENCH_LOOPS; i++) {
+    Stream_Handle.cr = ~0U;
+    DMA_StreamConfig(&Stream);
+    DMA_StreamEnable(&Stream, (uint32_t)(uintptr_t)src_buf, (uint32_t)(uintptr_t)dst_buf, 16U);
+    Stream.stream->CR &= ~DMA_SxCR_EN;
+    Stream_Handle.state = DMA_STATE_READY;
+  }
+  t_full = (Now() - t_full) / BENCH_LOOPS;
+
+  t_fast = Now();
+  for (uint32_t i = 0U; i < BENCH_LOOPS; i++) {
+    DMA_StreamConfig(&Stream);
+    DMA_StreamEnable(&Stream, (uint32_t)(uintptr_t)src_buf, (uint32_t)(uintptr_t)dst_buf, 16U);
+    Stream.stream->CR &= ~DMA_SxCR_EN;
+    Stream_Handle.state = DMA_STATE_READY;
+  }
+  t_fast = (Now() - t_fast) / BENCH_LOOPS;
+
+  printf("Stream setup: full %.1f ns, unchanged configuration %.1f ns\n", t_full, t_fast);
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+int main(void)
+{
+  if (MOCK_Initialize() != 0) {
+    printf("Peripheral address range not available\n");
+    return EXIT_FAILURE;
+  }
+
+  src_buf = MOCK_Alloc(BUF_SIZE);
+  dst_buf = MOCK_Alloc(BUF_SIZE);
+
+  MOCK_IRQAttach(DMA2_Stream0_IRQn, StreamHandler);
+
+  if (DMA_Initialize(&Stream) != ARM_DRIVER_OK) {
+    printf("DMA_Initialize failed\n");
+    return EXIT_FAILURE;
+  }
+
+  srand(1U);
+
+  TestRearm();
+  TestDoubleBuffer();
+
+  Benchmark();
+
+  DMA_Uninitialize(&Stream);
+
+  printf("DMA stream configuration: %s\n", (errors != 0U) ? "FAILED" : "passed");
+
+  return (errors != 0U) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* ----------------------------- End of file ---------------------------------*/
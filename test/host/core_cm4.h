@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2019 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Host replacement of the Cortex-M4 core header for driver tests
+ */
+
+#ifndef CORE_CM4_H_
+#define CORE_CM4_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/*******************************************************************************
+ *  defines and macros
+ ******************************************************************************/
+
+#define __I                       volatile const
+#define __O                       volatile
+#define __IO                      volatile
+#define __IM                      volatile const
+#define __OM                      volatile
+#define __IOM                     volatile
+
+#define __STATIC_INLINE           static inline
+#define __WEAK                    __attribute__((weak))
+#define __ALIGNED(x)              __attribute__((aligned(x)))
+
+/*******************************************************************************
+ *  exported variables
+ ******************************************************************************/
+
+extern uint32_t host_primask;
+
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority);
+
+/*******************************************************************************
+ *  inline functions
+ ******************************************************************************/
+
+__STATIC_INLINE uint32_t __get_PRIMASK(void)        { return host_primask; }
+__STATIC_INLINE void     __set_PRIMASK(uint32_t pm) { host_primask = pm;   }
+__STATIC_INLINE void     __disable_irq(void)        { host_primask = 1U;   }
+__STATIC_INLINE void     __enable_irq(void)         { host_primask = 0U;   }
+
+__STATIC_INLINE void     __DSB(void)                { __sync_synchronize(); }
+__STATIC_INLINE void     __DMB(void)                { __sync_synchronize(); }
+__STATIC_INLINE void     __ISB(void)                { }
+__STATIC_INLINE void     __NOP(void)                { }
+
+#endif /* CORE_CM4_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2019 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Host model of STM32F4xx peripherals for driver tests
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <string.h>
+#include <sys/mman.h>
+
+#include "stm32f4_mock.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+/* Mapped peripheral range: APB1, APB2 and AHB1 including RCC and DMA */
+#define MOCK_PERIPH_SIZE          (0x00080000U)
+
+#define MOCK_IRQ_NUM              (128U)
+
+/* Stream flags in LISR/HISR: FEIF, DMEIF, TEIF, HTIF, TCIF */
+#define MOCK_DMA_FLAGS            (0x3DU)
+#define MOCK_DMA_TEIF             (0x08U)
+#define MOCK_DMA_HTIF             (0x10U)
+#define MOCK_DMA_TCIF             (0x20U)
+
+/*******************************************************************************
+ *  global variable definitions  (scope: module-exported)
+ ******************************************************************************/
+
+uint32_t host_primask;
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static MOCK_IRQHandler_t irq_handler[MOCK_IRQ_NUM];
+static uint8_t           irq_enabled[MOCK_IRQ_NUM];
+
+static const uint8_t flag_offset[4] = { 0U, 6U, 16U, 22U };
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static DMA_Stream_TypeDef *StreamReg(uint32_t idx)
+{
+  uint32_t base = (idx < 8U) ? DMA1_BASE : DMA2_BASE;
+
+  return (DMA_Stream_TypeDef *)(uintptr_t)(base + 0x10U + ((idx & 7U) * 0x18U));
+}
+
+static volatile uint32_t *StreamISR(uint32_t idx)
+{
+  DMA_TypeDef *dma = (idx < 8U) ? DMA1 : DMA2;
+
+  return ((idx & 4U) != 0U) ? &dma->HISR : &dma->LISR;
+}
+
+static IRQn_Type StreamIRQn(uint32_t idx)
+{
+  static const IRQn_Type irqn[16] = {
+    DMA1_Stream0_IRQn, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn,
+    DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, DMA1_Stream7_IRQn,
+    DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn,
+    DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn,
+  };
+
+  return irqn[idx];
+}
+
+#if defined(CCMDATARAM_BASE)
+static int InCCM(uint32_t addr, uint32_t num)
+{
+  return ((addr <= CCMDATARAM_END) && ((addr + num) > CCMDATARAM_BASE));
+}
+#endif
+
+/* Flag clear registers are write-only, apply what the driver wrote last */
+static void ApplyIFCR(void)
+{
+  DMA_TypeDef *dma[2] = { DMA1, DMA2 };
+
+  for (uint32_t i = 0U; i < 2U; i++) {
+    dma[i]->LISR &= ~dma[i]->LIFCR;
+    dma[i]->HISR &= ~dma[i]->HIFCR;
+    dma[i]->LIFCR = 0U;
+    dma[i]->HIFCR = 0U;
+  }
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+int32_t MOCK_Initialize(void)
+{
+  void *ptr;
+
+  ptr = mmap((void *)PERIPH_BASE, MOCK_PERIPH_SIZE, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+  if (ptr != (void *)PERIPH_BASE)
+    return -1;
+
+#if defined(CCMDATARAM_BASE)
+  ptr = mmap((void *)CCMDATARAM_BASE, CCMDATARAM_END - CCMDATARAM_BASE + 1U, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+  if (ptr != (void *)CCMDATARAM_BASE)
+    return -1;
+#endif
+
+  /* Reset values of the stream FIFO control registers */
+  for (uint32_t idx = 0U; idx < 16U; idx++)
+    StreamReg(idx)->FCR = 0x21U;
+
+  return 0;
+}
+
+void *MOCK_Alloc(size_t size)
+{
+  void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+
+  return (ptr != MAP_FAILED) ? ptr : NULL;
+}
+
+void MOCK_IRQAttach(IRQn_Type irq, MOCK_IRQHandler_t handler)
+{
+  irq_handler[irq] = handler;
+}
+
+void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  irq_enabled[IRQn] = 1U;
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  irq_enabled[IRQn] = 0U;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+  (void)IRQn;
+}
+
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+  (void)IRQn;
+  (void)priority;
+}
+
+uint32_t MOCK_DMATransfer(void)
+{
+  uint32_t cnt = 0U;
+
+  ApplyIFCR();
+
+  for (uint32_t idx = 0U; idx < 16U; idx++) {
+    DMA_Stream_TypeDef *stream = StreamReg(idx);
+    uint32_t cr = stream->CR;
+
+    if (((cr & DMA_SxCR_EN) == 0U) || ((cr & DMA_SxCR_DIR) != DMA_SxCR_DIR_1))
+      continue;
+
+    uint32_t size = 1U << ((cr & DMA_SxCR_PSIZE) >> DMA_SxCR_PSIZE_Pos);
+    uint8_t *src  = (uint8_t *)(uintptr_t)stream->PAR;
+    uint8_t *dst  = (uint8_t *)(uintptr_t)stream->M0AR;
+
+#if defined(CCMDATARAM_BASE)
+    /* CCM data RAM is not on the bus matrix, DMA access is a bus error */
+    if (InCCM(stream->PAR, (cr & DMA_SxCR_PINC) ? stream->NDTR * size : size) ||
+        InCCM(stream->M0AR, (cr & DMA_SxCR_MINC) ? stream->NDTR * size : size)) {
+      stream->CR &= ~DMA_SxCR_EN;
+      *StreamISR(idx) |= (uint32_t)MOCK_DMA_TEIF << flag_offset[idx & 3U];
+      cnt++;
+      continue;
+    }
+#endif
+
+    for (uint32_t n = stream->NDTR; n != 0U; n--) {
+      memcpy(dst, src, size);
+      if (cr & DMA_SxCR_PINC)
+        src += size;
+      if (cr & DMA_SxCR_MINC)
+        dst += size;
+    }
+
+    stream->NDTR = 0U;
+    stream->CR  &= ~DMA_SxCR_EN;
+    *StreamISR(idx) |= (uint32_t)(MOCK_DMA_HTIF | MOCK_DMA_TCIF) << flag_offset[idx & 3U];
+    cnt++;
+  }
+
+  return cnt;
+}
+
+uint32_t MOCK_IRQService(void)
+{
+  uint32_t cnt = 0U;
+
+  if (host_primask != 0U)
+    return 0U;
+
+  ApplyIFCR();
+
+  for (uint32_t idx = 0U; idx < 16U; idx++) {
+    IRQn_Type irq = StreamIRQn(idx);
+    uint32_t flags = (*StreamISR(idx) >> flag_offset[idx & 3U]) & MOCK_DMA_FLAGS;
+
+    if ((flags == 0U) || (irq_enabled[irq] == 0U) || (irq_handler[irq] == NULL))
+      continue;
+
+    irq_handler[irq]();
+    cnt++;
+
+    ApplyIFCR();
+
+    /* Flags without interrupt enable stay pending in hardware, drop them here */
+    *StreamISR(idx) &= ~((uint32_t)MOCK_DMA_FLAGS << flag_offset[idx & 3U]);
+  }
+
+  return cnt;
+}
+
+void MOCK_DMARun(void)
+{
+  while ((MOCK_DMATransfer() + MOCK_IRQService()) != 0U);
+}
+
+/* ----------------------------- End of file ---------------------------------*/
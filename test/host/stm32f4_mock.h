@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2019 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Host model of STM32F4xx peripherals for driver tests
+ */
+
+#ifndef STM32F4_MOCK_H_
+#define STM32F4_MOCK_H_
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "stm32f4xx.h"
+
+/*******************************************************************************
+ *  typedefs and structures
+ ******************************************************************************/
+
+typedef void (*MOCK_IRQHandler_t)(void);
+
+/*******************************************************************************
+ *  exported function prototypes
+ ******************************************************************************/
+
+/**
+ * @fn          int32_t MOCK_Initialize(void)
+ * @brief       Map peripheral and CCM RAM address ranges of the device at
+ *              their physical addresses, so drivers can keep 32-bit casts.
+ * @return      0 on success, -1 when the address ranges are not available
+ */
+int32_t MOCK_Initialize(void);
+
+/**
+ * @fn          void *MOCK_Alloc(size_t size)
+ * @brief       Allocate memory reachable through a 32-bit address.
+ * @param[in]   size  Number of bytes
+ * @return      Pointer to zeroed memory, NULL on failure
+ */
+void *MOCK_Alloc(size_t size);
+
+/**
+ * @fn          void MOCK_IRQAttach(IRQn_Type irq, MOCK_IRQHandler_t handler)
+ * @brief       Register interrupt handler called by \ref MOCK_IRQService.
+ * @param[in]   irq      Interrupt number
+ * @param[in]   handler  Interrupt handler
+ */
+void MOCK_IRQAttach(IRQn_Type irq, MOCK_IRQHandler_t handler);
+
+/**
+ * @fn          uint32_t MOCK_DMATransfer(void)
+ * @brief       Complete all enabled memory to memory streams: copy data,
+ *              clear NDTR and EN and raise the transfer complete flags.
+ * @return      Number of completed transfers
+ */
+uint32_t MOCK_DMATransfer(void);
+
+/**
+ * @fn          uint32_t MOCK_IRQService(void)
+ * @brief       Call the handlers of enabled DMA stream interrupts with
+ *              pending flags, unless interrupts are masked. Flags written
+ *              to the clear registers are applied after each handler.
+ * @return      Number of handlers called
+ */
+uint32_t MOCK_IRQService(void);
+
+/**
+ * @fn          void MOCK_DMARun(void)
+ * @brief       Run transfers and interrupts until all streams are idle.
+ */
+void MOCK_DMARun(void);
+
+#endif /* STM32F4_MOCK_H_ */
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2019 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Host test of I2C TIMINGR solver for STMicroelectronics STM32F0xx
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/*******************************************************************************
+ *  I2C_BUS_CFG, I2C_Charac and I2C_SolveTiming from the driver
+ ******************************************************************************/
+
+#include "i2c_timing_solve.inc"
+
+/*******************************************************************************
+ *  typedefs and structures (scope: module-local)
+ ******************************************************************************/
+
+typedef struct {
+  int16_t               rise_time;
+  int16_t               fall_time;
+} BUS_EDGES;
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static const uint32_t clk_list[] = {
+  1000000U, 2000000U, 4000000U, 8000000U, 12000000U, 14000000U,
+  16000000U, 24000000U, 32000000U, 36000000U, 40000000U, 48000000U
+};
+
+/* Rise and fall times: ideal bus, RTE_Device.h default, bus limits of UM10204 */
+static const BUS_EDGES edge_list[] = {
+  {    0,   0 },
+  {  100,  10 },
+  {  120, 120 },
+  {  300, 300 },
+  { 1000, 300 },
+};
+
+static const uint8_t dnf_list[] = { 0U, 3U, 15U };
+
+static const char *const speed_name[] = { "Sm", "Fm", "Fm+" };
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+/**
+ * @fn          uint32_t reference(uint32_t clk, const I2C_CHARAC *ch, I2C_BUS_CFG *bus)
+ * @brief       I2C_GetTiming of the STM32Cube BSP bus drivers, with rise/fall
+ *              times and filters taken from the bus configuration. Searches
+ *              every PRESC, SCLDEL, SDADEL, SCLL and SCLH.
+ * @return      TIMINGR value, 0 if none is valid
+ */
+static uint32_t reference(uint32_t clk, const I2C_CHARAC *ch, I2C_BUS_CFG *bus)
+{
+  uint32_t valid_presc[16], valid_scldel[16], valid_sdadel[16];
+  uint32_t valid_nbr = 0U, prev_presc = 16U;
+  uint32_t ti2cclk, ti2cspeed, tafdel_min, tafdel_max, dnf_delay;
+  uint32_t clk_min, clk_max, prev_error, timing = 0U;
+  int32_t tsdadel_min, tsdadel_max, tscldel_min;
+
+  ti2cclk = (1000000000UL + (clk / 2U)) / clk;
+
+  tafdel_min = bus->analog_filter ? 50U : 0U;
+  tafdel_max = bus->analog_filter ? 260U : 0U;
+
+  tsdadel_min = bus->fall_time + ch->hddat_min - (int32_t)tafdel_min -
+                ((bus->digital_filter + 3) * (int32_t)ti2cclk);
+  tsdadel_max = ch->vddat_max - bus->rise_time - (int32_t)tafdel_max -
+                ((bus->digital_filter + 4) * (int32_t)ti2cclk);
+  tscldel_min = bus->rise_time + ch->sudat_min;
+
+  if (tsdadel_min <= 0)
+    tsdadel_min = 0;
+  if (tsdadel_max <= 0)
+    tsdadel_max = 0;
+
+  for (uint32_t presc = 0U; presc < 16U; presc++) {
+    for (uint32_t scldel = 0U; scldel < 16U; scldel++) {
+      uint32_t tscldel = (scldel + 1U) * (presc + 1U) * ti2cclk;
+
+      if (tscldel < (uint32_t)tscldel_min)
+        continue;
+
+      for (uint32_t sdadel = 0U; sdadel < 16U; sdadel++) {
+        uint32_t tsdadel = sdadel * (presc + 1U) * ti2cclk;
+
+        if ((tsdadel >= (uint32_t)tsdadel_min) && (tsdadel <= (uint32_t)tsdadel_max) &&
+            (presc != prev_presc)) {
+          valid_presc[valid_nbr]  = presc;
+          valid_scldel[valid_nbr] = scldel;
+          valid_sdadel[valid_nbr] = sdadel;
+          prev_presc = presc;
+          valid_nbr++;
+        }
+      }
+    }
+  }
+
+  ti2cspeed = (1000000000UL + (ch->freq / 2U)) / ch->freq;
+  dnf_delay = bus->digital_filter * ti2cclk;
+  clk_max   = 1000000000UL / ch->freq_min;
+  clk_min   = 1000000000UL / ch->freq_max;
+
+  prev_error = ti2cspeed;
+
+  for (uint32_t count = 0U; count < valid_nbr; count++) {
+    uint32_t tpresc = (valid_presc[count] + 1U) * ti2cclk;
+
+    for (uint32_t scll = 0U; scll < 256U; scll++) {
+      uint32_t tscl_l = tafdel_min + dnf_delay + (2U * ti2cclk) + ((scll + 1U) * tpresc);
+
+      if ((tscl_l <= (uint32_t)ch->lscl_min) || (ti2cclk >= ((tscl_l - tafdel_min - dnf_delay) / 4U)))
+        continue;
+
+      for (uint32_t sclh = 0U; sclh < 256U; sclh++) {
+        uint32_t tscl_h = tafdel_min + dnf_delay + (2U * ti2cclk) + ((sclh + 1U) * tpresc);
+        uint32_t tscl   = tscl_l + tscl_h + bus->rise_time + bus->fall_time;
+        int32_t error;
+
+        if ((tscl < clk_min) || (tscl > clk_max) || (tscl_h < (uint32_t)ch->hscl_min) || (ti2cclk >= tscl_h))
+          continue;
+
+        error = (int32_t)tscl - (int32_t)ti2cspeed;
+        if (error < 0)
+          error = -error;
+
+        if ((uint32_t)error < prev_error) {
+          prev_error = (uint32_t)error;
+          timing = (valid_presc[count] << 28) | (valid_scldel[count] << 20) |
+                   (valid_sdadel[count] << 16) | (sclh << 8) | scll;
+        }
+      }
+    }
+  }
+
+  return (timing);
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+int main(void)
+{
+  uint32_t errors = 0U, cases = 0U;
+
+  for (uint32_t i = 0U; i < sizeof(clk_list) / sizeof(clk_list[0]); i++) {
+    for (uint32_t j = 0U; j < sizeof(edge_list) / sizeof(edge_list[0]); j++) {
+      for (uint32_t af = 0U; af < 2U; af++) {
+        for (uint32_t k = 0U; k < sizeof(dnf_list) / sizeof(dnf_list[0]); k++) {
+          I2C_BUS_CFG bus = {
+            edge_list[j].rise_time, edge_list[j].fall_time, (uint8_t)af, dnf_list[k], 0U
+          };
+
+          for (uint32_t speed = 0U; speed < 3U; speed++) {
+            uint32_t timing = I2C_SolveTiming(clk_list[i], &I2C_Charac[speed], &bus);
+            uint32_t expect = reference(clk_list[i], &I2C_Charac[speed], &bus);
+
+            /* Print the RTE_Device.h default bus */
+            if ((j == 1U) && (af == 1U) && (k == 0U))
+              printf("  %2u MHz %-3s TIMINGR 0x%08X\n", clk_list[i] / 1000000U, speed_name[speed], timing);
+
+            if (timing != expect) {
+              printf("    %u Hz %s tr %d tf %d af %u dnf %u: 0x%08X, reference 0x%08X\n",
+                     clk_list[i], speed_name[speed], bus.rise_time, bus.fall_time,
+                     af, dnf_list[k], timing, expect);
+              errors++;
+            }
+            cases++;
+          }
+        }
+      }
+    }
+  }
+
+  /* No clock, no setting */
+  {
+    I2C_BUS_CFG bus = { 100, 10, 1U, 0U, 0U };
+
+    if (I2C_SolveTiming(0U, &I2C_Charac[0], &bus) != 0U) {
+      printf("    setting for 0 Hz kernel clock\n");
+      errors++;
+    }
+  }
+
+  printf("I2C timing solver: %u cases, %s\n", cases, (errors != 0U) ? "FAILED" : "passed");
+
+  return (errors != 0U) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* ----------------------------- End of file ---------------------------------*/
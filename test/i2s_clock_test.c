@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2019 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Host test of I2S clock solver for STMicroelectronics STM32F4xx
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define RCC_FREQ_PLL_IN           0U
+
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+static uint32_t RCC_GetFreq(uint32_t type);
+
+/*******************************************************************************
+ *  I2S_Clock_t, clock cache and I2S_ClockSolve from the driver
+ ******************************************************************************/
+
+#include "i2s_clock_solve.inc"
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static uint32_t pll_in;
+
+static const uint32_t pll_in_list[] = { 1000000U, 2000000U };
+static const uint32_t ratio_list[]  = { 32U, 64U, 256U };
+static const uint32_t freq_list[]   = {
+  8000U, 11025U, 16000U, 22050U, 32000U, 44100U, 48000U, 88200U, 96000U, 176400U, 192000U
+};
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static uint32_t RCC_GetFreq(uint32_t type)
+{
+  (void)type;
+  return (pll_in);
+}
+
+/**
+ * @fn          double search(uint32_t freq, uint32_t ratio)
+ * @brief       Exhaustive search over all PLLI2SN, PLLI2SR and prescaler values.
+ * @return      Smallest absolute sample rate error in Hz, negative if none
+ */
+static double search(uint32_t freq, uint32_t ratio)
+{
+  double best = -1.0;
+
+  for (uint32_t r = 2U; r <= 7U; r++) {
+    for (uint32_t n = 50U; n <= 432U; n++) {
+      uint64_t vco = (uint64_t)pll_in * n;
+
+      if ((vco < 100000000U) || (vco > 432000000U) || ((vco / r) > 192000000U))
+        continue;
+
+      for (uint32_t k = 4U; k <= 511U; k++) {
+        double err = (double)vco / ((double)r * ratio * k) - freq;
+
+        if (err < 0.0)
+          err = -err;
+        if ((best < 0.0) || (err < best))
+          best = err;
+      }
+    }
+  }
+
+  return (best);
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+int main(void)
+{
+  uint32_t errors = 0U;
+
+  for (uint32_t i = 0U; i < sizeof(pll_in_list) / sizeof(pll_in_list[0]); i++) {
+    pll_in = pll_in_list[i];
+
+    printf("PLL input %u Hz\n", pll_in);
+    printf("  %6s %5s %4s %2s %3s %10s %6s\n", "fs", "ratio", "N", "R", "div", "actual", "ppm");
+
+    for (uint32_t j = 0U; j < sizeof(ratio_list) / sizeof(ratio_list[0]); j++) {
+      for (uint32_t m = 0U; m < sizeof(freq_list) / sizeof(freq_list[0]); m++) {
+        uint32_t ratio = ratio_list[j];
+        uint32_t freq  = freq_list[m];
+        const I2S_Clock_t *clk = I2S_ClockSolve(freq, ratio);
+        double best = search(freq, ratio);
+        double fs, err, ppm;
+
+        if (clk == NULL) {
+          printf("  %6u %5u %27s\n", freq, ratio, "no setting");
+          if (best >= 0.0) {
+            printf("    setting with error %.3f Hz exists\n", best);
+            errors++;
+          }
+          continue;
+        }
+
+        fs  = (double)pll_in * clk->plln / ((double)clk->pllr * ratio * clk->div);
+        err = (fs > freq) ? (fs - freq) : (freq - fs);
+        ppm = (fs - freq) * 1e6 / freq;
+
+        printf("  %6u %5u %4u %2u %3u %10u %6d\n", freq, ratio,
+               clk->plln, clk->pllr, clk->div, clk->actual, clk->ppm);
+
+        /* Register field limits */
+        if ((clk->plln < 50U) || (clk->plln > 432U) || (clk->pllr < 2U) || (clk->pllr > 7U) ||
+            (clk->div < 4U) || (clk->div > 511U) ||
+            (((uint64_t)pll_in * clk->plln) < 100000000U) ||
+            (((uint64_t)pll_in * clk->plln) > 432000000U) ||
+            (((uint64_t)pll_in * clk->plln / clk->pllr) > 192000000U)) {
+          printf("    setting out of range\n");
+          errors++;
+        }
+
+        /* Minimum error of all settings */
+        if (err > (best + 1e-6)) {
+          printf("    error %.6f Hz, best possible %.6f Hz\n", err, best);
+          errors++;
+        }
+
+        /* Reported rate and error */
+        if ((((double)clk->actual - fs) > 0.5) || ((fs - (double)clk->actual) > 0.5) ||
+            (((double)clk->ppm - ppm) > 1.0) || ((ppm - (double)clk->ppm) > 1.0)) {
+          printf("    reported %u Hz %d ppm, computed %.3f Hz %.3f ppm\n",
+                 clk->actual, clk->ppm, fs, ppm);
+          errors++;
+        }
+
+        /* Cached result */
+        if (I2S_ClockSolve(freq, ratio) != clk) {
+          printf("    result not cached\n");
+          errors++;
+        }
+      }
+    }
+  }
+
+  printf("I2S clock solver: %s\n", (errors != 0U) ? "FAILED" : "passed");
+
+  return (errors != 0U) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,299 @@
+/*
+ * Copyright (C) 2019 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Host test of memory to memory DMA for STMicroelectronics STM32F4xx
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "stm32f4_mock.h"
+#include "MEMDMA_STM32F4xx.h"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define BUF_SIZE                  (320U * 1024U)
+#define GUARD                     16U
+#define BENCH_LOOPS               2000U
+
+#define CHECK(cond, ...)          do { if (!(cond)) { printf(__VA_ARGS__); printf("\n"); errors++; } } while (0)
+
+/*******************************************************************************
+ *  function prototypes (scope: module-local)
+ ******************************************************************************/
+
+void MEMDMA_DMA_Handler(void);
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static uint8_t *src_buf;
+static uint8_t *dst_buf;
+static MEMDMA_REQUEST *req;
+
+static MEMDMA_REQUEST *done_order[8];
+static uint32_t done_cnt;
+static uint32_t errors;
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static void RequestDone(MEMDMA_REQUEST *r)
+{
+  if (done_cnt < 8U)
+    done_order[done_cnt] = r;
+  done_cnt++;
+}
+
+static double Now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/* Copy and fill at all address and length alignments */
+static void TestAlignment(void)
+{
+  static const uint32_t sizes[] = { 1U, 2U, 3U, 4U, 15U, 16U, 17U, 127U, 128U, 129U, 1000U, 4096U, 4099U };
+
+  for (uint32_t s = 0U; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    for (uint32_t so = 0U; so < 4U; so++) {
+      for (uint32_t d = 0U; d < 4U; d++) {
+        uint32_t num = sizes[s];
+        uint8_t *dst = &dst_buf[GUARD + d];
+        uint8_t *src = &src_buf[so];
+
+        for (uint32_t i = 0U; i < num + 8U; i++)
+          src[i] = (uint8_t)rand();
+        memset(dst_buf, 0xEE, num + 2U * GUARD);
+
+        CHECK(MEMDMA_Copy(req, dst, src, num, NULL) == ARM_DRIVER_OK, "copy %u: submit failed", num);
+        MOCK_DMARun();
+        CHECK(req->status == MEMDMA_REQUEST_DONE, "copy %u: status %u", num, req->status);
+        CHECK(memcmp(dst, src, num) == 0, "copy %u src+%u dst+%u: data mismatch", num, so, d);
+        CHECK((dst[-1] == 0xEEU) && (dst[num] == 0xEEU), "copy %u src+%u dst+%u: guard overwritten", num, so, d);
+
+        memset(dst_buf, 0xEE, num + 2U * GUARD);
+
+        CHECK(MEMDMA_Fill(req, dst, (uint8_t)(so + 0x5AU), num, NULL) == ARM_DRIVER_OK, "fill %u: submit failed", num);
+        MOCK_DMARun();
+        CHECK(req->status == MEMDMA_REQUEST_DONE, "fill %u: status %u", num, req->status);
+        for (uint32_t i = 0U; i < num; i++) {
+          if (dst[i] != (uint8_t)(so + 0x5AU)) {
+            CHECK(0, "fill %u dst+%u: data mismatch at %u", num, d, i);
+            break;
+          }
+        }
+        CHECK((dst[-1] == 0xEEU) && (dst[num] == 0xEEU), "fill %u dst+%u: guard overwritten", num, d);
+      }
+    }
+  }
+}
+
+/* Request larger than one DMA transfer */
+static void TestChunks(void)
+{
+  uint32_t num = BUF_SIZE - 2U * GUARD;
+
+  for (uint32_t i = 0U; i < num; i++)
+    src_buf[i] = (uint8_t)rand();
+  memset(dst_buf, 0, BUF_SIZE);
+
+  CHECK(MEMDMA_Copy(req, dst_buf, src_buf, num, NULL) == ARM_DRIVER_OK, "chunks: submit failed");
+  MOCK_DMARun();
+  CHECK(req->status == MEMDMA_REQUEST_DONE, "chunks: status %u", req->status);
+  CHECK(req->done == num, "chunks: %u of %u bytes done", req->done, num);
+  CHECK(memcmp(dst_buf, src_buf, num) == 0, "chunks: data mismatch");
+}
+
+/* Requests complete in submit order, CPU copies do not overtake the queue */
+static void TestOrder(void)
+{
+  MEMDMA_REQUEST *r = req;
+  uint8_t *ccm = (uint8_t *)CCMDATARAM_BASE;
+
+  done_cnt = 0U;
+
+  CHECK(MEMDMA_Copy(&r[0], &dst_buf[0],    &src_buf[0],    4096U, RequestDone) == ARM_DRIVER_OK, "order: submit 0 failed");
+  CHECK(MEMDMA_Fill(&r[1], &dst_buf[4096], 0x11U,          4096U, RequestDone) == ARM_DRIVER_OK, "order: submit 1 failed");
+  CHECK(MEMDMA_Copy(&r[2], &dst_buf[8192], &src_buf[8192], 8U,    RequestDone) == ARM_DRIVER_OK, "order: submit 2 failed");
+
+  /* Short request is queued behind the running ones */
+  CHECK((done_cnt == 0U) && (r[2].status == MEMDMA_REQUEST_PENDING), "order: short request not queued");
+
+  /* CCM RAM block can not be queued */
+  CHECK(MEMDMA_Copy(&r[3], ccm, &src_buf[0], 64U, RequestDone) == ARM_DRIVER_ERROR_BUSY, "order: CCM request accepted while queued");
+  CHECK(r[3].status == MEMDMA_REQUEST_IDLE, "order: refused CCM request status %u", r[3].status);
+
+  MOCK_DMARun();
+
+  CHECK(done_cnt == 3U, "order: %u requests completed", done_cnt);
+  for (uint32_t i = 0U; (i < done_cnt) && (i < 3U); i++)
+    CHECK(done_order[i] == &r[i], "order: request %u completed at position %u", (uint32_t)(done_order[i] - r), i);
+
+  /* Idle queue, CCM RAM block is copied before returning */
+  done_cnt = 0U;
+  CHECK(MEMDMA_Copy(&r[3], ccm, &src_buf[0], 64U, RequestDone) == ARM_DRIVER_OK, "order: CCM request refused when idle");
+  CHECK((done_cnt == 1U) && (r[3].status == MEMDMA_REQUEST_DONE), "order: CCM request not completed");
+  CHECK(memcmp(ccm, src_buf, 64U) == 0, "order: CCM data mismatch");
+}
+
+/* Abort reports all queued requests */
+static void TestAbort(void)
+{
+  MEMDMA_REQUEST *r = req;
+
+  done_cnt = 0U;
+
+  MEMDMA_Copy(&r[0], &dst_buf[0],    &src_buf[0],    4096U, RequestDone);
+  MEMDMA_Copy(&r[1], &dst_buf[4096], &src_buf[4096], 4096U, RequestDone);
+
+  CHECK(MEMDMA_Abort() == ARM_DRIVER_OK, "abort: failed");
+  CHECK(done_cnt == 2U, "abort: %u requests reported", done_cnt);
+  CHECK((r[0].status == MEMDMA_REQUEST_ABORTED) && (r[1].status == MEMDMA_REQUEST_ABORTED), "abort: status %u %u", r[0].status, r[1].status);
+
+  MOCK_DMARun();
+  CHECK(done_cnt == 2U, "abort: late completion reported");
+
+  /* Service is usable after abort */
+  CHECK(MEMDMA_Copy(&r[0], &dst_buf[0], &src_buf[0], 4096U, NULL) == ARM_DRIVER_OK, "abort: submit after abort failed");
+  MOCK_DMARun();
+  CHECK(r[0].status == MEMDMA_REQUEST_DONE, "abort: request after abort status %u", r[0].status);
+}
+
+/* Fill request on a CCM RAM stack, DMA must not read the pattern from it */
+static void TestFillRequestInCCM(void)
+{
+  MEMDMA_REQUEST *r = (MEMDMA_REQUEST *)(CCMDATARAM_BASE + 0x100U);
+  uint32_t num = 4096U;
+
+  done_cnt = 0U;
+  memset(dst_buf, 0, num);
+
+  CHECK(MEMDMA_Fill(r, dst_buf, 0xC3U, num, RequestDone) == ARM_DRIVER_OK, "CCM request: fill refused");
+  MOCK_DMARun();
+
+  CHECK((done_cnt == 1U) && (r->status == MEMDMA_REQUEST_DONE), "CCM request: status %u", r->status);
+  for (uint32_t i = 0U; i < num; i++) {
+    if (dst_buf[i] != 0xC3U) {
+      CHECK(0, "CCM request: byte %u is 0x%02X", i, dst_buf[i]);
+      break;
+    }
+  }
+}
+
+/*
+ * CPU time of memcpy against the CPU time of a DMA request (submit, stream
+ * setup and completion interrupt). The data transfer itself is excluded,
+ * it runs in parallel on the target. Measured on the host, the crossover is
+ * an estimate only, repeat on the target for RTE_MEMDMA_CPU_THRESHOLD.
+ */
+static void Crossover(void)
+{
+  static const uint32_t sizes[] = { 16U, 32U, 64U, 128U, 256U, 512U, 1024U, 2048U, 4096U, 8192U, 16384U, 32768U, 65536U };
+  double t, t_dma = 0.0;
+  uint32_t crossover = 0U;
+
+  for (uint32_t i = 0U; i < BENCH_LOOPS; i++) {
+    t = Now();
+    MEMDMA_Copy(req, dst_buf, src_buf, 4096U, NULL);
+    t_dma += Now() - t;
+
+    MOCK_DMATransfer();
+
+    t = Now();
+    MOCK_IRQService();
+    t_dma += Now() - t;
+  }
+  t_dma /= BENCH_LOOPS;
+
+  printf("DMA request overhead: %.0f ns\n", t_dma);
+  printf("  %6s %10s\n", "bytes", "memcpy ns");
+
+  for (uint32_t s = 0U; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    double t_cpu;
+
+    t = Now();
+    for (uint32_t i = 0U; i < BENCH_LOOPS; i++) {
+      memcpy(dst_buf, src_buf, sizes[s]);
+      __asm__ volatile ("" : : "r" (dst_buf) : "memory");
+    }
+    t_cpu = (Now() - t) / BENCH_LOOPS;
+
+    printf("  %6u %10.1f\n", sizes[s], t_cpu);
+
+    if ((crossover == 0U) && (t_cpu >= t_dma))
+      crossover = sizes[s];
+  }
+
+  if (crossover != 0U)
+    printf("Crossover (host estimate): %u bytes, RTE_MEMDMA_CPU_THRESHOLD = %u\n", crossover, MEMDMA_CPU_THRESHOLD);
+  else
+    printf("Crossover (host estimate): above %u bytes, RTE_MEMDMA_CPU_THRESHOLD = %u\n",
+           sizes[sizeof(sizes) / sizeof(sizes[0]) - 1U], MEMDMA_CPU_THRESHOLD);
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+int main(void)
+{
+  if (MOCK_Initialize() != 0) {
+    printf("Peripheral address range not available\n");
+    return EXIT_FAILURE;
+  }
+
+  src_buf = MOCK_Alloc(BUF_SIZE);
+  dst_buf = MOCK_Alloc(BUF_SIZE);
+  req     = MOCK_Alloc(8U * sizeof(MEMDMA_REQUEST));
+
+  MOCK_IRQAttach(MEMDMA_DMA_IRQn, MEMDMA_DMA_Handler);
+
+  if (MEMDMA_Initialize() != ARM_DRIVER_OK) {
+    printf("MEMDMA_Initialize failed\n");
+    return EXIT_FAILURE;
+  }
+
+  srand(1U);
+
+  TestAlignment();
+  TestChunks();
+  TestOrder();
+  TestAbort();
+  TestFillRequestInCCM();
+
+  Crossover();
+
+  MEMDMA_Uninitialize();
+
+  printf("MEMDMA: %s\n", (errors != 0U) ? "FAILED" : "passed");
+
+  return (errors != 0U) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* ----------------------------- End of file ---------------------------------*/
@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2019 Sergey Koshkin <koshkin.sergey@gmail.com>
+ * All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Project: Host test of USART buffered mode for STMicroelectronics STM32F4xx
+ */
+
+/*******************************************************************************
+ *  includes
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "stm32f4_mock.h"
+
+/*******************************************************************************
+ *  USART driver, module-local FIFO functions and resources included
+ ******************************************************************************/
+
+#include "USART_STM32F4xx.c"
+
+/*******************************************************************************
+ *  defines and macros (scope: module-local)
+ ******************************************************************************/
+
+#define CHECK(cond, ...)          do { if (!(cond)) { printf(__VA_ARGS__); printf("\n"); errors++; } } while (0)
+
+#define RX_SIZE                   USART2_RX_FIFO_SIZE
+#define TX_SIZE                   USART2_TX_FIFO_SIZE
+
+/*******************************************************************************
+ *  global variable definitions (scope: module-local)
+ ******************************************************************************/
+
+static USART_RESOURCES *usart = &USART2_Resources;
+static ARM_DRIVER_USART *drv  = &Driver_USART2;
+
+static uint32_t events;
+static uint32_t errors;
+
+/*******************************************************************************
+ *  function implementations (scope: module-local)
+ ******************************************************************************/
+
+static void USART_Event(uint32_t event)
+{
+  events |= event;
+}
+
+/* Set up the asynchronous mode with both directions enabled */
+static void Configure(uint32_t data_bits)
+{
+  USART2->SR |= USART_SR_TC;
+
+  CHECK(drv->Control(ARM_USART_MODE_ASYNCHRONOUS | data_bits | ARM_USART_PARITY_NONE |
+                     ARM_USART_STOP_BITS_1 | ARM_USART_FLOW_CONTROL_NONE, 115200U) == ARM_DRIVER_OK,
+        "Control mode failed");
+  CHECK(drv->Control(ARM_USART_CONTROL_TX, 1U) == ARM_DRIVER_OK, "Control TX failed");
+  CHECK(drv->Control(ARM_USART_CONTROL_RX, 1U) == ARM_DRIVER_OK, "Control RX failed");
+}
+
+/* Receive one frame through the RXNE interrupt */
+static void RxFrame(uint16_t data)
+{
+  USART2->DR = data;
+  USART2->SR = USART_SR_RXNE;
+  USART2_IRQHandler();
+  USART2->SR = 0U;
+}
+
+/* Service one TXE interrupt, return the data register or -1 if not written */
+static int32_t TxFrame(void)
+{
+  USART2->DR = 0xFFFFU;
+  USART2->SR = USART_SR_TXE;
+  USART2_IRQHandler();
+  USART2->SR = 0U;
+
+  return (USART2->DR == 0xFFFFU) ? -1 : (int32_t)USART2->DR;
+}
+
+/* Put and get across the end of storage and across index overflow */
+static void TestFifo(void)
+{
+  uint8_t buf[16], in[24], out[24];
+  USART_FIFO fifo = { buf, sizeof(buf), 0U, 0U };
+  uint32_t start[2] = { 0U, 0xFFFFFFF8U };
+
+  for (uint32_t i = 0U; i < sizeof(in); i++)
+    in[i] = (uint8_t)(0x40U + i);
+
+  for (uint32_t s = 0U; s < 2U; s++) {
+    fifo.head = start[s];
+    fifo.tail = start[s];
+
+    for (uint32_t pass = 0U; pass < 8U; pass++) {
+      uint32_t num = 5U + (pass * 3U) % 11U;
+
+      CHECK(USART_FifoPut(&fifo, &in[pass], num) == num, "FifoPut %u bytes, pass %u", num, pass);
+      CHECK(USART_FifoCount(&fifo) == num, "FifoCount %u, expected %u", USART_FifoCount(&fifo), num);
+      CHECK(USART_FifoGet(&fifo, out, num) == num, "FifoGet %u bytes, pass %u", num, pass);
+      CHECK(memcmp(out, &in[pass], num) == 0, "FIFO data mismatch, pass %u", pass);
+    }
+
+    // Partial put when full, partial get when empty
+    CHECK(USART_FifoPut(&fifo, in, 10U) == 10U, "FifoPut 10 bytes");
+    CHECK(USART_FifoPut(&fifo, &in[10], 10U) == 6U, "FifoPut into 6 free bytes");
+    CHECK(USART_FifoPut(&fifo, in, 1U) == 0U, "FifoPut into full FIFO");
+    CHECK(USART_FifoGet(&fifo, out, 24U) == 16U, "FifoGet from full FIFO");
+    CHECK(memcmp(out, in, 16U) == 0, "Full FIFO data mismatch");
+    CHECK(USART_FifoGet(&fifo, out, 1U) == 0U, "FifoGet from empty FIFO");
+  }
+}
+
+/* RXNE fills the receive FIFO, overflow only when it is full */
+static void TestReceive(void)
+{
+  uint8_t data[RX_SIZE + 8U];
+  int32_t num;
+
+  events = 0U;
+  for (uint32_t i = 0U; i < RX_SIZE; i++)
+    RxFrame((uint16_t)(i ^ 0x5AU));
+
+  CHECK((events & ARM_USART_EVENT_RX_OVERFLOW) == 0U, "Overflow before FIFO full");
+  CHECK(USART_FifoCount(usart->rx_fifo) == RX_SIZE, "RX FIFO holds %u bytes",
+        USART_FifoCount(usart->rx_fifo));
+
+  RxFrame(0xEEU);
+  CHECK((events & ARM_USART_EVENT_RX_OVERFLOW) != 0U, "No overflow event with FIFO full");
+  CHECK(drv->GetStatus().rx_overflow == 1U, "No overflow status with FIFO full");
+
+  // Partial read returns what is available
+  num = USART2_Read(data, 10U);
+  CHECK(num == 10, "Read 10 returned %d", num);
+  num = USART2_Read(&data[10], sizeof(data));
+  CHECK(num == (int32_t)(RX_SIZE - 10U), "Read rest returned %d", num);
+  for (uint32_t i = 0U; i < RX_SIZE; i++)
+    CHECK(data[i] == (uint8_t)(i ^ 0x5AU), "RX byte %u is 0x%02X", i, data[i]);
+  CHECK(USART2_Read(data, 1U) == 0, "Read from empty FIFO");
+
+  // Space again after the FIFO was read
+  events = 0U;
+  RxFrame(0x11U);
+  CHECK((events & ARM_USART_EVENT_RX_OVERFLOW) == 0U, "Overflow after FIFO was read");
+  CHECK((USART2_Read(data, 4U) == 1) && (data[0] == 0x11U), "Read after FIFO was read");
+}
+
+/* Write queues what fits, TXE drains the transmit FIFO */
+static void TestTransmit(void)
+{
+  uint8_t data[TX_SIZE + 8U];
+  int32_t num, val;
+
+  for (uint32_t i = 0U; i < sizeof(data); i++)
+    data[i] = (uint8_t)(0xA0U + i);
+
+  num = USART2_Write(data, sizeof(data));
+  CHECK(num == (int32_t)TX_SIZE, "Write returned %d", num);
+  CHECK(USART2_Write(data, 1U) == 0, "Write into full FIFO");
+  CHECK((USART2->CR1 & USART_CR1_TXEIE) != 0U, "TXE interrupt not enabled by Write");
+  CHECK(drv->GetStatus().tx_busy == 1U, "Not busy with queued data");
+
+  for (uint32_t i = 0U; i < TX_SIZE; i++) {
+    val = TxFrame();
+    CHECK(val == (int32_t)data[i], "TX byte %u is %d", i, val);
+  }
+
+  // FIFO empty: wait for transmission complete
+  events = 0U;
+  CHECK(TxFrame() == -1, "Data written with empty FIFO");
+  CHECK((USART2->CR1 & (USART_CR1_TXEIE | USART_CR1_TCIE)) == USART_CR1_TCIE, "TXE not replaced by TC");
+
+  USART2->SR = USART_SR_TC;
+  USART2_IRQHandler();
+  CHECK((events & ARM_USART_EVENT_TX_COMPLETE) != 0U, "No TX complete event");
+}
+
+/* Nine bit data without parity takes two bytes per item */
+static void TestNineBit(void)
+{
+  uint16_t data[TX_SIZE], rx[RX_SIZE];
+  int32_t num;
+
+  Configure(ARM_USART_DATA_BITS_9);
+
+  for (uint32_t i = 0U; i < TX_SIZE; i++)
+    data[i] = (uint16_t)(0x100U | (i * 7U));
+
+  num = USART2_Write(data, TX_SIZE);
+  CHECK(num == (int32_t)(TX_SIZE / 2U), "Nine bit Write returned %d", num);
+  for (uint32_t i = 0U; i < (TX_SIZE / 2U); i++) {
+    num = TxFrame();
+    CHECK(num == (int32_t)data[i], "Nine bit TX item %u is 0x%X", i, num);
+  }
+  CHECK(TxFrame() == -1, "Nine bit data written with empty FIFO");
+  USART2->CR1 &= ~USART_CR1_TCIE;
+
+  events = 0U;
+  for (uint32_t i = 0U; i < (RX_SIZE / 2U); i++)
+    RxFrame(data[i]);
+  CHECK((events & ARM_USART_EVENT_RX_OVERFLOW) == 0U, "Nine bit overflow before FIFO full");
+  RxFrame(0x1FFU);
+  CHECK((events & ARM_USART_EVENT_RX_OVERFLOW) != 0U, "No nine bit overflow with FIFO full");
+
+  num = USART2_Read(rx, 3U);
+  CHECK(num == 3, "Nine bit Read 3 returned %d", num);
+  num = USART2_Read(&rx[3], RX_SIZE);
+  CHECK(num == (int32_t)(RX_SIZE / 2U - 3U), "Nine bit Read rest returned %d", num);
+  CHECK(memcmp(rx, data, RX_SIZE) == 0, "Nine bit RX data mismatch");
+
+  Configure(ARM_USART_DATA_BITS_8);
+}
+
+/* Send owns the transmitter, the transmit FIFO continues after it */
+static void TestSendHandoff(void)
+{
+  static const uint8_t block[3] = { 0x01U, 0x02U, 0x03U };
+  static const uint8_t queued[2] = { 0x81U, 0x82U };
+  int32_t val;
+
+  // Send waits for data queued by Write
+  CHECK(USART2_Write(queued, 1U) == 1, "Write before Send");
+  CHECK(drv->Send(block, sizeof(block)) == ARM_DRIVER_ERROR_BUSY, "Send with queued data not busy");
+  CHECK(TxFrame() == 0x81, "Queued byte not sent");
+  CHECK(TxFrame() == -1, "Data written with empty FIFO");
+  USART2->CR1 &= ~USART_CR1_TCIE;
+
+  // Write while Send is active is queued behind it
+  events = 0U;
+  CHECK(drv->Send(block, sizeof(block)) == ARM_DRIVER_OK, "Send failed");
+  CHECK(USART2_Write(queued, sizeof(queued)) == 2, "Write during Send");
+
+  for (uint32_t i = 0U; i < sizeof(block); i++) {
+    val = TxFrame();
+    CHECK(val == (int32_t)block[i], "Send byte %u is %d", i, val);
+  }
+  CHECK((events & ARM_USART_EVENT_SEND_COMPLETE) != 0U, "No send complete event");
+  CHECK(usart->xfer->send_active == 0U, "Send still active");
+  CHECK((USART2->CR1 & USART_CR1_TXEIE) != 0U, "TXE interrupt not kept for queued data");
+
+  for (uint32_t i = 0U; i < sizeof(queued); i++) {
+    val = TxFrame();
+    CHECK(val == (int32_t)queued[i], "Queued byte %u after Send is %d", i, val);
+  }
+  CHECK(TxFrame() == -1, "Data written with empty FIFO");
+}
+
+/*******************************************************************************
+ *  function implementations (scope: module-exported)
+ ******************************************************************************/
+
+int main(void)
+{
+  if (MOCK_Initialize() != 0) {
+    printf("Peripheral address range not available\n");
+    return EXIT_FAILURE;
+  }
+
+  TestFifo();
+
+  if ((drv->Initialize(USART_Event) != ARM_DRIVER_OK) ||
+      (drv->PowerControl(ARM_POWER_FULL) != ARM_DRIVER_OK)) {
+    printf("USART2 initialization failed\n");
+    return EXIT_FAILURE;
+  }
+
+  Configure(ARM_USART_DATA_BITS_8);
+
+  TestReceive();
+  TestTransmit();
+  TestNineBit();
+  TestSendHandoff();
+
+  drv->PowerControl(ARM_POWER_OFF);
+  drv->Uninitialize();
+
+  printf("USART buffered mode: %s\n", (errors != 0U) ? "FAILED" : "passed");
+
+  return (errors != 0U) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* ----------------------------- End of file ---------------------------------*/